@@ -7,6 +7,9 @@
 #include "lc3_file.h"
 #include "sd_card.h"
 
+#include <errno.h>
+#include <string.h>
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sd_card_lc3_file, CONFIG_MODULE_SD_CARD_LC3_FILE_LOG_LEVEL);
 
@@ -40,6 +43,177 @@ int lc3_header_get(struct lc3_file_ctx const *const file, struct lc3_file_header
 	return 0;
 }
 
+/**
+ * @brief Read from the file into the free part of the read-ahead buffer.
+ *
+ * @details Every read ends on a chunk boundary in the file, so the SD card is accessed in whole,
+ *	    aligned chunks after the first read. The buffer index of a byte is its file offset
+ *	    modulo the buffer size, so at most two reads are needed to fill the buffer.
+ *
+ * @param[in]	file	Pointer to the file context.
+ *
+ * @retval 0	Success, negative value otherwise.
+ */
+static int read_ahead_fill(struct lc3_file_ctx *file)
+{
+	int ret;
+
+	while (!file->read_ahead_eof) {
+		uint32_t used = file->read_ahead_wr - file->read_ahead_rd;
+		size_t offset = file->read_ahead_wr % file->read_ahead_size;
+		size_t size = MIN(file->read_ahead_size - used, file->read_ahead_size - offset);
+		uint32_t end = ROUND_DOWN(file->read_ahead_wr + size,
+					  CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE);
+
+		if (end <= file->read_ahead_wr) {
+			/* No room for the rest of the current chunk */
+			break;
+		}
+
+		size = end - file->read_ahead_wr;
+
+		size_t read_size = size;
+
+		ret = sd_card_read((char *)&file->read_ahead_buf[offset], &read_size,
+				   &file->file_object);
+		if (ret) {
+			LOG_ERR("Failed to read ahead: %d", ret);
+			return ret;
+		}
+
+		file->read_ahead_wr += read_size;
+
+		if (read_size < size) {
+			file->read_ahead_eof = true;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Make sure the read-ahead buffer holds a number of unparsed bytes.
+ *
+ * @param[in]	file	Pointer to the file context.
+ * @param[in]	size	Number of bytes needed.
+ *
+ * @retval -ENODATA	End of file reached before the bytes were read.
+ * @retval -ENOMEM	Read-ahead buffer too small.
+ * @retval 0		Success.
+ */
+static int read_ahead_ensure(struct lc3_file_ctx *file, size_t size)
+{
+	int ret;
+
+	if ((file->read_ahead_wr - file->read_ahead_rd) >= size) {
+		return 0;
+	}
+
+	ret = read_ahead_fill(file);
+	if (ret) {
+		return ret;
+	}
+
+	if ((file->read_ahead_wr - file->read_ahead_rd) >= size) {
+		return 0;
+	}
+
+	if (file->read_ahead_eof) {
+		return -ENODATA;
+	}
+
+	LOG_ERR("Read-ahead buffer too small: %d", file->read_ahead_size);
+	return -ENOMEM;
+}
+
+/**
+ * @brief Top up the read-ahead buffer when at least one chunk of it is free.
+ *
+ * @details Called after a frame is delivered, so that each SD card read is about the size of the
+ *	    frames consumed since the last one, instead of the whole buffer being read when the
+ *	    next frame no longer fits.
+ *
+ * @param[in]	file	Pointer to the file context.
+ *
+ * @retval 0	Success, negative value otherwise.
+ */
+static int read_ahead_top_up(struct lc3_file_ctx *file)
+{
+	uint32_t used = file->read_ahead_wr - file->read_ahead_rd;
+
+	if (file->read_ahead_eof ||
+	    ((file->read_ahead_size - used) < CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE)) {
+		return 0;
+	}
+
+	return read_ahead_fill(file);
+}
+
+/**
+ * @brief Copy unparsed bytes out of the read-ahead buffer.
+ *
+ * @param[in]	file	Pointer to the file context.
+ * @param[out]	buffer	Pointer to the buffer to store the bytes.
+ * @param[in]	size	Number of bytes to copy.
+ */
+static void read_ahead_copy(struct lc3_file_ctx *file, uint8_t *buffer, size_t size)
+{
+	size_t offset = file->read_ahead_rd % file->read_ahead_size;
+	size_t first = MIN(size, file->read_ahead_size - offset);
+
+	memcpy(buffer, &file->read_ahead_buf[offset], first);
+	memcpy(&buffer[first], file->read_ahead_buf, size - first);
+
+	file->read_ahead_rd += size;
+}
+
+static int read_ahead_frame_get(struct lc3_file_ctx *file, uint8_t *buffer, size_t buffer_size)
+{
+	int ret;
+	uint16_t frame_header;
+
+	ret = read_ahead_ensure(file, sizeof(frame_header));
+	if (ret == -ENODATA) {
+		LOG_DBG("No more frames to read");
+		return ret;
+	} else if (ret) {
+		return ret;
+	}
+
+	read_ahead_copy(file, (uint8_t *)&frame_header, sizeof(frame_header));
+
+	if (frame_header == 0) {
+		LOG_DBG("No more frames to read");
+		return -ENODATA;
+	}
+
+	LOG_DBG("Size of frame is %d", frame_header);
+
+	if (buffer_size < frame_header) {
+		LOG_ERR("Buffer size too small: %d < %d", buffer_size, frame_header);
+		return -ENOMEM;
+	}
+
+	ret = read_ahead_ensure(file, frame_header);
+	if (ret == -ENODATA) {
+		LOG_ERR("Frame size mismatch: %d != %d",
+			file->read_ahead_wr - file->read_ahead_rd, frame_header);
+		return -EIO;
+	} else if (ret) {
+		return ret;
+	}
+
+	read_ahead_copy(file, buffer, frame_header);
+
+	ret = read_ahead_top_up(file);
+	if (ret) {
+		/* The frame is delivered, the read is retried when the next frame is fetched */
+		LOG_WRN("Failed to top up read-ahead buffer: %d", ret);
+	}
+
+	return 0;
+}
+
 int lc3_file_frame_get(struct lc3_file_ctx *file, uint8_t *buffer, size_t buffer_size)
 {
 	int ret;
@@ -49,6 +223,10 @@ int lc3_file_frame_get(struct lc3_file_ctx *file, uint8_t *buffer, size_t buffer
 		return -EINVAL;
 	}
 
+	if (file->read_ahead_buf != NULL) {
+		return read_ahead_frame_get(file, buffer, buffer_size);
+	}
+
 	/* Read frame header */
 	uint16_t frame_header;
 	size_t frame_header_size = sizeof(frame_header);
@@ -88,6 +266,34 @@ int lc3_file_frame_get(struct lc3_file_ctx *file, uint8_t *buffer, size_t buffer
 	return 0;
 }
 
+int lc3_file_rewind(struct lc3_file_ctx *file)
+{
+	int ret;
+
+	if (file == NULL) {
+		LOG_ERR("Nullptr received");
+		return -EINVAL;
+	}
+
+	if ((file->read_ahead_buf != NULL) && (file->read_ahead_wr <= file->read_ahead_size)) {
+		/* Nothing read from the file has been overwritten yet */
+		file->read_ahead_rd = sizeof(file->lc3_header);
+		return 0;
+	}
+
+	ret = sd_card_seek(sizeof(file->lc3_header), &file->file_object);
+	if (ret) {
+		LOG_ERR("Failed to seek to the first frame: %d", ret);
+		return ret;
+	}
+
+	file->read_ahead_rd = sizeof(file->lc3_header);
+	file->read_ahead_wr = sizeof(file->lc3_header);
+	file->read_ahead_eof = false;
+
+	return 0;
+}
+
 int lc3_file_open(struct lc3_file_ctx *file, const char *file_name)
 {
 	int ret;
@@ -98,6 +304,14 @@ int lc3_file_open(struct lc3_file_ctx *file, const char *file_name)
 		return -EINVAL;
 	}
 
+	if ((file->read_ahead_buf != NULL) &&
+	    ((file->read_ahead_size == 0) ||
+	     (file->read_ahead_size % CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE))) {
+		LOG_ERR("Read-ahead size %d is not a multiple of %d", file->read_ahead_size,
+			CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE);
+		return -EINVAL;
+	}
+
 	ret = sd_card_open(file_name, &file->file_object);
 	if (ret) {
 		LOG_ERR("Failed to open file: %d", ret);
@@ -119,6 +333,10 @@ int lc3_file_open(struct lc3_file_ctx *file, const char *file_name)
 		return -EINVAL;
 	}
 
+	file->read_ahead_rd = sizeof(file->lc3_header);
+	file->read_ahead_wr = sizeof(file->lc3_header);
+	file->read_ahead_eof = false;
+
 	return 0;
 }
 
@@ -7,6 +7,7 @@
 #ifndef LC3_FILE_H__
 #define LC3_FILE_H__
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -29,6 +30,20 @@ struct lc3_file_ctx {
 	struct fs_file_t file_object;
 	struct lc3_file_header lc3_header;
 	uint32_t number_of_samples;
+
+	/* Optional read-ahead buffer, set by the owner of the context before the file is opened.
+	 * When set, the file is read in chunks of CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE bytes
+	 * aligned to the start of the file, and frames are taken from RAM. The size must be a
+	 * multiple of the chunk size and leave room for a chunk in addition to the largest frame.
+	 * Set read_ahead_buf to NULL to read every frame directly from the file.
+	 */
+	uint8_t *read_ahead_buf;
+	size_t read_ahead_size;
+
+	/* File offsets of the next byte to parse and of the next byte to read from the file */
+	uint32_t read_ahead_rd;
+	uint32_t read_ahead_wr;
+	bool read_ahead_eof;
 };
 
 /**
@@ -54,6 +69,19 @@ int lc3_header_get(struct lc3_file_ctx const *const file, struct lc3_file_header
  */
 int lc3_file_frame_get(struct lc3_file_ctx *file, uint8_t *buffer, size_t buffer_size);
 
+/**
+ * @brief Rewind the file to the first LC3 frame.
+ *
+ * @details The file is not closed and reopened. If the whole file fits in the read-ahead
+ *	    buffer, the frames are read from RAM again without accessing the SD card.
+ *
+ * @param[in]	file	Pointer to the file context.
+ *
+ * @retval -EINVAL	Invalid file context.
+ * @retval 0		Success.
+ */
+int lc3_file_rewind(struct lc3_file_ctx *file);
+
 /**
  * @brief Open a LC3 file for reading
  *
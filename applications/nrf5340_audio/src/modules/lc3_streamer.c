@@ -20,6 +20,16 @@ struct k_work_q lc3_streamer_work_q;
 
 #define LC3_STREAMER_BUFFER_NUM_FRAMES 2
 
+#if CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0
+BUILD_ASSERT((CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE %
+	      CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE) == 0,
+	     "Read-ahead size must be a multiple of the LC3 file chunk size");
+BUILD_ASSERT(CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE >=
+		     (CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE + sizeof(uint16_t) +
+		      CONFIG_SD_CARD_LC3_STREAMER_MAX_FRAME_SIZE),
+	     "Read-ahead size must hold a chunk in addition to the largest frame");
+#endif /* CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0 */
+
 enum lc3_stream_states {
 	/* Stream ready to load file and start streaming */
 	STREAM_IDLE = 0,
@@ -60,6 +70,11 @@ struct lc3_stream {
 	char msgq_buffer[LC3_STREAMER_BUFFER_NUM_FRAMES * sizeof(struct data_fifo_msgq)];
 	char slab_buffer[LC3_STREAMER_BUFFER_NUM_FRAMES *
 			 CONFIG_SD_CARD_LC3_STREAMER_MAX_FRAME_SIZE];
+
+#if CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0
+	/* Buffer used by the LC3 file to read ahead of the frames being streamed */
+	uint8_t read_ahead_buffer[CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE];
+#endif /* CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0 */
 };
 
 static struct lc3_stream streams[CONFIG_SD_CARD_LC3_STREAMER_MAX_NUM_STREAMS];
@@ -145,7 +160,7 @@ static int put_next_frame_to_fifo(struct lc3_stream *stream)
 }
 
 /**
- * @brief Loop the stream by closing and re-opening the file, and loading the first frame.
+ * @brief Loop the stream by rewinding the file, and loading the first frame.
  *
  * @param[in]	stream	Pointer to the stream to loop.
  *
@@ -155,28 +170,15 @@ static int stream_loop(struct lc3_stream *stream)
 {
 	int ret;
 
-	ret = lc3_file_close(&stream->file);
-	if (ret) {
-		LOG_ERR("Failed to close file %d", ret);
-		return ret;
-	}
-
-	ret = lc3_file_open(&stream->file, stream->filename);
+	ret = lc3_file_rewind(&stream->file);
 	if (ret) {
-		LOG_ERR("Failed to open file %d", ret);
+		LOG_ERR("Failed to rewind file %d", ret);
 		return ret;
 	}
 
 	ret = put_next_frame_to_fifo(stream);
 	if (ret) {
 		LOG_ERR("Failed to put first frame after loop to fifo %d", ret);
-
-		int lc3_file_ret = lc3_file_close(&stream->file);
-
-		if (lc3_file_ret) {
-			LOG_ERR("Failed to close file %d", lc3_file_ret);
-		}
-
 		return ret;
 	}
 
@@ -284,7 +286,7 @@ bool lc3_streamer_file_compatible_check(const char *const filename,
 		return false;
 	}
 
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 
 	ret = lc3_file_open(&file, filename);
 	if (ret) {
@@ -517,6 +519,10 @@ int lc3_streamer_init(void)
 		streams[i].fifo.block_size_max = WB_UP(CONFIG_SD_CARD_LC3_STREAMER_MAX_FRAME_SIZE);
 		streams[i].fifo.elements_max = LC3_STREAMER_BUFFER_NUM_FRAMES;
 		streams[i].fifo.initialized = false;
+#if CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0
+		streams[i].file.read_ahead_buf = streams[i].read_ahead_buffer;
+		streams[i].file.read_ahead_size = sizeof(streams[i].read_ahead_buffer);
+#endif /* CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0 */
 		streams[i].active_buffer = NULL;
 		streams[i].state = STREAM_IDLE;
 	}
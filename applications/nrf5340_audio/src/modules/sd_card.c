@@ -245,6 +245,19 @@ int sd_card_read(char *buf, size_t *size, struct fs_file_t *f_seg_read_entry)
 	return 0;
 }
 
+int sd_card_seek(off_t offset, struct fs_file_t *f_seg_read_entry)
+{
+	int ret;
+
+	ret = fs_seek(f_seg_read_entry, offset, FS_SEEK_SET);
+	if (ret) {
+		LOG_ERR("Seek file failed. Ret: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
 int sd_card_close(struct fs_file_t *f_seg_read_entry)
 {
 	int ret;
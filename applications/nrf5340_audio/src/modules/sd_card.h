@@ -105,6 +105,17 @@ int sd_card_open(char const *const filename, struct fs_file_t *f_seg_read_entry)
  */
 int sd_card_read(char *buf, size_t *size, struct fs_file_t *f_seg_read_entry);
 
+/**
+ * @brief	Set the read position in the open file on the SD card.
+ *
+ * @param[in]		offset			Offset from the start of the file.
+ * @param[in, out]	f_seg_read_entry	Pointer to a file object.
+ *
+ * @retval	0 on success.
+ * @retval	Otherwise, error from underlying drivers.
+ */
+int sd_card_seek(off_t offset, struct fs_file_t *f_seg_read_entry);
+
 /**
  * @brief	Close the file opened by the sd_card_segment_read_open function.
  *
@@ -30,6 +30,7 @@ extern "C" {
 #define REPORT_MASK_KEYBOARD_KEYS	{} /* Store the whole report */
 
 
+#define KEYBOARD_REPORT_ERROR_ROLLOVER	0x01 /* Keyboard ErrorRollOver */
 #define KEYBOARD_REPORT_LAST_KEY	0x65 /* Keyboard Application */
 #define KEYBOARD_REPORT_FIRST_MODIFIER	0xE0 /* Keyboard Left Ctrl */
 #define KEYBOARD_REPORT_LAST_MODIFIER	0xE7 /* Keyboard Right GUI */
@@ -28,6 +28,9 @@
 #include "hid_keymap.h"
 #include CONFIG_DESKTOP_HID_STATE_HID_KEYMAP_DEF_PATH
 #include "hid_report_desc.h"
+#if defined(CONFIG_DESKTOP_HID_STATE_KEYBOARD_KEY_BITMAP)
+#include "hid_key_bitmap.h"
+#endif
 
 #define MODULE hid_state
 #include <caf/events/module_state_event.h>
@@ -100,6 +103,9 @@ struct axis_data {
 
 struct report_data {
 	struct items items;
+#if defined(CONFIG_DESKTOP_HID_STATE_KEYBOARD_KEY_BITMAP)
+	struct hid_key_bitmap *keys;
+#endif
 	struct eventq eventq;
 	struct axis_data axes;
 	struct report_state *linked_rs;
@@ -138,6 +144,10 @@ struct hid_state {
 static const struct report_data empty_rd = {
 			.eventq.root = SYS_SLIST_STATIC_INIT(&empty_rd.eventq.root)};
 
+#if defined(CONFIG_DESKTOP_HID_STATE_KEYBOARD_KEY_BITMAP)
+static struct hid_key_bitmap keyboard_keys;
+#endif
+
 static uint8_t report_data_index[REPORT_ID_COUNT];
 static uint8_t report_state_index[REPORT_ID_COUNT];
 static struct hid_state state;
@@ -399,22 +409,27 @@ static void eventq_cleanup(struct eventq *eventq, uint32_t timestamp)
 	}
 }
 
-static void sort_by_usage_id(struct item items[], size_t array_size)
+/**@brief Move an item to its position in the array sorted by usage ID.
+ *
+ * Only the item at the given index may be out of order, so a single pass
+ * of insertion sort is enough.
+ */
+static void item_position_update(struct item items[], size_t array_size, size_t idx)
 {
-	for (size_t k = 0; k < array_size; k++) {
-		size_t id = k;
+	while ((idx > 0) && (items[idx - 1].usage_id > items[idx].usage_id)) {
+		struct item tmp = items[idx - 1];
 
-		for (size_t l = k + 1; l < array_size; l++) {
-			if (items[l].usage_id < items[id].usage_id) {
-				id = l;
-			}
-		}
-		if (id != k) {
-			struct item tmp = items[k];
+		items[idx - 1] = items[idx];
+		items[idx] = tmp;
+		idx--;
+	}
 
-			items[k] = items[id];
-			items[id] = tmp;
-		}
+	while ((idx + 1 < array_size) && (items[idx + 1].usage_id < items[idx].usage_id)) {
+		struct item tmp = items[idx + 1];
+
+		items[idx + 1] = items[idx];
+		items[idx] = tmp;
+		idx++;
 	}
 }
 
@@ -435,6 +450,11 @@ static void clear_report_data(struct report_data *rd)
 
 	clear_axes(&rd->axes);
 	clear_items(&rd->items);
+#if defined(CONFIG_DESKTOP_HID_STATE_KEYBOARD_KEY_BITMAP)
+	if (rd->keys) {
+		hid_key_bitmap_reset(rd->keys);
+	}
+#endif
 	eventq_reset(&rd->eventq);
 }
 
@@ -504,6 +524,7 @@ static bool key_value_set(struct items *items, uint16_t usage_id, int16_t value)
 
 	bool update_needed = false;
 	struct item *p_item;
+	size_t idx = 0;
 
 	__ASSERT_NO_MSG(usage_id != 0);
 	__ASSERT_NO_MSG(items->item_count_max > 0);
@@ -523,6 +544,7 @@ static bool key_value_set(struct items *items, uint16_t usage_id, int16_t value)
 
 	if (p_item) {
 		/* Item is present in the array - update its value. */
+		idx = p_item - items->item;
 		p_item->value += value;
 		if (p_item->value == 0) {
 			__ASSERT_NO_MSG(items->item_count != 0);
@@ -547,7 +569,7 @@ static bool key_value_set(struct items *items, uint16_t usage_id, int16_t value)
 		/* After sort operation, free slots (zeros) are stored
 		 * at the beginning of the array.
 		 */
-		size_t const idx = ARRAY_SIZE(items->item) - prev_item_count - 1;
+		idx = ARRAY_SIZE(items->item) - prev_item_count - 1;
 
 		__ASSERT_NO_MSG(items->item[idx].usage_id == 0);
 
@@ -560,15 +582,63 @@ static bool key_value_set(struct items *items, uint16_t usage_id, int16_t value)
 	}
 
 	if (prev_item_count != items->item_count) {
-		/* Sort elements on the list. Use simple algorithm
-		 * with small footprint.
+		/* Keep elements on the list sorted. Only the added or
+		 * removed element is out of order.
 		 */
-		sort_by_usage_id(items->item, ARRAY_SIZE(items->item));
+		item_position_update(items->item, ARRAY_SIZE(items->item), idx);
 	}
 
 	return update_needed;
 }
 
+static bool report_data_value_set(struct report_data *rd, uint16_t usage_id, int16_t value)
+{
+#if defined(CONFIG_DESKTOP_HID_STATE_KEYBOARD_KEY_BITMAP)
+	if (rd->keys) {
+		return hid_key_bitmap_value_set(rd->keys, usage_id, value);
+	}
+#endif
+
+	return key_value_set(&rd->items, usage_id, value);
+}
+
+/**@brief Fill keyboard report keys and modifiers from the items array. */
+static uint8_t keyboard_keys_from_items(const struct items *items, uint8_t *keys)
+{
+	uint8_t modifier_bm = 0;
+	const size_t max = ARRAY_SIZE(items->item);
+	size_t cnt = 0;
+
+	for (size_t i = 0; (i < max) && (cnt < KEYBOARD_REPORT_KEY_COUNT_MAX); i++) {
+		struct item item = items->item[max - i - 1];
+
+		if (item.usage_id) {
+			__ASSERT_NO_MSG(item.value > 0);
+			if (item.usage_id <= KEYBOARD_REPORT_LAST_KEY) {
+				__ASSERT_NO_MSG(item.usage_id <= UINT8_MAX);
+				keys[cnt] = item.usage_id;
+				cnt++;
+			} else if ((item.usage_id >= KEYBOARD_REPORT_FIRST_MODIFIER) &&
+				   (item.usage_id <= KEYBOARD_REPORT_LAST_MODIFIER)) {
+				/* Make sure any key bitmask will fit into modifiers. */
+				BUILD_ASSERT(KEYBOARD_REPORT_LAST_MODIFIER - KEYBOARD_REPORT_FIRST_MODIFIER < 8);
+				modifier_bm |= BIT(item.usage_id - KEYBOARD_REPORT_FIRST_MODIFIER);
+			} else {
+				LOG_WRN("Undefined usage 0x%x", item.usage_id);
+			}
+		} else {
+			break;
+		}
+	}
+
+	/* Fill the rest of report with zeros. */
+	for (; cnt < KEYBOARD_REPORT_KEY_COUNT_MAX; cnt++) {
+		keys[cnt] = 0;
+	}
+
+	return modifier_bm;
+}
+
 static void send_report_keyboard(struct report_state *rs, struct report_data *rd)
 {
 	__ASSERT_NO_MSG((IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_KEYBOARD_SUPPORT) &&
@@ -599,37 +669,18 @@ static void send_report_keyboard(struct report_state *rs, struct report_data *rd
 	event->dyndata.data[0] = rs->report_id;
 	event->dyndata.data[2] = 0; /* Reserved byte */
 
-	uint8_t modifier_bm = 0;
+	uint8_t modifier_bm;
 	uint8_t *keys = &event->dyndata.data[3];
 
-	const size_t max = ARRAY_SIZE(rd->items.item);
-	size_t cnt = 0;
-	for (size_t i = 0; (i < max) && (cnt < KEYBOARD_REPORT_KEY_COUNT_MAX); i++) {
-		struct item item = rd->items.item[max - i - 1];
-
-		if (item.usage_id) {
-			__ASSERT_NO_MSG(item.value > 0);
-			if (item.usage_id <= KEYBOARD_REPORT_LAST_KEY) {
-				__ASSERT_NO_MSG(item.usage_id <= UINT8_MAX);
-				keys[cnt] = item.usage_id;
-				cnt++;
-			} else if ((item.usage_id >= KEYBOARD_REPORT_FIRST_MODIFIER) &&
-				   (item.usage_id <= KEYBOARD_REPORT_LAST_MODIFIER)) {
-				/* Make sure any key bitmask will fit into modifiers. */
-				BUILD_ASSERT(KEYBOARD_REPORT_LAST_MODIFIER - KEYBOARD_REPORT_FIRST_MODIFIER < 8);
-				modifier_bm |= BIT(item.usage_id - KEYBOARD_REPORT_FIRST_MODIFIER);
-			} else {
-				LOG_WRN("Undefined usage 0x%x", item.usage_id);
-			}
-		} else {
-			break;
-		}
-	}
-
-	/* Fill the rest of report with zeros. */
-	for (; cnt < KEYBOARD_REPORT_KEY_COUNT_MAX; cnt++) {
-		keys[cnt] = 0;
+#if defined(CONFIG_DESKTOP_HID_STATE_KEYBOARD_KEY_BITMAP)
+	if (rd->keys) {
+		modifier_bm = hid_key_bitmap_report_fill(rd->keys, keys);
+	} else {
+		modifier_bm = keyboard_keys_from_items(&rd->items, keys);
 	}
+#else
+	modifier_bm = keyboard_keys_from_items(&rd->items, keys);
+#endif
 
 	event->dyndata.data[1] = modifier_bm;
 
@@ -835,9 +886,9 @@ static bool update_report(struct report_data *rd)
 
 		__ASSERT_NO_MSG(event);
 
-		update_needed = key_value_set(&rd->items,
-					      event->item.usage_id,
-					      event->item.value);
+		update_needed = report_data_value_set(rd,
+						      event->item.usage_id,
+						      event->item.value);
 
 		rd->linked_rs->update_needed = rd->linked_rs->update_needed || update_needed;
 
@@ -1332,7 +1383,7 @@ static void update_key(const struct hid_keymap *map, int16_t value)
 		enqueue(rd, map->usage_id, value, connected);
 	} else {
 		/* Update state and issue report generation event. */
-		if (key_value_set(&rd->items, map->usage_id, value)) {
+		if (report_data_value_set(rd, map->usage_id, value)) {
 			report_send(NULL, rd, false, true);
 		}
 	}
@@ -1380,6 +1431,9 @@ static void init(void)
 		report_state_index[REPORT_ID_KEYBOARD_KEYS] = state_id;
 
 		state.report_data[data_id].items.item_count_max = KEYBOARD_REPORT_KEY_COUNT_MAX;
+#if defined(CONFIG_DESKTOP_HID_STATE_KEYBOARD_KEY_BITMAP)
+		state.report_data[data_id].keys = &keyboard_keys;
+#endif
 
 		data_id++;
 		state_id++;
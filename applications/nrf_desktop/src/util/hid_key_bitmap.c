@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include "hid_key_bitmap.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(hid_key_bitmap, CONFIG_DESKTOP_HID_STATE_LOG_LEVEL);
+
+/* Make sure any modifier bitmask will fit into modifiers. */
+BUILD_ASSERT(HID_KEY_BITMAP_MODIFIER_COUNT <= 8);
+
+void hid_key_bitmap_reset(struct hid_key_bitmap *kb)
+{
+	memset(kb, 0, sizeof(*kb));
+}
+
+bool hid_key_bitmap_value_set(struct hid_key_bitmap *kb, uint16_t usage_id, int16_t value)
+{
+	uint8_t *cnt;
+
+	__ASSERT_NO_MSG(usage_id != 0);
+
+	/* Report equal to zero brings no change. This should never happen. */
+	__ASSERT_NO_MSG(value != 0);
+
+	if (usage_id <= KEYBOARD_REPORT_LAST_KEY) {
+		cnt = &kb->key_cnt[usage_id];
+	} else if ((usage_id >= KEYBOARD_REPORT_FIRST_MODIFIER) &&
+		   (usage_id <= KEYBOARD_REPORT_LAST_MODIFIER)) {
+		cnt = &kb->modifier_cnt[usage_id - KEYBOARD_REPORT_FIRST_MODIFIER];
+	} else {
+		LOG_WRN("Undefined usage 0x%x", usage_id);
+		return false;
+	}
+
+	int new_cnt = *cnt + value;
+
+	if (new_cnt < 0) {
+		/* The value is used as a reference counter and must not
+		 * fall below zero. This could happen if a key up event is
+		 * lost and the state receives an unpaired key down event.
+		 */
+		return false;
+	}
+
+	if (new_cnt > UINT8_MAX) {
+		LOG_WRN("Usage 0x%x pressed too many times", usage_id);
+		return false;
+	}
+
+	bool was_pressed = (*cnt > 0);
+	bool is_pressed = (new_cnt > 0);
+
+	*cnt = new_cnt;
+
+	if (was_pressed == is_pressed) {
+		/* Report content is not changed. */
+		return false;
+	}
+
+	if (usage_id <= KEYBOARD_REPORT_LAST_KEY) {
+		kb->key_bm[usage_id / 32] ^= BIT(usage_id % 32);
+
+		if (is_pressed) {
+			kb->key_count++;
+		} else {
+			__ASSERT_NO_MSG(kb->key_count > 0);
+			kb->key_count--;
+		}
+	} else {
+		kb->modifier_bm ^= BIT(usage_id - KEYBOARD_REPORT_FIRST_MODIFIER);
+	}
+
+	return true;
+}
+
+uint8_t hid_key_bitmap_report_fill(const struct hid_key_bitmap *kb, uint8_t *keys)
+{
+	size_t cnt = 0;
+
+	if (kb->key_count > KEYBOARD_REPORT_KEY_COUNT_MAX) {
+		/* Too many keys to report - report phantom state. */
+		memset(keys, KEYBOARD_REPORT_ERROR_ROLLOVER, KEYBOARD_REPORT_KEY_COUNT_MAX);
+		return kb->modifier_bm;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(kb->key_bm); i++) {
+		uint32_t bm = kb->key_bm[i];
+
+		while (bm) {
+			keys[cnt] = (i * 32) + find_lsb_set(bm) - 1;
+			cnt++;
+			bm &= bm - 1;
+		}
+	}
+
+	__ASSERT_NO_MSG(cnt == kb->key_count);
+
+	/* Fill the rest of report with zeros. */
+	for (; cnt < KEYBOARD_REPORT_KEY_COUNT_MAX; cnt++) {
+		keys[cnt] = 0;
+	}
+
+	return kb->modifier_bm;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file
+ * @brief HID keyboard key bitmap header.
+ */
+
+#ifndef _HID_KEY_BITMAP_H_
+#define _HID_KEY_BITMAP_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#include "hid_report_keyboard.h"
+
+/**
+ * @defgroup hid_key_bitmap HID keyboard key bitmap
+ * @brief Utility that keeps the state of keyboard keys as a bitmap of pressed usages.
+ *
+ * A key press or release is handled in constant time and all the pressed keys are tracked.
+ * Every usage has a reference counter, so a key that is pressed by more than one source is
+ * released only when all of the sources release it.
+ *
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of keyboard key usages tracked in the bitmap. */
+#define HID_KEY_BITMAP_KEY_USAGE_COUNT (KEYBOARD_REPORT_LAST_KEY + 1)
+
+/** Number of keyboard modifier usages tracked in the bitmap. */
+#define HID_KEY_BITMAP_MODIFIER_COUNT \
+	(KEYBOARD_REPORT_LAST_MODIFIER - KEYBOARD_REPORT_FIRST_MODIFIER + 1)
+
+/** Keyboard keys state kept as a bitmap of pressed usages. */
+struct hid_key_bitmap {
+	/** Pressed keys. */
+	uint32_t key_bm[DIV_ROUND_UP(HID_KEY_BITMAP_KEY_USAGE_COUNT, 32)];
+	/** Reference counters of keys. */
+	uint8_t key_cnt[HID_KEY_BITMAP_KEY_USAGE_COUNT];
+	/** Reference counters of modifiers. */
+	uint8_t modifier_cnt[HID_KEY_BITMAP_MODIFIER_COUNT];
+	/** Pressed modifiers. */
+	uint8_t modifier_bm;
+	/** Number of pressed keys. */
+	uint8_t key_count;
+};
+
+/**
+ * @brief Release all the keys and modifiers.
+ *
+ * @param[in] kb	Pointer to the key bitmap.
+ */
+void hid_key_bitmap_reset(struct hid_key_bitmap *kb);
+
+/**
+ * @brief Update the reference counter of a key or modifier.
+ *
+ * @param[in] kb	Pointer to the key bitmap.
+ * @param[in] usage_id	Usage ID of the key or modifier.
+ * @param[in] value	Change of the reference counter: positive on press, negative on release.
+ *
+ * @return true if the key or modifier was pressed or released, that is the content of
+ *         the keyboard report changed. Otherwise, false is returned.
+ */
+bool hid_key_bitmap_value_set(struct hid_key_bitmap *kb, uint16_t usage_id, int16_t value);
+
+/**
+ * @brief Fill the keys of a keyboard report.
+ *
+ * The pressed keys are written in ascending usage order and the remaining slots are
+ * set to zero. If more keys are pressed than fit in the report, every slot holds the
+ * ErrorRollOver usage.
+ *
+ * @param[in] kb	Pointer to the key bitmap.
+ * @param[out] keys	Key slots of the keyboard report, @ref KEYBOARD_REPORT_KEY_COUNT_MAX
+ *			bytes.
+ *
+ * @return Bitmask of the pressed modifiers.
+ */
+uint8_t hid_key_bitmap_report_fill(const struct hid_key_bitmap *kb, uint8_t *keys);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _HID_KEY_BITMAP_H_ */
@@ -6,6 +6,7 @@
 
 #include "slm_at_host.h"
 #include "slm_at_fota.h"
+#include "slm_quit_str.h"
 #include "slm_uart_handler.h"
 #include "slm_util.h"
 #if defined(CONFIG_SLM_PPP)
@@ -28,6 +29,9 @@ LOG_MODULE_REGISTER(slm_at_host, CONFIG_SLM_LOG_LEVEL);
 #define CR		'\r'
 #define LF		'\n'
 #define HEXDUMP_LIMIT   16
+#define QUIT_STR_LEN	(sizeof(CONFIG_SLM_DATAMODE_TERMINATOR) - 1)
+
+BUILD_ASSERT(QUIT_STR_LEN > 0, "CONFIG_SLM_DATAMODE_TERMINATOR must not be empty");
 
 /* Operation mode variables */
 enum slm_operation_mode {
@@ -46,7 +50,7 @@ uint8_t slm_at_buf[SLM_AT_MAX_CMD_LEN + 1];
 uint8_t slm_data_buf[SLM_MAX_MESSAGE_SIZE];
 
 RING_BUF_DECLARE(data_rb, CONFIG_SLM_DATAMODE_BUF_SIZE);
-static uint8_t quit_str_partial_match;
+static size_t quit_str_partial_match;
 K_MUTEX_DEFINE(mutex_data); /* Protects the data_rb and quit_str_partial_match. */
 
 static struct k_work raw_send_scheduled_work;
@@ -123,11 +127,35 @@ static bool exit_datamode(void)
 	return ret;
 }
 
+/* Lock mutex_mode, before calling. Returns the number of bytes consumed. */
+static size_t datamode_send(const uint8_t *data, size_t size_send, uint8_t flags)
+{
+	int size_sent;
+	size_t size_finish = size_send;
+
+	LOG_HEXDUMP_DBG(data, MIN(size_send, HEXDUMP_LIMIT), "RX");
+	if (datamode_handler) {
+		size_sent = datamode_handler(DATAMODE_SEND, data, size_send, flags);
+		if (size_sent > 0) {
+			size_finish = size_sent;
+		} else if (size_sent < 0) {
+			LOG_WRN("Raw send failed, %zu dropped", size_send);
+		}
+	} else {
+		LOG_WRN("no handler, %zu dropped", size_send);
+	}
+
+#if defined(CONFIG_SLM_DATAMODE_URC)
+	rsp_send("\r\n#XDATAMODE: %zu\r\n", size_finish);
+#endif
+	return size_finish;
+}
+
 /* Lock mutex_data, before calling. */
 static void raw_send(uint8_t flags)
 {
 	uint8_t *data = NULL;
-	int size_send, size_sent, size_all, size_finish;
+	int size_send, size_all;
 
 	/* NOTE ring_buf_get_claim() might not return full size */
 	do {
@@ -138,32 +166,9 @@ static void raw_send(uint8_t flags)
 		}
 		LOG_INF("Raw send: size_send: %d, data %p", size_send, (void *)data);
 		if (data != NULL && size_send > 0) {
-
-			/* Raw data sending */
-			size_finish = 0;
-
-			LOG_HEXDUMP_DBG(data, MIN(size_send, HEXDUMP_LIMIT), "RX");
 			k_mutex_lock(&mutex_mode, K_FOREVER);
-			if (datamode_handler && size_send > 0) {
-				size_sent = datamode_handler(DATAMODE_SEND, data, size_send, flags);
-				if (size_sent > 0) {
-					size_finish += size_sent;
-				} else if (size_sent == 0) {
-					size_finish += size_send;
-				} else {
-					LOG_WRN("Raw send failed, %d dropped", size_send);
-					size_finish += size_send;
-				}
-				(void)ring_buf_get_finish(&data_rb, size_finish);
-			} else {
-				LOG_WRN("no handler, %d dropped", size_send);
-				(void)ring_buf_get_finish(&data_rb, size_send + size_finish);
-			}
+			(void)ring_buf_get_finish(&data_rb, datamode_send(data, size_send, flags));
 			k_mutex_unlock(&mutex_mode);
-
-#if defined(CONFIG_SLM_DATAMODE_URC)
-			rsp_send("\r\n#XDATAMODE: %d\r\n", size_finish);
-#endif
 		} else {
 			break;
 		}
@@ -177,6 +182,21 @@ static void write_data_buf(const uint8_t *buf, size_t len)
 	size_t index = 0;
 
 	while (index < len) {
+		if (ring_buf_is_empty(&data_rb) &&
+		    len - index >= CONFIG_SLM_DATAMODE_BUF_SIZE) {
+			/* The data would fill the whole buffer anyway. Send it directly
+			 * from the caller's buffer (the refcounted UART RX buffer)
+			 * instead of copying it through data_rb.
+			 */
+			LOG_INF("Raw send: size_send: %d, data %p",
+				CONFIG_SLM_DATAMODE_BUF_SIZE, (void *)(buf + index));
+			k_mutex_lock(&mutex_mode, K_FOREVER);
+			index += datamode_send(buf + index, CONFIG_SLM_DATAMODE_BUF_SIZE,
+					       SLM_DATAMODE_FLAGS_MORE_DATA);
+			k_mutex_unlock(&mutex_mode);
+			continue;
+		}
+
 		ret = ring_buf_put(&data_rb, buf + index, len - index);
 		if (ret) {
 			index += ret;
@@ -220,57 +240,27 @@ K_TIMER_DEFINE(inactivity_timer, inactivity_timer_handler, NULL);
 /* Search for quit_str and send data prior to that. Tracks quit_str over several calls. */
 static size_t raw_rx_handler(const uint8_t *buf, const size_t len)
 {
-	const char *const quit_str = CONFIG_SLM_DATAMODE_TERMINATOR;
-	size_t processed;
-	bool quit_str_match = false;
-	bool prev_quit_str_match = false;
-	uint8_t quit_str_match_count;
-	uint8_t prev_quit_str_match_count;
+	struct slm_quit_str_scan scan;
 
 	k_mutex_lock(&mutex_data, K_FOREVER);
 
-	/* Initialize from previous time.*/
-	prev_quit_str_match_count = quit_str_partial_match;
-	quit_str_match_count = prev_quit_str_match_count;
-	if (prev_quit_str_match_count != 0) {
-		prev_quit_str_match = true;
-	}
+	slm_quit_str_scan(CONFIG_SLM_DATAMODE_TERMINATOR, QUIT_STR_LEN, &quit_str_partial_match,
+			  buf, len, &scan);
 
-	/* Find quit_str or partial match at the end of the buffer. */
-	for (processed = 0; processed < len && quit_str_match == false; processed++) {
-		if (buf[processed] == quit_str[quit_str_match_count]) {
-			quit_str_match_count++;
-			if (quit_str_match_count == strlen(quit_str)) {
-				quit_str_match = true;
-			}
-		} else {
-			/* No match. Possible previous partial quit_str match is data. */
-			quit_str_match_count = 0;
-			prev_quit_str_match = false;
-		}
-	}
-
-	if (prev_quit_str_match == false) {
-		/* Write data which was previously interpreted as a possible partial quit_str. */
-		write_data_buf(quit_str, prev_quit_str_match_count);
+	/* Write data which was previously interpreted as a possible partial quit_str. */
+	write_data_buf(CONFIG_SLM_DATAMODE_TERMINATOR, scan.carried_data);
 
-		/* Write data from buf until the start of the possible (partial) quit_str. */
-		write_data_buf(buf, processed - quit_str_match_count);
-	} else {
-		/* Nothing to write this round.*/
-	}
+	/* Write data from buf until the start of the possible (partial) quit_str. */
+	write_data_buf(buf, scan.data_len);
 
-	if (quit_str_match) {
+	if (scan.match) {
 		raw_send(SLM_DATAMODE_FLAGS_NONE);
 		(void)exit_datamode();
-		quit_str_partial_match = 0;
-	} else {
-		quit_str_partial_match = quit_str_match_count;
 	}
 
 	k_mutex_unlock(&mutex_data);
 
-	return processed;
+	return scan.processed;
 }
 
 /*
@@ -644,40 +634,28 @@ static size_t cmd_rx_handler(const uint8_t *buf, const size_t len)
 /* Search for quit_str and exit datamode when one is found. */
 static size_t null_handler(const uint8_t *buf, const size_t len)
 {
-	const char *const quit_str = CONFIG_SLM_DATAMODE_TERMINATOR;
 	static size_t dropped_count;
-	static uint8_t match_count;
-
-	size_t processed;
-	bool match = false;
+	static size_t match_count;
+	struct slm_quit_str_scan scan;
 
 	if (dropped_count == 0) {
 		LOG_WRN("Data pipe broken. Dropping data until datamode is terminated.");
 	}
 
-	for (processed = 0; processed < len && match == false; processed++) {
-		if (buf[processed] == quit_str[match_count]) {
-			match_count++;
-			if (match_count == strlen(quit_str)) {
-				match = true;
-			}
-		} else {
-			match_count = 0;
-		}
-		dropped_count++;
-	}
+	slm_quit_str_scan(CONFIG_SLM_DATAMODE_TERMINATOR, QUIT_STR_LEN, &match_count, buf, len,
+			  &scan);
+	dropped_count += scan.processed;
 
-	if (match) {
-		dropped_count -= strlen(quit_str);
+	if (scan.match) {
+		dropped_count -= QUIT_STR_LEN;
 		dropped_count += ring_buf_size_get(&data_rb);
 		LOG_WRN("Terminating datamode, %d dropped", dropped_count);
 		(void)exit_datamode();
 
-		match_count = 0;
 		dropped_count = 0;
 	}
 
-	return processed;
+	return scan.processed;
 }
 
 void slm_at_receive(const uint8_t *buf, size_t len)
@@ -36,12 +36,11 @@ static const struct device *ppp_uart_dev = DEVICE_DT_GET(DT_CHOSEN(ncs_slm_ppp_u
 #endif
 static struct net_if *ppp_iface;
 
-static uint8_t ppp_data_buf[1500];
+#define PPP_DATA_BUF_SIZE 1500
+
 static struct sockaddr_ll ppp_zephyr_dst_addr;
 
-static struct k_thread ppp_data_passing_thread_id;
-static K_THREAD_STACK_DEFINE(ppp_data_passing_thread_stack, KB(2));
-static void ppp_data_passing_thread(void*, void*, void*);
+static void ppp_forward_thread(void*, void*, void*);
 
 static void ppp_controller(struct k_work *work);
 enum ppp_action {
@@ -77,7 +76,7 @@ enum ppp_states {
 static atomic_t ppp_state;
 
 MODEM_PPP_DEFINE(ppp_module, NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
-		 sizeof(ppp_data_buf), sizeof(ppp_data_buf));
+		 PPP_DATA_BUF_SIZE, PPP_DATA_BUF_SIZE);
 
 static struct modem_pipe *ppp_pipe;
 
@@ -95,6 +94,31 @@ const char *const ppp_socket_names[PPP_FDS_COUNT] = {
 };
 static int ppp_fds[PPP_FDS_COUNT] = { -1, -1 };
 
+/* Data is forwarded in each direction by its own thread with its own buffer,
+ * so that uplink and downlink traffic do not wait for each other.
+ */
+enum {
+	UPLINK_IDX, /* From the PPP link to the LTE link. */
+	DOWNLINK_IDX, /* From the LTE link to the PPP link. */
+	PPP_FORWARDERS_COUNT
+};
+static struct ppp_forwarder {
+	const char *name;
+	size_t src;
+	size_t dst;
+	struct k_thread thread;
+	struct {
+		uint32_t packets;
+		uint32_t bytes;
+		uint32_t dropped;
+	} stats;
+	uint8_t buf[PPP_DATA_BUF_SIZE];
+} ppp_forwarders[PPP_FORWARDERS_COUNT] = {
+	[UPLINK_IDX] = { .name = "uplink", .src = ZEPHYR_FD_IDX, .dst = MODEM_FD_IDX },
+	[DOWNLINK_IDX] = { .name = "downlink", .src = MODEM_FD_IDX, .dst = ZEPHYR_FD_IDX },
+};
+static K_THREAD_STACK_ARRAY_DEFINE(ppp_forward_thread_stacks, PPP_FORWARDERS_COUNT, KB(2));
+
 static bool open_ppp_sockets(void)
 {
 	int ret;
@@ -218,11 +242,11 @@ static int ppp_start_internal(void)
 
 	if (mtu) {
 		/* Set the PPP MTU to that of the LTE link. */
-		mtu = MIN(mtu, sizeof(ppp_data_buf));
+		mtu = MIN(mtu, PPP_DATA_BUF_SIZE);
 	} else {
 		LOG_DBG("Could not retrieve MTU, using fallback value.");
 		mtu = CONFIG_SLM_PPP_FALLBACK_MTU;
-		BUILD_ASSERT(sizeof(ppp_data_buf) >= CONFIG_SLM_PPP_FALLBACK_MTU);
+		BUILD_ASSERT(PPP_DATA_BUF_SIZE >= CONFIG_SLM_PPP_FALLBACK_MTU);
 	}
 
 	net_if_set_mtu(ppp_iface, mtu);
@@ -257,11 +281,16 @@ static int ppp_start_internal(void)
 
 	LOG_INF("PPP started.");
 
-	k_thread_create(&ppp_data_passing_thread_id, ppp_data_passing_thread_stack,
-			K_THREAD_STACK_SIZEOF(ppp_data_passing_thread_stack),
-			ppp_data_passing_thread, NULL, NULL, NULL,
-			K_PRIO_COOP(10), 0, K_NO_WAIT);
-	k_thread_name_set(&ppp_data_passing_thread_id, "ppp_data_passing");
+	for (size_t i = 0; i != ARRAY_SIZE(ppp_forwarders); ++i) {
+		struct ppp_forwarder *const fwd = &ppp_forwarders[i];
+
+		memset(&fwd->stats, 0, sizeof(fwd->stats));
+		k_thread_create(&fwd->thread, ppp_forward_thread_stacks[i],
+				K_THREAD_STACK_SIZEOF(ppp_forward_thread_stacks[i]),
+				ppp_forward_thread, fwd, NULL, NULL,
+				K_PRIO_COOP(10), 0, K_NO_WAIT);
+		k_thread_name_set(&fwd->thread, fwd->name);
+	}
 
 	return 0;
 }
@@ -310,7 +339,15 @@ static void ppp_stop_internal(void)
 
 	close_ppp_sockets();
 
-	k_thread_join(&ppp_data_passing_thread_id, K_SECONDS(1));
+	for (size_t i = 0; i != ARRAY_SIZE(ppp_forwarders); ++i) {
+		struct ppp_forwarder *const fwd = &ppp_forwarders[i];
+
+		/* This is a no-op for the thread that is stopping PPP itself. */
+		k_thread_join(&fwd->thread, K_SECONDS(1));
+
+		LOG_INF("PPP %s: %u packets, %u bytes forwarded, %u packets dropped.",
+			fwd->name, fwd->stats.packets, fwd->stats.bytes, fwd->stats.dropped);
+	}
 
 	LOG_INF("PPP stopped.");
 }
@@ -486,8 +523,8 @@ int slm_ppp_init(void)
 
 	{
 		static struct modem_backend_uart ppp_uart_backend;
-		static uint8_t ppp_uart_backend_receive_buf[sizeof(ppp_data_buf)];
-		static uint8_t ppp_uart_backend_transmit_buf[sizeof(ppp_data_buf)];
+		static uint8_t ppp_uart_backend_receive_buf[PPP_DATA_BUF_SIZE];
+		static uint8_t ppp_uart_backend_transmit_buf[PPP_DATA_BUF_SIZE];
 
 		const struct modem_backend_uart_config uart_backend_config = {
 			.uart = ppp_uart_dev,
@@ -559,15 +596,16 @@ static int handle_at_ppp(enum at_parser_cmd_type cmd_type, struct at_parser *par
 	return -SILENT_AT_COMMAND_RET;
 }
 
-static void ppp_data_passing_thread(void*, void*, void*)
+static void ppp_forward_thread(void *fwd_ptr, void*, void*)
 {
+	struct ppp_forwarder *const fwd = fwd_ptr;
 	const size_t mtu = net_if_get_mtu(ppp_iface);
-	struct pollfd fds[PPP_FDS_COUNT];
-
-	for (size_t i = 0; i != ARRAY_SIZE(fds); ++i) {
-		fds[i].fd = ppp_fds[i];
-		fds[i].events = POLLIN;
-	}
+	const int dst_fd = ppp_fds[fwd->dst];
+	void *dst_addr = (fwd->dst == MODEM_FD_IDX) ? NULL : &ppp_zephyr_dst_addr;
+	socklen_t addrlen = (fwd->dst == MODEM_FD_IDX) ? 0 : sizeof(ppp_zephyr_dst_addr);
+	struct pollfd fds[1] = {
+		{ .fd = ppp_fds[fwd->src], .events = POLLIN }
+	};
 
 	while (true) {
 		const int poll_ret = poll(fds, ARRAY_SIZE(fds), -1);
@@ -578,47 +616,46 @@ static void ppp_data_passing_thread(void*, void*, void*)
 			return;
 		}
 
-		for (size_t src = 0; src != ARRAY_SIZE(fds); ++src) {
-			const short revents = fds[src].revents;
+		const short revents = fds[0].revents;
 
-			if (!revents) {
-				continue;
-			}
-			if (!(revents & POLLIN)) {
-				/* POLLERR/POLLNVAL happen when the sockets are closed
-				 * or when the connection goes down.
-				 */
-				if ((revents ^ POLLERR) && (revents ^ POLLNVAL)) {
-					LOG_WRN("Unexpected event 0x%x on %s socket.",
-						revents, ppp_socket_names[src]);
-				}
-				ppp_stop();
-				return;
+		if (!(revents & POLLIN)) {
+			/* POLLERR/POLLNVAL happen when the sockets are closed
+			 * or when the connection goes down.
+			 */
+			if ((revents ^ POLLERR) && (revents ^ POLLNVAL)) {
+				LOG_WRN("Unexpected event 0x%x on %s socket.",
+					revents, ppp_socket_names[fwd->src]);
 			}
-			const ssize_t len = recv(fds[src].fd, ppp_data_buf, mtu, MSG_DONTWAIT);
+			ppp_stop();
+			return;
+		}
+
+		/* Forward the packets that are already queued before polling again. */
+		for (unsigned int i = 0; i != CONFIG_SLM_PPP_FORWARD_BATCH_SIZE; ++i) {
+			const ssize_t len = recv(fds[0].fd, fwd->buf, mtu, MSG_DONTWAIT);
 
 			if (len <= 0) {
 				if (len != -1 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
 					LOG_ERR("Failed to receive data from %s socket (%d, %d).",
-						ppp_socket_names[src], len, errno);
+						ppp_socket_names[fwd->src], len, errno);
 				}
-				continue;
+				break;
 			}
-			ssize_t send_ret;
-			const size_t dst = (src == ZEPHYR_FD_IDX) ? MODEM_FD_IDX : ZEPHYR_FD_IDX;
-			void *dst_addr = (dst == MODEM_FD_IDX) ? NULL : &ppp_zephyr_dst_addr;
-			socklen_t addrlen = (dst == MODEM_FD_IDX) ? 0 : sizeof(ppp_zephyr_dst_addr);
+			const ssize_t send_ret = sendto(dst_fd, fwd->buf, len, 0, dst_addr, addrlen);
 
-			send_ret = sendto(fds[dst].fd, ppp_data_buf, len, 0, dst_addr, addrlen);
 			if (send_ret == -1) {
 				LOG_ERR("Failed to send %zd bytes to %s socket (%d).",
-					len, ppp_socket_names[dst], errno);
+					len, ppp_socket_names[fwd->dst], errno);
+				fwd->stats.dropped++;
 			} else if (send_ret != len) {
 				LOG_ERR("Only sent %zd out of %zd bytes to %s socket.",
-					send_ret, len, ppp_socket_names[dst]);
+					send_ret, len, ppp_socket_names[fwd->dst]);
+				fwd->stats.dropped++;
 			} else {
 				LOG_DBG("Forwarded %zd bytes to %s socket.",
-					send_ret, ppp_socket_names[dst]);
+					send_ret, ppp_socket_names[fwd->dst]);
+				fwd->stats.packets++;
+				fwd->stats.bytes += send_ret;
 			}
 		}
 	}
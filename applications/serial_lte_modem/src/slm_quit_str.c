@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include "slm_quit_str.h"
+
+/* Find the first complete quit_str in buf, or a partial one at the end of buf.
+ * Returns the offset of the match and its length in match_len, which is 0 if nothing was found.
+ */
+static size_t quit_str_find(const char *quit_str, size_t quit_str_len,
+			    const uint8_t *buf, size_t len, size_t *match_len)
+{
+	const uint8_t *const end = buf + len;
+	const uint8_t *p = buf;
+
+	/* memchr() skips over the data a word at a time, so only the positions
+	 * starting with the first character of quit_str are compared byte by byte.
+	 */
+	while ((p = memchr(p, quit_str[0], end - p)) != NULL) {
+		const size_t cmp_len = MIN(quit_str_len, end - p);
+
+		if (memcmp(p, quit_str, cmp_len) == 0) {
+			*match_len = cmp_len;
+			return p - buf;
+		}
+		p++;
+	}
+
+	*match_len = 0;
+	return len;
+}
+
+void slm_quit_str_scan(const char *quit_str, size_t quit_str_len, size_t *partial,
+		       const uint8_t *buf, size_t len, struct slm_quit_str_scan *scan)
+{
+	const size_t matched = *partial;
+	size_t match_len;
+
+	*scan = (struct slm_quit_str_scan){ 0 };
+
+	/* Continue the partial match from the previous call. If buf does not continue it,
+	 * quit_str may still start later within the carried bytes, e.g. "aa" of "aab"
+	 * followed by "ab".
+	 */
+	for (size_t shift = 0; shift < matched; shift++) {
+		const size_t carried = matched - shift;
+		const size_t cmp_len = MIN(quit_str_len - carried, len);
+
+		if (memcmp(quit_str + shift, quit_str, carried) == 0 &&
+		    memcmp(buf, quit_str + carried, cmp_len) == 0) {
+			scan->carried_data = shift;
+			scan->processed = cmp_len;
+			scan->match = (carried + cmp_len == quit_str_len);
+			*partial = scan->match ? 0 : carried + cmp_len;
+			return;
+		}
+	}
+	scan->carried_data = matched;
+
+	scan->data_len = quit_str_find(quit_str, quit_str_len, buf, len, &match_len);
+	scan->processed = scan->data_len + match_len;
+	scan->match = (match_len == quit_str_len);
+	*partial = scan->match ? 0 : match_len;
+}
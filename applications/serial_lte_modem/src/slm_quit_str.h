@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SLM_QUIT_STR_
+#define SLM_QUIT_STR_
+
+/**@file slm_quit_str.h
+ *
+ * @brief Data mode terminator search for serial LTE modem
+ * @{
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Result of a data mode terminator search. */
+struct slm_quit_str_scan {
+	/** Bytes of the previous partial terminator match that turned out to be data. */
+	size_t carried_data;
+	/** Bytes at the start of the scanned buffer that are data. */
+	size_t data_len;
+	/** Bytes of the scanned buffer that were consumed. */
+	size_t processed;
+	/** Complete terminator was found. */
+	bool match;
+};
+
+/**
+ * @brief Search for the data mode terminator in received data.
+ *
+ * A terminator split over several buffers is tracked in @p partial between the calls.
+ * The data ends at the first complete terminator, bytes after it are not processed.
+ *
+ * @param[in] quit_str Terminator.
+ * @param[in] quit_str_len Length of the terminator, must be greater than zero.
+ * @param[in,out] partial Length of the partial terminator match at the end of the previous
+ *                        buffer. Must be zero for the first call.
+ * @param[in] buf Received data.
+ * @param[in] len Length of the received data.
+ * @param[out] scan Result of the search.
+ */
+void slm_quit_str_scan(const char *quit_str, size_t quit_str_len, size_t *partial,
+		       const uint8_t *buf, size_t len, struct slm_quit_str_scan *scan);
+
+/** @} */
+#endif /* SLM_QUIT_STR_ */
@@ -55,6 +55,11 @@ enum app_event_type_flags {
 	 */
 	APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE =
 		APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
+	/** places events in the high priority queue.
+	 *  Flag set by user. It is ignored unless
+	 *  @kconfig{CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_QUEUE} is enabled.
+	 */
+	APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY,
 	/** shows number of predefined flags.*/
 	APP_EVENT_TYPE_FLAGS_COUNT,
 	/** marks beginning of user-specific flags.*/
@@ -403,6 +408,58 @@ void *app_event_manager_alloc(size_t size);
 void app_event_manager_free(void *addr);
 
 
+/** @brief Event memory slab statistics.
+ */
+struct app_event_manager_slab_stats {
+	/** Size of a single slab block (in bytes). */
+	size_t block_size;
+
+	/** Number of blocks in the slab. */
+	uint32_t num_blocks;
+
+	/** Number of blocks currently in use. */
+	uint32_t num_used;
+
+	/** Maximum number of blocks that were in use at the same time. */
+	uint32_t max_used;
+
+	/** Number of events that were allocated using @ref app_event_manager_alloc,
+	 *  because the slab was exhausted.
+	 */
+	uint32_t fallback_cnt;
+};
+
+/** @brief Free event memory allocated from the memory slab of the event type.
+ *
+ * The default implementation of @ref app_event_manager_free calls this function.
+ * Custom implementations of @ref app_event_manager_free must call it as well and
+ * skip releasing the memory if it returns true.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_SLAB} option needs to be enabled.
+ *
+ * @param addr  Pointer to the event.
+ * @retval true If the event was allocated from the memory slab and is now released.
+ * @retval false If the event was not allocated from the memory slab.
+ */
+bool app_event_manager_slab_free(void *addr);
+
+/** @brief Get memory slab statistics of the event type.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_SLAB} option needs to be enabled.
+ *
+ * @param et     Pointer to the event type.
+ * @param stats  Pointer to the structure to be filled with the statistics.
+ * @retval 0 If the operation was successful.
+ * @retval -ENOENT If the event type has no memory slab.
+ */
+int app_event_manager_slab_stats_get(const struct event_type *et,
+				     struct app_event_manager_slab_stats *stats);
+
+
 /** @brief Log event.
  *
  * This helper macro simplifies event logging.
@@ -221,6 +221,11 @@ struct audio_module_description {
 
 	/* A pointer to the functions in the module. */
 	const struct audio_module_functions *functions;
+
+	/* Flag to indicate that data_process can write the output audio data into the buffer of
+	 * the input audio data, so a fused module can process the audio data in place.
+	 */
+	bool data_in_place;
 };
 
 /**
@@ -249,6 +254,13 @@ struct audio_module_thread_configuration {
 	 * taken from the audio data buffer slab. The size can be 0.
 	 */
 	size_t data_size;
+
+	/* Flag to run the module in the thread of the module, or the caller, that sends it audio
+	 * data instead of in a thread of its own. The stack, priority and RX FIFO are then not
+	 * used. Only output and in/out modules can be fused. If several modules, or threads,
+	 * send audio data to a fused module, they process it one at a time.
+	 */
+	bool fused;
 };
 
 /**
@@ -299,6 +311,9 @@ struct audio_module_handle {
 	/* Mutex to make the above destinations list thread safe. */
 	struct k_mutex dest_mutex;
 
+	/* Mutex to serialize the data processing of a fused module with several senders. */
+	struct k_mutex fused_mutex;
+
 	/* Module's thread configuration. */
 	struct audio_module_thread_configuration thread;
 
@@ -426,6 +441,9 @@ int audio_module_stop(struct audio_module_handle *handle);
  *        pointer, can be NULL and/or 0. It is the responsibility of the low level module functions
  *        to handle this correctly.
  *
+ * @note: If the module is fused, the audio data is processed by the module, and by the fused
+ *        modules connected to it, in the calling thread before the function returns.
+ *
  * @param handle       [in/out]  The handle for the receiving module instance.
  * @param audio_data   [in]      Pointer to the audio data to send to the module.
  * @param response_cb  [in]      Pointer to a callback to run when the buffer is
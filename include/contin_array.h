@@ -40,6 +40,30 @@
 int contin_array_create(void *pcm_cont, uint32_t pcm_cont_size, void const *const pcm_finite,
 			uint32_t pcm_finite_size, uint32_t *const finite_pos);
 
+/** @brief Creates a continuous array of PCM samples from a finite array.
+ *
+ * @details Same as @ref contin_array_create, but the sizes and the position are
+ * checked to be whole samples, so that a sample is never split when the finite
+ * array wraps around.
+ *
+ * @param pcm_cont		Pointer to the destination array.
+ * @param pcm_cont_size		Size of pcm_cont in bytes.
+ * @param pcm_finite		Pointer to an array of samples.
+ * @param pcm_finite_size	Size of pcm_finite in bytes.
+ * @param finite_pos		Variable used internally. Must be set
+ *				to 0 for the first run and not changed.
+ * @param pcm_bit_depth		Bit depth of PCM samples (16, 24, or 32).
+ *
+ * @retval 0		If the operation was successful.
+ * @retval -EPERM	If any sizes are zero.
+ * @retval -ENXIO	On NULL pointer.
+ * @retval -EINVAL	If the bit depth is invalid, or a size or the position is
+ *			not a multiple of the sample size.
+ */
+int contin_array_pcm_create(void *pcm_cont, uint32_t pcm_cont_size, void const *const pcm_finite,
+			    uint32_t pcm_finite_size, uint32_t *const finite_pos,
+			    uint8_t pcm_bit_depth);
+
 /**
  * @}
  */
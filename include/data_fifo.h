@@ -39,6 +39,20 @@ struct data_fifo {
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	/* Single-producer single-consumer ring used instead of the slab and message queue.
+	 * The indices run from 0 to 2 * elements_max - 1, so a full ring can be told apart
+	 * from an empty one.
+	 */
+	bool spsc;
+	atomic_t spsc_alloced;
+	atomic_t spsc_locked;
+	atomic_t spsc_read;
+	atomic_t spsc_freed;
+	atomic_t spsc_waiting;
+	struct k_sem spsc_vacant_sem;
+	struct k_sem spsc_filled_sem;
+#endif
 };
 
 #define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
@@ -52,6 +66,26 @@ struct data_fifo {
 				 .elements_max = elements_max_in,                                  \
 				 .initialized = false}
 
+/**
+ * @brief Define a data_fifo for one producer and one consumer.
+ *
+ * The FIFO does not take any kernel lock unless a call has to wait. It can be used from
+ * interrupts with K_NO_WAIT, as long as there is only one producer context and one consumer
+ * context. Blocks must be locked in the order they were taken, and freed in the order they
+ * were read. Requires CONFIG_DATA_FIFO_SPSC.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	char __aligned(WB_UP(                                                                      \
+		1)) _msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = {0};  \
+	char __aligned(WB_UP(1)) _slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {  \
+		0};                                                                                \
+	struct data_fifo name = {.msgq_buffer = _msgq_buffer_##name,                               \
+				 .slab_buffer = _slab_buffer_##name,                               \
+				 .block_size_max = block_size_max_in,                              \
+				 .elements_max = elements_max_in,                                  \
+				 .initialized = false,                                             \
+				 .spsc = true}
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -117,6 +117,51 @@ static inline void at_monitor_resume(struct at_monitor_entry *mon)
 	mon->flags.paused = false;
 }
 
+/**
+ * @brief Statistics of the store of notifications dispatched in the system workqueue.
+ */
+struct at_monitor_stats {
+	/** Size of the store, in bytes. */
+	size_t size;
+	/** Number of bytes in use. */
+	size_t used;
+	/** Peak number of bytes in use. */
+	size_t peak;
+	/** Number of notifications dropped because the store was full. */
+	uint32_t drops;
+};
+
+/**
+ * @brief Retain a notification after the monitor callback returns.
+ *
+ * By default, the notification passed to a monitor callback is only valid until the callback
+ * returns. A monitor defined with @ref AT_MONITOR can retain it to process it later without
+ * copying it, and must release it with @ref at_monitor_notif_release when done.
+ *
+ * Notifications are stored in order of arrival, and the space of a notification is only reused
+ * once all the notifications received before it are released. Release retained notifications as
+ * soon as possible to avoid dropping incoming notifications.
+ *
+ * @note Notifications passed to monitors defined with @ref AT_MONITOR_ISR cannot be retained.
+ *
+ * @param notif The AT notification passed to the monitor callback.
+ */
+void at_monitor_notif_retain(const char *notif);
+
+/**
+ * @brief Release a notification retained with @ref at_monitor_notif_retain.
+ *
+ * @param notif The AT notification.
+ */
+void at_monitor_notif_release(const char *notif);
+
+/**
+ * @brief Get the statistics of the notification store.
+ *
+ * @param stats The statistics.
+ */
+void at_monitor_stats_get(struct at_monitor_stats *stats);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -36,6 +36,20 @@ enum at_parser_cmd_type {
 	AT_PARSER_CMD_TYPE_TEST
 };
 
+/**
+ * @brief Token of an AT command line, cached by @ref at_parser_tokenize.
+ *
+ * The members are internal to the AT parser.
+ */
+struct at_parser_token {
+	/* Offset of the token from the start of the AT command line. */
+	uint16_t offset;
+	/* Length of the token. */
+	uint16_t len;
+	/* Type of the token. */
+	uint8_t type;
+};
+
 /**
  * @brief AT parser
  *
@@ -53,6 +67,16 @@ struct at_parser {
 	bool is_next_empty;
 	/* Sentinel value for determining initialization state. */
 	uint32_t init_sentinel;
+	/* Tokens of the current AT command line, or NULL if the line is not tokenized. */
+	struct at_parser_token *tokens;
+	/* Number of entries in the tokens array. */
+	size_t tokens_size;
+	/* Number of tokens cached for the current AT command line. */
+	size_t tokens_count;
+	/* Error that terminates the current AT command line, or zero if the line did not fit in
+	 * the tokens array.
+	 */
+	int tokens_err;
 };
 
 /**
@@ -98,6 +122,28 @@ struct at_parser {
  */
 int at_parser_init(struct at_parser *parser, const char *at);
 
+/**
+ * @brief Tokenize the current AT command line once, for random access to its values.
+ *
+ * The position and type of every value in the current AT command line are stored in
+ * @p tokens, so that the values can be read in any order without parsing the line again.
+ * The following AT command lines are tokenized when the parser moves to them with
+ * @ref at_parser_cmd_next.
+ *
+ * Values with an index that does not fit in @p tokens are still parsed from the AT command
+ * string, as if the line was not tokenized.
+ *
+ * @param[in] parser A pointer to the AT parser.
+ * @param[in] tokens Array where to store the tokens. It must be valid while @p parser is used.
+ * @param[in] size   Number of entries in @p tokens.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ * @retval -EPERM  @p parser has not been initialized.
+ */
+int at_parser_tokenize(struct at_parser *parser, struct at_parser_token *tokens, size_t size);
+
 /**
  * @brief Move the cursor of an AT parser to the next command line of its configured AT command
  *        string.
@@ -103,6 +103,24 @@ int nrf_modem_lib_trace_read(uint8_t *buf, size_t len);
  */
 int nrf_modem_lib_trace_clear(void);
 
+/**
+ * @brief Skip trace data captured before the given time
+ *
+ * Discard stored trace data that was captured before @p start_ms, so that subsequent calls to
+ * @ref nrf_modem_lib_trace_read return traces from that time onwards. Trace data is discarded
+ * in blocks of backend storage, so some trace data captured shortly before @p start_ms may
+ * still be returned.
+ *
+ * @note This operation is only supported with some trace backends. If not supported, the function
+ *       returns -ENOTSUP.
+ *
+ * @param start_ms Uptime in milliseconds, as returned by k_uptime_get(), of the oldest trace data
+ *                 to keep.
+ *
+ * @return 0 on success, negative errno on failure.
+ */
+int nrf_modem_lib_trace_seek(int64_t start_ms);
+
 #if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE) || defined(__DOXYGEN__)
 /** @brief Get the last measured rolling average bitrate of the trace backend.
  *
@@ -7,6 +7,8 @@
 #ifndef TRACE_BACKEND_H__
 #define TRACE_BACKEND_H__
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -125,6 +127,20 @@ struct nrf_modem_lib_trace_backend {
 	 * @return 0 on success, negative errno on failure.
 	 */
 	int (*resume)(void);
+
+	/**
+	 * @brief Skip trace data captured before the given time.
+	 *
+	 * Discard stored trace data that was captured before @p start_ms so that subsequent
+	 * reads start from that time.
+	 *
+	 * @note Set to @c NULL if this operation is not supported by the trace backend.
+	 *
+	 * @param start_ms Uptime in milliseconds of the oldest trace data to keep.
+	 *
+	 * @return 0 on success, negative errno on failure.
+	 */
+	int (*seek)(int64_t start_ms);
 };
 
 /**@} */ /* defgroup trace_backend */
@@ -146,6 +146,29 @@ struct download_client_cfg {
 typedef int (*download_client_callback_t)(
 	const struct download_client_evt *event);
 
+#if CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE > 1
+/** Size of a CoAP response that is kept until the blocks before it are received. */
+#define DOWNLOAD_CLIENT_COAP_SLOT_SIZE ((16 << CONFIG_DOWNLOAD_CLIENT_COAP_BLOCK_SIZE) + 32)
+
+/**
+ * @brief Request for a CoAP block in the window.
+ */
+struct download_client_coap_slot {
+	/** Request retransmission state. */
+	struct coap_pending pending;
+	/** Block number. */
+	uint32_t num;
+	/** CoAP message ID of the request. */
+	uint16_t id;
+	/** Whether the request has not been sent, is sent, or has its response. */
+	uint8_t state;
+	/** Length of the response. */
+	uint16_t len;
+	/** Response received before the blocks before it. */
+	uint8_t buf[DOWNLOAD_CLIENT_COAP_SLOT_SIZE];
+};
+#endif
+
 /**
  * @brief Download client instance.
  */
@@ -192,6 +215,14 @@ struct download_client {
 		bool connection_close;
 		/** Is using ranged query. */
 		bool ranged;
+		/** Number of range requests sent without a complete response. */
+		uint8_t pending;
+		/** Offset of the first byte that has not been requested. */
+		size_t requested;
+		/** Number of bytes left in the body of the current response. */
+		size_t body_left;
+		/** Number of bytes of the next responses after the fragment in the buffer. */
+		size_t excess;
 	} http;
 
 	struct {
@@ -200,6 +231,13 @@ struct download_client {
 
 		/** CoAP pending object. */
 		struct coap_pending pending;
+
+#if CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE > 1
+		/** Requests for the current block and the next ones,
+		 *  indexed by block number modulo the window size.
+		 */
+		struct download_client_coap_slot window[CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE];
+#endif
 	} coap;
 
 	/** Internal thread ID. */
@@ -21,6 +21,12 @@
  * @{
  */
 
+/** Number of fractional bits of the gain used by @ref pcm_mix_ext. */
+#define PCM_MIX_GAIN_FRAC_BITS 15
+
+/** Gain of 1.0, i.e. buffer B is mixed in without scaling. */
+#define PCM_MIX_GAIN_UNITY BIT(PCM_MIX_GAIN_FRAC_BITS)
+
 enum pcm_mix_mode {
 	B_STEREO_INTO_A_STEREO,
 	B_MONO_INTO_A_MONO,
@@ -52,6 +58,36 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Mixes two buffers of PCM data with the given bit depth and gain.
+ *
+ * @note Samples of buffer B are scaled by the gain before they are added to buffer A.
+ * The result is saturated to the range of the bit depth.
+ * Samples are stored in pcm_bit_depth / 8 bytes, as in the other PCM libraries.
+ * That is, 24-bit samples are packed in three little-endian bytes and are not
+ * carried in 32-bit words. The buffer sizes must be whole samples.
+ * The 16-bit mix with unity gain uses SIMD instructions if the CPU supports them.
+ *
+ * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
+ * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
+ * @param pcm_b         [in]     Pointer to the PCM data buffer B.
+ * @param size_b        [in]     Size of the PCM data buffer B (in bytes).
+ * @param mix_mode      [in]     Mixing mode according to pcm_mix_mode.
+ * @param pcm_bit_depth [in]     Bit depth of PCM samples (16, 24, or 32).
+ * @param gain_b        [in]     Gain applied to buffer B, with @ref PCM_MIX_GAIN_FRAC_BITS
+ *                               fractional bits. Use @ref PCM_MIX_GAIN_UNITY to mix
+ *                               without scaling.
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a is NULL, size_a = 0, the bit depth is invalid or a buffer
+ *			size is not a whole number of samples.
+ * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
+ *			or size_a/2 < size_b (for mono to stereo mix).
+ * @retval -ESRCH       Invalid mixing mode.
+ */
+int pcm_mix_ext(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth, uint16_t gain_b);
+
 /**
  * @}
  */
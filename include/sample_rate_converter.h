@@ -170,6 +170,107 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/** Number of filter taps in each phase of the polyphase converter when upsampling. */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS 20
+
+/** Largest ratio between input and output sample rate supported by the polyphase converter. */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_DECIMATION_MAX 4
+
+/**
+ * When downsampling, the filter is stretched to lower the cut-off frequency, which increases the
+ * number of taps in each phase by the conversion ratio.
+ */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS_MAX                                                   \
+	(SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS * SAMPLE_RATE_CONVERTER_POLYPHASE_DECIMATION_MAX)
+
+/** Number of input frames kept between process calls for each channel. */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_HISTORY_SIZE                                               \
+	((SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS_MAX - 1) *                                          \
+	 CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_CHANNELS_MAX)
+
+/** Context for the polyphase sample rate conversion */
+struct sample_rate_converter_poly_ctx {
+	/* Input and output sample rate to be used for the conversion. */
+	uint32_t sample_rate_input;
+	uint32_t sample_rate_output;
+
+	/* Number of interleaved channels in the input and output. */
+	uint8_t channels;
+
+	/* The conversion ratio reduced to its lowest terms. Output sample rate / input sample
+	 * rate = interpolation / decimation.
+	 */
+	uint16_t interpolation;
+	uint16_t decimation;
+
+	/* Number of filter taps in each phase. */
+	uint16_t taps;
+
+	/* Position of the next output frame, given as the index of the newest input frame it
+	 * depends on, relative to the start of the next input, and the filter phase.
+	 */
+	uint32_t frame_index;
+	uint16_t phase;
+
+	/* Filter coefficients for all phases. The coefficients for phase p start at index
+	 * p * taps, and are ordered from the oldest to the newest input frame.
+	 */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t coeffs_15[CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_COEFFS_MAX];
+	q15_t history_15[SAMPLE_RATE_CONVERTER_POLYPHASE_HISTORY_SIZE];
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t coeffs_31[CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_COEFFS_MAX];
+	q31_t history_31[SAMPLE_RATE_CONVERTER_POLYPHASE_HISTORY_SIZE];
+#endif
+};
+
+/**
+ * @brief	Open the polyphase sample rate converter for a new stream.
+ *
+ * @details	Resets the context and calculates the filter coefficients for the conversion.
+ *		The conversion ratio can be any rational number between
+ *		1 / SAMPLE_RATE_CONVERTER_POLYPHASE_DECIMATION_MAX and the number of phases
+ *		that fit in CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_COEFFS_MAX.
+ *
+ * @param[out]	ctx			Pointer to the polyphase conversion context.
+ * @param[in]	sample_rate_input	Sample rate of the input frames.
+ * @param[in]	sample_rate_output	Sample rate of the output frames.
+ * @param[in]	channels		Number of interleaved channels.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters, or the conversion needs more filter coefficients
+ *			than the context can hold.
+ */
+int sample_rate_converter_poly_open(struct sample_rate_converter_poly_ctx *ctx,
+				    uint32_t sample_rate_input, uint32_t sample_rate_output,
+				    uint8_t channels);
+
+/**
+ * @brief	Convert interleaved input frames to the output sample rate.
+ *
+ * @details	Input frames are filtered directly from the input buffer into the output buffer,
+ *		only the last few input frames are kept in the context for the next call. Any
+ *		number of input frames can be given. The number of output frames depends on the
+ *		phase of the conversion, and is at most the number of input frames multiplied by
+ *		the conversion ratio, rounded up.
+ *
+ * @param[in,out]	ctx		Pointer to the polyphase conversion context.
+ * @param[in]		input		Pointer to the interleaved input frames.
+ * @param[in]		input_size	Size of the input in bytes.
+ * @param[out]		output		Array that the interleaved output frames will be written to.
+ * @param[in]		output_size	Size of the output array in bytes.
+ * @param[out]		output_written	Number of bytes written to output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters, or the output array is too small.
+ */
+int sample_rate_converter_poly_process(struct sample_rate_converter_poly_ctx *ctx,
+				       void const *const input, size_t input_size,
+				       void *const output, size_t output_size,
+				       size_t *output_written);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 /**
  * @}
  */
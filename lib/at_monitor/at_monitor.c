@@ -11,21 +11,54 @@
 #include <nrf_modem_at.h>
 #include <modem/at_monitor.h>
 #include <zephyr/toolchain.h>
+#include <zephyr/sys/math_extras.h>
 #include <zephyr/logging/log.h>
 
+#if defined(CONFIG_AT_MONITOR_MATCH_AUTOMATON)
+#include "at_monitor_match.h"
+#endif
+
 LOG_MODULE_REGISTER(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
 
+/* Notifications are stored in order of arrival in a ring buffer, and are freed when they are no
+ * longer referenced. The space of a notification is reused once all the notifications received
+ * before it are freed too.
+ */
 struct at_notif_fifo {
 	void *fifo_reserved;
+	/* Size of the record in the store, including padding */
+	uint16_t size;
+	/* References held by the library and by the monitors that retained the notification */
+	atomic_t refs;
+#if defined(CONFIG_AT_MONITOR_MATCH_AUTOMATON)
+	/* Monitors to dispatch to in the workqueue */
+	struct at_monitor_match_set matches;
+#endif
 	char data[]; /* Null-terminated AT notification string */
 };
 
 static void at_monitor_task(struct k_work *work);
 
 static K_FIFO_DEFINE(at_monitor_fifo);
-static K_HEAP_DEFINE(at_monitor_heap, CONFIG_AT_MONITOR_HEAP_SIZE);
 static K_WORK_DEFINE(at_monitor_work, at_monitor_task);
 
+static uint8_t notif_store[CONFIG_AT_MONITOR_HEAP_SIZE] __aligned(__alignof__(struct at_notif_fifo));
+static struct k_spinlock notif_store_lock;
+
+static struct {
+	/* Offset of the oldest record */
+	size_t tail;
+	/* Offset of the next record */
+	size_t head;
+	/* End of the records at the end of the store, valid when wrapped */
+	size_t wrap_end;
+	/* The newest records are at the start of the store, before the tail */
+	bool wrapped;
+	size_t used;
+	size_t peak;
+	uint32_t drops;
+} store;
+
 static bool is_paused(const struct at_monitor_entry *mon)
 {
 	return mon->flags.paused;
@@ -41,6 +74,170 @@ static bool has_match(const struct at_monitor_entry *mon, const char *notif)
 	return (mon->filter == ANY || strstr(notif, mon->filter));
 }
 
+static struct at_notif_fifo *at_notif_alloc(const char *notif)
+{
+	struct at_notif_fifo *at_notif;
+	size_t sz_needed;
+	size_t offset;
+	k_spinlock_key_t key;
+
+	sz_needed = ROUND_UP(sizeof(struct at_notif_fifo) + strlen(notif) + sizeof(char),
+			     __alignof__(struct at_notif_fifo));
+
+	key = k_spin_lock(&notif_store_lock);
+
+	if (store.used == 0) {
+		/* Start over to have the whole store in one piece */
+		store.head = 0;
+		store.tail = 0;
+		store.wrapped = false;
+	}
+
+	if (!store.wrapped && (sizeof(notif_store) - store.head) >= sz_needed) {
+		offset = store.head;
+	} else if (!store.wrapped && store.tail >= sz_needed) {
+		store.wrap_end = store.head;
+		store.wrapped = true;
+		offset = 0;
+	} else if (store.wrapped && (store.tail - store.head) >= sz_needed) {
+		offset = store.head;
+	} else {
+		store.drops++;
+		k_spin_unlock(&notif_store_lock, key);
+		LOG_WRN("No space for incoming notification: %s", notif);
+		return NULL;
+	}
+
+	store.head = offset + sz_needed;
+	store.used += sz_needed;
+	store.peak = MAX(store.peak, store.used);
+
+	at_notif = (struct at_notif_fifo *)&notif_store[offset];
+	at_notif->size = sz_needed;
+	atomic_set(&at_notif->refs, 1);
+
+	k_spin_unlock(&notif_store_lock, key);
+
+	strcpy(at_notif->data, notif);
+
+	return at_notif;
+}
+
+/* Free the oldest records that are no longer referenced */
+static void at_notif_store_trim(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&notif_store_lock);
+
+	while (store.used > 0) {
+		struct at_notif_fifo *at_notif;
+
+		if (store.wrapped && store.tail == store.wrap_end) {
+			store.tail = 0;
+			store.wrapped = false;
+			continue;
+		}
+
+		at_notif = (struct at_notif_fifo *)&notif_store[store.tail];
+		if (atomic_get(&at_notif->refs) != 0) {
+			break;
+		}
+
+		store.tail += at_notif->size;
+		store.used -= at_notif->size;
+	}
+
+	k_spin_unlock(&notif_store_lock, key);
+}
+
+static struct at_notif_fifo *at_notif_get(const char *notif)
+{
+	__ASSERT((uint8_t *)notif > notif_store &&
+		 (uint8_t *)notif < &notif_store[sizeof(notif_store)],
+		 "Notification %p was not dispatched in the workqueue", notif);
+
+	return CONTAINER_OF(notif, struct at_notif_fifo, data);
+}
+
+static void at_notif_unref(struct at_notif_fifo *at_notif)
+{
+	if (atomic_dec(&at_notif->refs) == 1) {
+		at_notif_store_trim();
+	}
+}
+
+void at_monitor_notif_retain(const char *notif)
+{
+	atomic_inc(&at_notif_get(notif)->refs);
+}
+
+void at_monitor_notif_release(const char *notif)
+{
+	at_notif_unref(at_notif_get(notif));
+}
+
+void at_monitor_stats_get(struct at_monitor_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&notif_store_lock);
+
+	stats->size = sizeof(notif_store);
+	stats->used = store.used;
+	stats->peak = store.peak;
+	stats->drops = store.drops;
+
+	k_spin_unlock(&notif_store_lock, key);
+}
+
+#if defined(CONFIG_AT_MONITOR_MATCH_AUTOMATON)
+/* Match the notification once, dispatch to the direct monitors and
+ * keep the remaining monitors for the workqueue.
+ */
+static void at_monitor_dispatch_matched(const char *notif)
+{
+	bool monitored = false;
+	struct at_notif_fifo *at_notif;
+	struct at_monitor_match_set matches;
+
+	at_monitor_match_find(notif, &matches);
+
+	for (size_t w = 0; w < ARRAY_SIZE(matches.words); w++) {
+		uint32_t word = matches.words[w];
+
+		while (word) {
+			size_t idx = w * 32 + u32_count_trailing_zeros(word);
+			struct at_monitor_entry *e;
+
+			word &= word - 1;
+			STRUCT_SECTION_GET(at_monitor_entry, idx, &e);
+
+			if (is_paused(e)) {
+				at_monitor_match_set_clear(&matches, idx);
+			} else if (is_direct(e)) {
+				LOG_DBG("Dispatching to %p (ISR)", e->handler);
+				e->handler(notif);
+				at_monitor_match_set_clear(&matches, idx);
+			} else {
+				monitored = true;
+			}
+		}
+	}
+
+	if (!monitored) {
+		/* Only copy monitored notifications to save space in the store */
+		return;
+	}
+
+	at_notif = at_notif_alloc(notif);
+	if (!at_notif) {
+		return;
+	}
+
+	at_notif->matches = matches;
+
+	k_fifo_put(&at_monitor_fifo, at_notif);
+	k_work_submit(&at_monitor_work);
+}
+#endif /* CONFIG_AT_MONITOR_MATCH_AUTOMATON */
+
 /* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
  * Keep this function public so that it can be called by tests.
  * This function is called from an ISR.
@@ -49,10 +246,16 @@ void at_monitor_dispatch(const char *notif)
 {
 	bool monitored;
 	struct at_notif_fifo *at_notif;
-	size_t sz_needed;
 
 	__ASSERT_NO_MSG(notif != NULL);
 
+#if defined(CONFIG_AT_MONITOR_MATCH_AUTOMATON)
+	if (at_monitor_match_ready()) {
+		at_monitor_dispatch_matched(notif);
+		return;
+	}
+#endif
+
 	monitored = false;
 	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
 		if (!is_paused(e) && has_match(e, notif)) {
@@ -67,21 +270,15 @@ void at_monitor_dispatch(const char *notif)
 	}
 
 	if (!monitored) {
-		/* Only copy monitored notifications to save heap */
+		/* Only copy monitored notifications to save space in the store */
 		return;
 	}
 
-	sz_needed = sizeof(struct at_notif_fifo) + strlen(notif) + sizeof(char);
-
-	at_notif = k_heap_alloc(&at_monitor_heap, sz_needed, K_NO_WAIT);
+	at_notif = at_notif_alloc(notif);
 	if (!at_notif) {
-		LOG_WRN("No heap space for incoming notification: %s", notif);
-		__ASSERT(at_notif, "No heap space for incoming notification: %s", notif);
 		return;
 	}
 
-	strcpy(at_notif->data, notif);
-
 	k_fifo_put(&at_monitor_fifo, at_notif);
 	k_work_submit(&at_monitor_work);
 }
@@ -93,13 +290,33 @@ static void at_monitor_task(struct k_work *work)
 	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
 		/* Match notification with all monitors */
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
+#if defined(CONFIG_AT_MONITOR_MATCH_AUTOMATON)
+		if (at_monitor_match_ready()) {
+			/* Dispatch to the monitors matched in the ISR */
+			for (size_t idx = 0; idx < CONFIG_AT_MONITOR_MATCH_MONITORS_MAX; idx++) {
+				struct at_monitor_entry *e;
+
+				if (!at_monitor_match_set_test(&at_notif->matches, idx)) {
+					continue;
+				}
+
+				STRUCT_SECTION_GET(at_monitor_entry, idx, &e);
+				if (!is_paused(e)) {
+					LOG_DBG("Dispatching to %p", e->handler);
+					e->handler(at_notif->data);
+				}
+			}
+			at_notif_unref(at_notif);
+			continue;
+		}
+#endif
 		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
 			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
 				LOG_DBG("Dispatching to %p", e->handler);
 				e->handler(at_notif->data);
 			}
 		}
-		k_heap_free(&at_monitor_heap, at_notif);
+		at_notif_unref(at_notif);
 	}
 }
 
@@ -107,6 +324,13 @@ static int at_monitor_sys_init(void)
 {
 	int err;
 
+#if defined(CONFIG_AT_MONITOR_MATCH_AUTOMATON)
+	err = at_monitor_match_init();
+	if (err) {
+		LOG_WRN("Failed to build the match automaton, err %d", err);
+	}
+#endif
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
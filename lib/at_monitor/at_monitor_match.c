@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Aho-Corasick automaton over the filters of all AT monitors.
+ *
+ * The filters are inserted in a trie, where every node is a filter prefix. Each node has a
+ * failure link to the node of its longest proper suffix that is also in the trie, and an
+ * output link to the nearest node on the failure chain that is a whole filter. Scanning the
+ * notification once through the automaton finds every filter that occurs in it, which is
+ * the same result as running strstr() for each filter.
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <modem/at_monitor.h>
+#include <zephyr/logging/log.h>
+
+#include "at_monitor_match.h"
+
+LOG_MODULE_DECLARE(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
+
+#define ROOT	     0
+#define MONITOR_NONE UINT16_MAX
+
+struct match_node {
+	/* First child, or ROOT if none, since the root is never a child */
+	uint16_t child;
+	/* Next child of the same parent, or ROOT if none */
+	uint16_t sibling;
+	/* Node of the longest proper suffix that is also a prefix of a filter */
+	uint16_t fail;
+	/* Nearest node on the failure chain that ends a filter, or ROOT if none */
+	uint16_t output;
+	/* First monitor whose filter ends in this node, or MONITOR_NONE */
+	uint16_t monitor;
+	uint8_t depth;
+	char c;
+};
+
+static struct match_node nodes[CONFIG_AT_MONITOR_MATCH_NODES];
+static uint16_t node_count;
+/* Next monitor with the same filter, or MONITOR_NONE */
+static uint16_t monitor_next[CONFIG_AT_MONITOR_MATCH_MONITORS_MAX];
+/* Monitors that match any notification */
+static struct at_monitor_match_set match_any;
+static bool ready;
+
+static uint16_t child_find(uint16_t node, char c)
+{
+	for (uint16_t n = nodes[node].child; n != ROOT; n = nodes[n].sibling) {
+		if (nodes[n].c == c) {
+			return n;
+		}
+	}
+
+	return ROOT;
+}
+
+static int filter_insert(const char *filter, uint16_t monitor)
+{
+	uint16_t node = ROOT;
+
+	for (const char *c = filter; *c != '\0'; c++) {
+		uint16_t next = child_find(node, *c);
+
+		if (next == ROOT) {
+			if (node_count == ARRAY_SIZE(nodes) || nodes[node].depth == UINT8_MAX) {
+				return -ENOMEM;
+			}
+
+			next = node_count++;
+			nodes[next] = (struct match_node){
+				.sibling = nodes[node].child,
+				.monitor = MONITOR_NONE,
+				.depth = nodes[node].depth + 1,
+				.c = *c,
+			};
+			nodes[node].child = next;
+		}
+
+		node = next;
+	}
+
+	/* Keep the monitors of a filter in section order */
+	uint16_t *last = &nodes[node].monitor;
+
+	while (*last != MONITOR_NONE) {
+		last = &monitor_next[*last];
+	}
+
+	*last = monitor;
+	monitor_next[monitor] = MONITOR_NONE;
+
+	return 0;
+}
+
+/* The failure link of a node only depends on nodes of a lower depth,
+ * so the links are set one depth at a time.
+ */
+static void links_set(void)
+{
+	uint8_t max_depth = 0;
+
+	for (uint16_t n = 0; n < node_count; n++) {
+		max_depth = MAX(max_depth, nodes[n].depth);
+	}
+
+	for (uint8_t depth = 0; depth < max_depth; depth++) {
+		for (uint16_t parent = 0; parent < node_count; parent++) {
+			if (nodes[parent].depth != depth) {
+				continue;
+			}
+
+			for (uint16_t n = nodes[parent].child; n != ROOT; n = nodes[n].sibling) {
+				uint16_t fail = ROOT;
+
+				if (parent != ROOT) {
+					uint16_t f = nodes[parent].fail;
+
+					while ((fail = child_find(f, nodes[n].c)) == ROOT && f != ROOT) {
+						f = nodes[f].fail;
+					}
+				}
+
+				nodes[n].fail = fail;
+				nodes[n].output = (nodes[n].monitor != MONITOR_NONE)
+							  ? n
+							  : nodes[fail].output;
+			}
+		}
+	}
+}
+
+int at_monitor_match_init(void)
+{
+	int err;
+	size_t count;
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
+	if (count > CONFIG_AT_MONITOR_MATCH_MONITORS_MAX) {
+		LOG_WRN("%d AT monitors, CONFIG_AT_MONITOR_MATCH_MONITORS_MAX is %d", count,
+			CONFIG_AT_MONITOR_MATCH_MONITORS_MAX);
+		return -ENOMEM;
+	}
+
+	nodes[ROOT] = (struct match_node){.monitor = MONITOR_NONE};
+	node_count = 1;
+
+	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+		size_t idx = e - TYPE_SECTION_START(at_monitor_entry);
+
+		/* An empty filter matches any notification, same as strstr() */
+		if (e->filter == ANY || e->filter[0] == '\0') {
+			match_any.words[idx / 32] |= BIT(idx % 32);
+			continue;
+		}
+
+		err = filter_insert(e->filter, idx);
+		if (err) {
+			LOG_WRN("Filters need more than %d nodes", CONFIG_AT_MONITOR_MATCH_NODES);
+			return err;
+		}
+	}
+
+	links_set();
+
+	LOG_DBG("Match automaton of %d nodes for %d monitors", node_count, count);
+
+	ready = true;
+
+	return 0;
+}
+
+bool at_monitor_match_ready(void)
+{
+	return ready;
+}
+
+void at_monitor_match_find(const char *notif, struct at_monitor_match_set *set)
+{
+	uint16_t node = ROOT;
+
+	*set = match_any;
+
+	for (const char *c = notif; *c != '\0'; c++) {
+		uint16_t next;
+
+		while ((next = child_find(node, *c)) == ROOT && node != ROOT) {
+			node = nodes[node].fail;
+		}
+
+		node = next;
+
+		for (uint16_t out = nodes[node].output; out != ROOT;
+		     out = nodes[nodes[out].fail].output) {
+			for (uint16_t m = nodes[out].monitor; m != MONITOR_NONE; m = monitor_next[m]) {
+				set->words[m / 32] |= BIT(m % 32);
+			}
+		}
+	}
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef AT_MONITOR_MATCH_H_
+#define AT_MONITOR_MATCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of words in a match set. */
+#define AT_MONITOR_MATCH_SET_WORDS DIV_ROUND_UP(CONFIG_AT_MONITOR_MATCH_MONITORS_MAX, 32)
+
+/**
+ * @brief Set of AT monitors, by their index in the AT monitor section.
+ */
+struct at_monitor_match_set {
+	uint32_t words[AT_MONITOR_MATCH_SET_WORDS];
+};
+
+/**
+ * @brief Build the match automaton from the filters of all AT monitors.
+ *
+ * @retval 0 The automaton was built.
+ * @retval -ENOMEM There are too many monitors, or the filters need too many nodes.
+ */
+int at_monitor_match_init(void);
+
+/**
+ * @brief Check whether the match automaton was built.
+ *
+ * @return true if notifications can be matched with @ref at_monitor_match_find.
+ */
+bool at_monitor_match_ready(void);
+
+/**
+ * @brief Find all AT monitors whose filter matches a notification.
+ *
+ * The paused and direct flags of the monitors are not checked.
+ *
+ * @param notif The AT notification.
+ * @param set The matching monitors.
+ */
+void at_monitor_match_find(const char *notif, struct at_monitor_match_set *set);
+
+static inline bool at_monitor_match_set_test(const struct at_monitor_match_set *set, size_t idx)
+{
+	return set->words[idx / 32] & BIT(idx % 32);
+}
+
+static inline void at_monitor_match_set_clear(struct at_monitor_match_set *set, size_t idx)
+{
+	set->words[idx / 32] &= ~BIT(idx % 32);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT_MONITOR_MATCH_H_ */
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <modem/at_monitor.h>
+
+static int at_monitor_shell_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+	struct at_monitor_stats stats;
+
+	at_monitor_stats_get(&stats);
+
+	shell_print(sh, "Notification store size: %zu bytes", stats.size);
+	shell_print(sh, "In use: %zu bytes", stats.used);
+	shell_print(sh, "Peak usage: %zu bytes", stats.peak);
+	shell_print(sh, "Dropped notifications: %u", stats.drops);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(at_monitor_cmd,
+	SHELL_CMD(stats, NULL,
+		"Show the usage of the notification store and the number of dropped notifications.",
+		at_monitor_shell_stats),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(at_monitor, &at_monitor_cmd, "Commands for the AT monitor library.", NULL);
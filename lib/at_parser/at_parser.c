@@ -240,6 +240,7 @@ static int at_parser_seek(struct at_parser *parser, size_t index, struct at_toke
 		/* Rewind parser. */
 		parser->cursor = parser->at;
 		parser->count = 0;
+		parser->is_next_empty = false;
 	}
 
 	do {
@@ -249,6 +250,75 @@ static int at_parser_seek(struct at_parser *parser, size_t index, struct at_toke
 	return err;
 }
 
+/* Get the token at the given index, from the tokens of the current line if it is tokenized. */
+static int at_parser_token_get(struct at_parser *parser, size_t index, struct at_token *token)
+{
+	const struct at_parser_token *cached;
+
+	if (!parser->tokens) {
+		return at_parser_seek(parser, index, token);
+	}
+
+	if (index >= parser->tokens_count) {
+		/* The whole line is tokenized, so there is no value at this index. */
+		if (parser->tokens_err) {
+			return parser->tokens_err;
+		}
+
+		return at_parser_seek(parser, index, token);
+	}
+
+	cached = &parser->tokens[index];
+
+	token->start = parser->at + cached->offset;
+	token->len = cached->len;
+	token->type = (enum at_token_type)cached->type;
+
+	return 0;
+}
+
+/* Tokenize the current line into the tokens array of the parser. */
+static void at_parser_tokens_fill(struct at_parser *parser)
+{
+	int err;
+	struct at_token token = {0};
+
+	/* Rewind parser. */
+	parser->cursor = parser->at;
+	parser->count = 0;
+	parser->is_next_empty = false;
+
+	parser->tokens_count = 0;
+	parser->tokens_err = 0;
+
+	while (parser->tokens_count < parser->tokens_size) {
+		err = at_parser_tok(parser, &token);
+		if (err) {
+			parser->tokens_err = err;
+			return;
+		}
+
+		size_t offset = token.start - parser->at;
+
+		if (offset > UINT16_MAX || token.len > UINT16_MAX) {
+			/* The remainder of the line is parsed on demand. */
+			return;
+		}
+
+		parser->tokens[parser->tokens_count++] = (struct at_parser_token){
+			.offset = offset,
+			.len = token.len,
+			.type = token.type,
+		};
+	}
+
+	/* Check whether the line ends with the last token that fits in the array. */
+	err = at_parser_tok(parser, &token);
+	if (err) {
+		parser->tokens_err = err;
+	}
+}
+
 int at_parser_init(struct at_parser *parser, const char *at)
 {
 	if (!parser || !at) {
@@ -264,6 +334,27 @@ int at_parser_init(struct at_parser *parser, const char *at)
 	return 0;
 }
 
+int at_parser_tokenize(struct at_parser *parser, struct at_parser_token *tokens, size_t size)
+{
+	int err;
+
+	if (!tokens || size == 0) {
+		return -EINVAL;
+	}
+
+	err = at_parser_check(parser);
+	if (err) {
+		return err;
+	}
+
+	parser->tokens = tokens;
+	parser->tokens_size = size;
+
+	at_parser_tokens_fill(parser);
+
+	return 0;
+}
+
 int at_parser_cmd_next(struct at_parser *parser)
 {
 	int err;
@@ -291,6 +382,10 @@ int at_parser_cmd_next(struct at_parser *parser)
 	 */
 	parser->at = parser->cursor;
 
+	if (parser->tokens) {
+		at_parser_tokens_fill(parser);
+	}
+
 	return 0;
 }
 
@@ -341,6 +436,13 @@ int at_parser_cmd_count_get(struct at_parser *parser, size_t *count)
 		return err;
 	}
 
+	if (parser->tokens && parser->tokens_err) {
+		*count = parser->tokens_count;
+		err = parser->tokens_err;
+
+		return (err == -EIO || err == -EAGAIN) ? 0 : err;
+	}
+
 	do {
 		err = at_parser_tok(parser, &token);
 	} while (!err);
@@ -365,7 +467,7 @@ static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *
 		return err;
 	}
 
-	err = at_parser_seek(parser, index, &token);
+	err = at_parser_token_get(parser, index, &token);
 	if (err) {
 		return err;
 	}
@@ -478,7 +580,7 @@ static int at_parser_string_common_get_impl(struct at_parser *parser, size_t ind
 		return err;
 	}
 
-	err = at_parser_seek(parser, index, &token);
+	err = at_parser_token_get(parser, index, &token);
 	if (err) {
 		return err;
 	}
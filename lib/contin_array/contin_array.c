@@ -15,6 +15,9 @@ LOG_MODULE_REGISTER(contin_array, CONFIG_CONTIN_ARRAY_LOG_LEVEL);
 int contin_array_create(void *const pcm_cont, uint32_t pcm_cont_size, void const *const pcm_finite,
 			uint32_t pcm_finite_size, uint32_t *const finite_pos)
 {
+	uint8_t *cont = pcm_cont;
+	const uint8_t *finite = pcm_finite;
+
 	LOG_DBG("pcm_cont_size: %d pcm_finite_size %d", pcm_cont_size, pcm_finite_size);
 
 	if (pcm_cont == NULL || pcm_finite == NULL) {
@@ -26,13 +29,46 @@ int contin_array_create(void *const pcm_cont, uint32_t pcm_cont_size, void const
 		return -EPERM;
 	}
 
-	for (uint32_t i = 0; i < pcm_cont_size; i++) {
+	/* Copy up to the end of the finite array at a time, so a continuous array that is not
+	 * larger than the finite array takes at most two copies.
+	 */
+	while (pcm_cont_size) {
 		if (*finite_pos > (pcm_finite_size - 1)) {
 			*finite_pos = 0;
 		}
-		((char *)pcm_cont)[i] = ((char *)pcm_finite)[*finite_pos];
-		(*finite_pos)++;
+
+		uint32_t chunk = MIN(pcm_cont_size, pcm_finite_size - *finite_pos);
+
+		memcpy(cont, &finite[*finite_pos], chunk);
+		cont += chunk;
+		pcm_cont_size -= chunk;
+		*finite_pos += chunk;
 	}
 
 	return 0;
 }
+
+int contin_array_pcm_create(void *const pcm_cont, uint32_t pcm_cont_size,
+			    void const *const pcm_finite, uint32_t pcm_finite_size,
+			    uint32_t *const finite_pos, uint8_t pcm_bit_depth)
+{
+	uint8_t bytes_per_sample = pcm_bit_depth / 8;
+
+	if (pcm_bit_depth != 16 && pcm_bit_depth != 24 && pcm_bit_depth != 32) {
+		LOG_ERR("Invalid bit depth: %d", pcm_bit_depth);
+		return -EINVAL;
+	}
+
+	if (finite_pos == NULL) {
+		return -ENXIO;
+	}
+
+	if ((pcm_cont_size % bytes_per_sample) || (pcm_finite_size % bytes_per_sample) ||
+	    (*finite_pos % bytes_per_sample)) {
+		LOG_ERR("Sizes and position must be whole %d-bit samples", pcm_bit_depth);
+		return -EINVAL;
+	}
+
+	return contin_array_create(pcm_cont, pcm_cont_size, pcm_finite, pcm_finite_size,
+				   finite_pos);
+}
@@ -13,19 +13,207 @@ LOG_MODULE_REGISTER(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
 
 static struct k_spinlock lock;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+#define SPSC_WAITING_VACANT BIT(0)
+#define SPSC_WAITING_FILLED BIT(1)
+
+/** @brief Gets the next index in the ring. */
+static atomic_val_t spsc_next(struct data_fifo *data_fifo, atomic_val_t index)
+{
+	return (index + 1) % (2 * data_fifo->elements_max);
+}
+
+/** @brief Gets the number of elements from index tail up to index head. */
+static uint32_t spsc_count(struct data_fifo *data_fifo, atomic_val_t head, atomic_val_t tail)
+{
+	return (head + 2 * data_fifo->elements_max - tail) % (2 * data_fifo->elements_max);
+}
+
+static struct data_fifo_msgq *spsc_slot(struct data_fifo *data_fifo, atomic_val_t index)
+{
+	return &((struct data_fifo_msgq *)data_fifo->msgq_buffer)[index % data_fifo->elements_max];
+}
+
+static bool spsc_vacant(struct data_fifo *data_fifo)
+{
+	return spsc_count(data_fifo, atomic_get(&data_fifo->spsc_alloced),
+			  atomic_get(&data_fifo->spsc_freed)) < data_fifo->elements_max;
+}
+
+static bool spsc_filled(struct data_fifo *data_fifo)
+{
+	return atomic_get(&data_fifo->spsc_read) != atomic_get(&data_fifo->spsc_locked);
+}
+
+/** @brief Waits until the other side of the ring has made the condition true.
+ *
+ * The other side only gives the semaphore if the waiting flag is set, so the
+ * condition is checked again after setting the flag.
+ */
+static int spsc_wait(struct data_fifo *data_fifo, bool (*ready)(struct data_fifo *data_fifo),
+		     atomic_val_t waiting, struct k_sem *sem, k_timeout_t timeout, int no_wait_err)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret;
+
+	while (!ready(data_fifo)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return no_wait_err;
+		}
+
+		atomic_or(&data_fifo->spsc_waiting, waiting);
+
+		if (ready(data_fifo)) {
+			atomic_and(&data_fifo->spsc_waiting, ~waiting);
+			break;
+		}
+
+		ret = k_sem_take(sem, sys_timepoint_timeout(end));
+		atomic_and(&data_fifo->spsc_waiting, ~waiting);
+		if (ret) {
+			return -EAGAIN;
+		}
+	}
+
+	return 0;
+}
+
+static void spsc_notify(struct data_fifo *data_fifo, atomic_val_t waiting, struct k_sem *sem)
+{
+	if (atomic_get(&data_fifo->spsc_waiting) & waiting) {
+		k_sem_give(sem);
+	}
+}
+
+static int spsc_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
+					 k_timeout_t timeout)
+{
+	atomic_val_t alloced;
+	int ret;
+
+	/* Same return values as k_mem_slab_alloc */
+	ret = spsc_wait(data_fifo, spsc_vacant, SPSC_WAITING_VACANT, &data_fifo->spsc_vacant_sem,
+			timeout, -ENOMEM);
+	if (ret) {
+		return ret;
+	}
+
+	alloced = atomic_get(&data_fifo->spsc_alloced);
+	*data = spsc_slot(data_fifo, alloced)->block_ptr;
+	atomic_set(&data_fifo->spsc_alloced, spsc_next(data_fifo, alloced));
+
+	return 0;
+}
+
+static int spsc_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
+{
+	atomic_val_t locked = atomic_get(&data_fifo->spsc_locked);
+	struct data_fifo_msgq *slot = spsc_slot(data_fifo, locked);
+
+	if (locked == atomic_get(&data_fifo->spsc_alloced) || *data != slot->block_ptr) {
+		LOG_ERR("Blocks must be locked in the order they are taken");
+		return -ESPIPE;
+	}
+
+	slot->size = size;
+	atomic_set(&data_fifo->spsc_locked, spsc_next(data_fifo, locked));
+
+	spsc_notify(data_fifo, SPSC_WAITING_FILLED, &data_fifo->spsc_filled_sem);
+
+	return 0;
+}
+
+static int spsc_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+					k_timeout_t timeout)
+{
+	atomic_val_t read;
+	struct data_fifo_msgq *slot;
+	int ret;
+
+	/* Same return values as k_msgq_get */
+	ret = spsc_wait(data_fifo, spsc_filled, SPSC_WAITING_FILLED, &data_fifo->spsc_filled_sem,
+			timeout, -ENOMSG);
+	if (ret) {
+		return ret;
+	}
+
+	read = atomic_get(&data_fifo->spsc_read);
+	slot = spsc_slot(data_fifo, read);
+	*data = slot->block_ptr;
+	*size = slot->size;
+	atomic_set(&data_fifo->spsc_read, spsc_next(data_fifo, read));
+
+	return 0;
+}
+
+static void spsc_block_free(struct data_fifo *data_fifo, void *data)
+{
+	atomic_val_t freed = atomic_get(&data_fifo->spsc_freed);
+
+	__ASSERT(freed != atomic_get(&data_fifo->spsc_read) &&
+			 data == spsc_slot(data_fifo, freed)->block_ptr,
+		 "Blocks must be freed in the order they are read");
+
+	atomic_set(&data_fifo->spsc_freed, spsc_next(data_fifo, freed));
+
+	spsc_notify(data_fifo, SPSC_WAITING_VACANT, &data_fifo->spsc_vacant_sem);
+}
+
+static void spsc_reset(struct data_fifo *data_fifo)
+{
+	atomic_set(&data_fifo->spsc_alloced, 0);
+	atomic_set(&data_fifo->spsc_locked, 0);
+	atomic_set(&data_fifo->spsc_read, 0);
+	atomic_set(&data_fifo->spsc_freed, 0);
+	atomic_set(&data_fifo->spsc_waiting, 0);
+
+	k_sem_init(&data_fifo->spsc_vacant_sem, 0, 1);
+	k_sem_init(&data_fifo->spsc_filled_sem, 0, 1);
+}
+
+static void spsc_init(struct data_fifo *data_fifo)
+{
+	struct data_fifo_msgq *slots = (struct data_fifo_msgq *)data_fifo->msgq_buffer;
+
+	/* Each slot in the ring always refers to the same block */
+	for (uint32_t i = 0; i < data_fifo->elements_max; i++) {
+		slots[i].block_ptr = data_fifo->slab_buffer + i * data_fifo->block_size_max;
+		slots[i].size = 0;
+	}
+
+	spsc_reset(data_fifo);
+}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 /** @brief Checks that the elements in the msgq and slab are legal.
  * I.e. the number of msgq elements cannot be more than mem blocks used.
  */
 static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *msgq_num_used_in,
 					 uint32_t *slab_blocks_num_used_in)
 {
-	/* Lock so msgq and slab reads are in sync */
-	k_spinlock_key_t key = k_spin_lock(&lock);
-
-	uint32_t msgq_num_used = k_msgq_num_used_get(&data_fifo->msgq);
-	uint32_t slab_blocks_num_used = k_mem_slab_num_used_get(&data_fifo->mem_slab);
-
-	k_spin_unlock(&lock, key);
+	uint32_t msgq_num_used;
+	uint32_t slab_blocks_num_used;
+
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		/* Read the consumer indices first, so the counts cannot be negative */
+		atomic_val_t freed = atomic_get(&data_fifo->spsc_freed);
+		atomic_val_t read = atomic_get(&data_fifo->spsc_read);
+
+		msgq_num_used = spsc_count(data_fifo, atomic_get(&data_fifo->spsc_locked), read);
+		slab_blocks_num_used =
+			spsc_count(data_fifo, atomic_get(&data_fifo->spsc_alloced), freed);
+	} else
+#endif
+	{
+		/* Lock so msgq and slab reads are in sync */
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		msgq_num_used = k_msgq_num_used_get(&data_fifo->msgq);
+		slab_blocks_num_used = k_mem_slab_num_used_get(&data_fifo->mem_slab);
+
+		k_spin_unlock(&lock, key);
+	}
 
 	if (slab_blocks_num_used < msgq_num_used) {
 		LOG_ERR("Num used mgsq %d cannot be larger than used blocks %d", msgq_num_used,
@@ -48,6 +236,12 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		return spsc_pointer_first_vacant_get(data_fifo, data, timeout);
+	}
+#endif
+
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
 	return ret;
 }
@@ -66,6 +260,12 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		return spsc_block_lock(data_fifo, data, size);
+	}
+#endif
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -91,6 +291,12 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		return spsc_pointer_last_filled_get(data_fifo, data, size, timeout);
+	}
+#endif
+
 	struct data_fifo_msgq msgq_tmp;
 
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
@@ -108,6 +314,13 @@ void data_fifo_block_free(struct data_fifo *data_fifo, void *data)
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		spsc_block_free(data_fifo, data);
+		return;
+	}
+#endif
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -138,6 +351,14 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 	void *old_data;
 	size_t size;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		/* Blocks are only released in order, so reset the ring to release all of them */
+		spsc_reset(data_fifo);
+		return 0;
+	}
+#endif
+
 	ret = data_fifo_num_used_get(data_fifo, &fifo_alloced_num, &fifo_locked_num);
 	if (ret) {
 		LOG_ERR("Failed to get num used in FIFO");
@@ -192,6 +413,14 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		spsc_init(data_fifo);
+		data_fifo->initialized = true;
+		return 0;
+	}
+#endif
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
@@ -49,8 +49,11 @@
 /* Offloading context related to nRF socket. */
 static struct nrf_sock_ctx {
 	int nrf_fd; /* nRF socket descriptior. */
+	int type; /* Socket type. */
 	struct k_mutex *lock; /* Mutex associated with the socket. */
 	struct k_poll_signal poll; /* poll() signal. */
+	struct k_mutex sendmsg_lock; /* Protects sendmsg_buf. */
+	uint8_t sendmsg_buf[CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE]; /* sendmsg() repack buffer. */
 } offload_ctx[NRF_MODEM_MAX_SOCKET_COUNT];
 
 static K_MUTEX_DEFINE(ctx_lock);
@@ -62,7 +65,7 @@ static bool offload_disabled;
 /* TLS offloading disabled only. */
 static bool tls_offload_disabled;
 
-static struct nrf_sock_ctx *allocate_ctx(int nrf_fd)
+static struct nrf_sock_ctx *allocate_ctx(int nrf_fd, int type)
 {
 	struct nrf_sock_ctx *ctx = NULL;
 
@@ -72,6 +75,7 @@ static struct nrf_sock_ctx *allocate_ctx(int nrf_fd)
 		if (offload_ctx[i].nrf_fd == -1) {
 			ctx = &offload_ctx[i];
 			ctx->nrf_fd = nrf_fd;
+			ctx->type = type;
 			break;
 		}
 	}
@@ -377,7 +381,7 @@ static int nrf9x_socket_offload_accept(void *obj, struct sockaddr *addr,
 		goto error;
 	}
 
-	ctx = allocate_ctx(new_sd);
+	ctx = allocate_ctx(new_sd, SOCK_STREAM);
 	if (ctx == NULL) {
 		errno = ENOMEM;
 		goto error;
@@ -664,52 +668,133 @@ static ssize_t nrf9x_socket_offload_sendto(void *obj, const void *buf,
 	return retval;
 }
 
+static size_t iov_total_len(const struct msghdr *msg)
+{
+	size_t len = 0;
+
+	for (int i = 0; i < msg->msg_iovlen; i++) {
+		len += msg->msg_iov[i].iov_len;
+	}
+
+	return len;
+}
+
+/* Number of message parts that contain data, and the last of them. */
+static int iov_used_count(const struct msghdr *msg, const struct iovec **last)
+{
+	int count = 0;
+
+	for (int i = 0; i < msg->msg_iovlen; i++) {
+		if (msg->msg_iov[i].iov_len) {
+			*last = &msg->msg_iov[i];
+			count++;
+		}
+	}
+
+	return count;
+}
+
+static void iov_gather(uint8_t *buf, const struct msghdr *msg)
+{
+	for (int i = 0; i < msg->msg_iovlen; i++) {
+		memcpy(buf, msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
+		buf += msg->msg_iov[i].iov_len;
+	}
+}
+
+static void iov_scatter(const struct msghdr *msg, const uint8_t *buf, size_t len)
+{
+	size_t part;
+
+	for (int i = 0; (i < msg->msg_iovlen) && len; i++) {
+		part = MIN(len, msg->msg_iov[i].iov_len);
+		memcpy(msg->msg_iov[i].iov_base, buf, part);
+		buf += part;
+		len -= part;
+	}
+}
+
+/* Send all of `buf`, which a stream socket might not do in one `sendto` call. */
+static ssize_t sendto_all(void *obj, const uint8_t *buf, size_t len, int flags,
+			  const struct msghdr *msg)
+{
+	ssize_t ret;
+	size_t offset = 0;
+
+	while (offset < len) {
+		ret = nrf9x_socket_offload_sendto(obj, buf + offset, len - offset, flags,
+						  msg->msg_name, msg->msg_namelen);
+		if (ret < 0) {
+			return ret;
+		}
+		offset += ret;
+	}
+
+	return offset;
+}
+
 static ssize_t nrf9x_socket_offload_sendmsg(void *obj, const struct msghdr *msg,
 					    int flags)
 {
+	struct nrf_sock_ctx *ctx = OBJ_TO_CTX(obj);
+	const struct iovec *last = NULL;
 	ssize_t len = 0;
 	ssize_t ret;
-	ssize_t offset;
+	uint8_t *buf;
 	int i;
-	static K_MUTEX_DEFINE(sendmsg_lock);
-	static uint8_t buf[CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE];
 
 	if (msg == NULL) {
 		errno = EINVAL;
 		return -1;
 	}
 
+	/* Send a message that is in a single part as is, without copying it. */
+	if (iov_used_count(msg, &last) <= 1) {
+		return sendto_all(obj, last ? last->iov_base : NULL, last ? last->iov_len : 0,
+				  flags, msg);
+	}
+
 	/* Try to reduce number of `sendto` calls - copy data if they fit into
-	 * a single buffer
+	 * the buffer of the socket.
 	 */
+	len = iov_total_len(msg);
 
-	for (i = 0; i < msg->msg_iovlen; i++) {
-		len += msg->msg_iov[i].iov_len;
-	}
+	if (len <= sizeof(ctx->sendmsg_buf)) {
+		/* Protect the buffer from concurrent `sendmsg` calls on the same socket.
+		 * The socket mutex is released while waiting, as `sendto` releases it
+		 * for the duration of the send.
+		 */
+		if (ctx->lock) {
+			(void)k_mutex_unlock(ctx->lock);
+		}
 
-	if (len <= sizeof(buf)) {
-		/* Protect `buf` access with a mutex. */
-		k_mutex_lock(&sendmsg_lock, K_FOREVER);
-		len = 0;
+		k_mutex_lock(&ctx->sendmsg_lock, K_FOREVER);
 
-		for (i = 0; i < msg->msg_iovlen; i++) {
-			memcpy(buf + len, msg->msg_iov[i].iov_base,
-			       msg->msg_iov[i].iov_len);
-			len += msg->msg_iov[i].iov_len;
+		if (ctx->lock) {
+			(void)k_mutex_lock(ctx->lock, K_FOREVER);
 		}
 
-		offset = 0;
-		ret = 0;
-		while ((offset < len) && (ret >= 0)) {
-			ret = nrf9x_socket_offload_sendto(obj,
-				(buf + offset), (len - offset), flags,
-				msg->msg_name, msg->msg_namelen);
-			if (ret > 0) {
-				offset += ret;
-			}
+		iov_gather(ctx->sendmsg_buf, msg);
+		ret = sendto_all(obj, ctx->sendmsg_buf, len, flags, msg);
+
+		k_mutex_unlock(&ctx->sendmsg_lock);
+		return ret;
+	}
+
+	/* A datagram must be sent in a single call, so repack it into a temporary buffer.
+	 * Without the heap, each part is sent separately, like on stream sockets.
+	 */
+	if (IS_ENABLED(CONFIG_NRF_MODEM_LIB_MSG_DGRAM_HEAP_BUF) && (ctx->type != SOCK_STREAM)) {
+		buf = k_malloc(len);
+		if (buf == NULL) {
+			errno = ENOMEM;
+			return -1;
 		}
 
-		k_mutex_unlock(&sendmsg_lock);
+		iov_gather(buf, msg);
+		ret = sendto_all(obj, buf, len, flags, msg);
+
+		k_free(buf);
 		return ret;
 	}
 
@@ -724,17 +809,100 @@ static ssize_t nrf9x_socket_offload_sendmsg(void *obj, const struct msghdr *msg,
 			continue;
 		}
 
-		offset = 0;
-		while (offset < msg->msg_iov[i].iov_len) {
-			ret = nrf9x_socket_offload_sendto(obj,
-				(((uint8_t *) msg->msg_iov[i].iov_base) + offset),
-				(msg->msg_iov[i].iov_len - offset), flags,
-				msg->msg_name, msg->msg_namelen);
-			if (ret < 0) {
-				return ret;
+		ret = sendto_all(obj, msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len,
+				 flags, msg);
+		if (ret < 0) {
+			return ret;
+		}
+		len += ret;
+	}
+
+	return len;
+}
+
+static ssize_t nrf9x_socket_offload_recvmsg(void *obj, struct msghdr *msg, int flags)
+{
+	struct nrf_sock_ctx *ctx = OBJ_TO_CTX(obj);
+	const struct iovec *last = NULL;
+	ssize_t len = 0;
+	ssize_t ret;
+	uint8_t *buf;
+	int i;
+
+	if (msg == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	msg->msg_controllen = 0;
+	msg->msg_flags = 0;
+
+	/* Receive a message that has a single part directly into it. The modem library
+	 * does not report whether a datagram received this way was truncated.
+	 */
+	if (iov_used_count(msg, &last) <= 1) {
+		return nrf9x_socket_offload_recvfrom(obj, last ? last->iov_base : NULL,
+						     last ? last->iov_len : 0, flags,
+						     msg->msg_name, &msg->msg_namelen);
+	}
+
+	/* A datagram must be received in a single call, so receive it into a temporary
+	 * buffer and distribute it over the message parts. The buffer has room for one
+	 * more byte, to tell whether the datagram was truncated.
+	 */
+	if (ctx->type != SOCK_STREAM) {
+		if (!IS_ENABLED(CONFIG_NRF_MODEM_LIB_MSG_DGRAM_HEAP_BUF)) {
+			errno = ENOTSUP;
+			return -1;
+		}
+
+		len = iov_total_len(msg);
+		buf = k_malloc(len + 1);
+		if (buf == NULL) {
+			errno = ENOMEM;
+			return -1;
+		}
+
+		ret = nrf9x_socket_offload_recvfrom(obj, buf, len + 1, flags,
+						    msg->msg_name, &msg->msg_namelen);
+		if (ret > len) {
+			msg->msg_flags |= ZSOCK_MSG_TRUNC;
+			ret = len;
+		}
+		if (ret > 0) {
+			iov_scatter(msg, buf, ret);
+		}
+
+		k_free(buf);
+		return ret;
+	}
+
+	/* Receive stream data directly into each part, and only wait for the first one. */
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		if (msg->msg_iov[i].iov_len == 0) {
+			continue;
+		}
+
+		ret = nrf9x_socket_offload_recvfrom(obj, msg->msg_iov[i].iov_base,
+						    msg->msg_iov[i].iov_len, flags,
+						    len ? NULL : msg->msg_name,
+						    len ? NULL : &msg->msg_namelen);
+		if (ret < 0) {
+			if (len && (errno == EAGAIN)) {
+				break;
 			}
-			offset += ret;
-			len += ret;
+			return ret;
+		}
+
+		len += ret;
+		if ((ret < msg->msg_iov[i].iov_len) || (flags & ZSOCK_MSG_PEEK)) {
+			/* Peeking at the next part would return the same data again. */
+			break;
+		}
+
+		if (!(flags & ZSOCK_MSG_WAITALL)) {
+			/* Only return the data that is already available for the next parts. */
+			flags |= ZSOCK_MSG_DONTWAIT;
 		}
 	}
 
@@ -1025,6 +1193,7 @@ static const struct socket_op_vtable nrf9x_socket_fd_op_vtable = {
 	.sendto = nrf9x_socket_offload_sendto,
 	.sendmsg = nrf9x_socket_offload_sendmsg,
 	.recvfrom = nrf9x_socket_offload_recvfrom,
+	.recvmsg = nrf9x_socket_offload_recvmsg,
 	.getsockopt = nrf9x_socket_offload_getsockopt,
 	.setsockopt = nrf9x_socket_offload_setsockopt,
 };
@@ -1093,7 +1262,7 @@ static int nrf9x_socket_create(int family, int type, int proto)
 		return -1;
 	}
 
-	ctx = allocate_ctx(sd);
+	ctx = allocate_ctx(sd, type);
 	if (ctx == NULL) {
 		errno = ENOMEM;
 		nrf_close(sd);
@@ -1120,6 +1289,7 @@ static int nrf9x_socket_offload_init(const struct device *arg)
 
 	for (int i = 0; i < ARRAY_SIZE(offload_ctx); i++) {
 		offload_ctx[i].nrf_fd = -1;
+		k_mutex_init(&offload_ctx[i].sendmsg_lock);
 	}
 
 	return 0;
@@ -525,5 +525,25 @@ int nrf_modem_lib_trace_clear(void)
 	return 0;
 }
 
+int nrf_modem_lib_trace_seek(int64_t start_ms)
+{
+	int err;
+
+	if (!trace_backend.seek) {
+		return -ENOTSUP;
+	}
+
+	err = trace_backend.seek(start_ms);
+	if (err) {
+		return err;
+	}
+
+	/* Older traces are discarded, we can attempt to write more. */
+	has_space = true;
+	k_sem_give(&trace_clear_sem);
+
+	return 0;
+}
+
 K_THREAD_DEFINE(trace_thread, CONFIG_NRF_MODEM_LIB_TRACE_STACK_SIZE, trace_thread_handler,
 	       NULL, NULL, NULL, TRACE_THREAD_PRIORITY, 0, 0);
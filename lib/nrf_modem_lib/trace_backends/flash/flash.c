@@ -11,6 +11,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/fs/fcb.h>
 #include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
 
@@ -26,6 +27,15 @@ LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
 #define TRACE_MAGIC_INITIALIZED 0x152ac523
 
+/* Trace data is collected in one buffer while the other one is written to flash. */
+struct trace_buf {
+	/* Number of bytes in the buffer */
+	size_t written;
+	/* Uptime when the first byte was added to the buffer */
+	int64_t ts;
+	uint8_t data[BUF_SIZE];
+};
+
 static trace_backend_processed_cb trace_processed_callback;
 
 static const struct flash_area *modem_trace_area;
@@ -42,77 +52,158 @@ static __noinit size_t read_offset;
 static __noinit struct fcb_entry loc;
 static __noinit struct flash_sector *sector;
 
-static __noinit size_t trace_bytes_unread;
-static __noinit size_t flash_buf_written;
-static __noinit uint8_t flash_buf[BUF_SIZE];
+static __noinit atomic_t trace_bytes_unread;
+static __noinit struct trace_buf flash_bufs[2];
+static __noinit uint8_t active_buf;
+
+/* Uptime when the first entry was written to each sector, used to seek by time.
+ * Data written before a warm boot is considered older than any time in the current boot.
+ */
+static int64_t sector_ts[CONFIG_NRF_MODEM_LIB_TRACE_FLASH_SECTORS];
+static struct flash_sector *write_sector;
 
 static bool is_initialized;
 
 static struct k_sem fcb_sem;
+/* Protects the active buffer, which is filled by the writer while it can be read out. */
+static K_MUTEX_DEFINE(buf_lock);
+
+static K_THREAD_STACK_DEFINE(flash_workq_stack,
+			     CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_WORKQ_STACK_SIZE);
+static struct k_work_q flash_workq;
+static struct k_work flush_work;
+/* Taken while a buffer is queued for or being written to flash. */
+static K_SEM_DEFINE(flush_idle_sem, 1, 1);
+static int flush_err;
 
 static size_t buffer_append(const void *data, size_t len)
 {
+	struct trace_buf *tb;
 	size_t append_len;
 
-	append_len = MIN(len, sizeof(flash_buf) - flash_buf_written);
+	k_mutex_lock(&buf_lock, K_FOREVER);
+
+	tb = &flash_bufs[active_buf];
+	append_len = MIN(len, sizeof(tb->data) - tb->written);
+
+	if (tb->written == 0) {
+		tb->ts = k_uptime_get();
+	}
 
-	memcpy(&flash_buf[flash_buf_written], data, append_len);
+	memcpy(&tb->data[tb->written], data, append_len);
 
-	flash_buf_written += append_len;
-	trace_bytes_unread += append_len;
+	tb->written += append_len;
+	atomic_add(&trace_bytes_unread, append_len);
+
+	k_mutex_unlock(&buf_lock);
 
 	return append_len;
 }
 
+/* Get the buffer holding the oldest trace data that is not in flash yet.
+ * FCB sem has to be taken before calling this function!
+ */
+static struct trace_buf *buffer_oldest_get(void)
+{
+	if (flash_bufs[active_buf ^ 1].written) {
+		return &flash_bufs[active_buf ^ 1];
+	}
+
+	if (flash_bufs[active_buf].written) {
+		return &flash_bufs[active_buf];
+	}
+
+	return NULL;
+}
+
+static void buffers_reset(void)
+{
+	flash_bufs[0].written = 0;
+	flash_bufs[1].written = 0;
+	active_buf = 0;
+}
+
+static struct flash_sector *sector_next(struct flash_sector *fs)
+{
+	fs++;
+	if (fs >= &trace_flash_sectors[trace_fcb.f_sector_cnt]) {
+		fs = trace_flash_sectors;
+	}
+
+	return fs;
+}
+
 static int fcb_walk_callback(struct fcb_entry_ctx *loc_ctx, void *arg)
 {
 	if ((loc_ctx->loc.fe_sector == sector) && (loc_ctx->loc.fe_elem_off < loc.fe_elem_off)) {
 		return 0;
 	}
 
-	trace_bytes_unread -= loc_ctx->loc.fe_data_len;
+	atomic_sub(&trace_bytes_unread, loc_ctx->loc.fe_data_len);
 	return 0;
 }
 
-static int buffer_flush_to_flash(void)
+/* Erase the oldest sector and remove its unread trace data from the count.
+ * FCB sem has to be taken before calling this function!
+ */
+static int oldest_sector_discard(void)
 {
 	int err;
-	struct fcb_entry loc_flush;
 
-	if (!is_initialized) {
-		return -EPERM;
+	/* Walk sector to remove unread trace data from count. */
+	err = fcb_walk(&trace_fcb, trace_fcb.f_oldest, fcb_walk_callback, NULL);
+	if (err) {
+		LOG_ERR("fcb_walk failed, err %d", err);
+		return err;
 	}
 
-	if (!flash_buf_written) {
-		return -ENODATA;
-	}
+	if (sector && (loc.fe_sector == trace_fcb.f_oldest)) {
+		/* The walk also removed what has already been read from the current entry. */
+		atomic_add(&trace_bytes_unread, read_offset ? read_offset : loc.fe_data_len);
 
-	k_sem_take(&fcb_sem, K_FOREVER);
+		/* Continue reading from the next sector. */
+		memset(&loc, 0, sizeof(loc));
+		read_offset = 0;
+		sector = NULL;
+	}
 
-	err = fcb_append(&trace_fcb, flash_buf_written, &loc_flush);
+	err = fcb_rotate(&trace_fcb);
 	if (err) {
-		if (IS_ENABLED(CONFIG_NRF_MODEM_TRACE_FLASH_NOSPACE_ERASE_OLDEST)) {
-			/* Find the number of trace bytes in oldest sector (that is not read). */
+		LOG_ERR("fcb_rotate failed, err %d", err);
+	}
 
-			/* Get first sector in FCB */
-			loc_flush.fe_sector = 0;
-			loc_flush.fe_elem_off = 0;
-			err = fcb_getnext(&trace_fcb, &loc_flush);
+	return err;
+}
 
-			/* Walk sector to remove unread trace data from count. */
-			err = fcb_walk(&trace_fcb, loc_flush.fe_sector, fcb_walk_callback, NULL);
-			if (err) {
-				LOG_ERR("fcb_walk failed, err %d", err);
-				goto out;
-			}
+static int buffer_flush_to_flash(bool pending)
+{
+	int err;
+	struct fcb_entry loc_flush;
+	struct trace_buf *tb;
+
+	if (!is_initialized) {
+		return -EPERM;
+	}
+
+	k_sem_take(&fcb_sem, K_FOREVER);
+
+	tb = pending ? &flash_bufs[active_buf ^ 1] : &flash_bufs[active_buf];
+	if (!tb->written) {
+		/* Already flushed, or read out before it was written to flash. */
+		err = -ENODATA;
+		goto out;
+	}
 
+	err = fcb_append(&trace_fcb, tb->written, &loc_flush);
+	if (err) {
+		if (IS_ENABLED(CONFIG_NRF_MODEM_TRACE_FLASH_NOSPACE_ERASE_OLDEST) ||
+		    IS_ENABLED(CONFIG_NRF_MODEM_TRACE_FLASH_NOSPACE_CIRCULAR)) {
 			/* Erase the oldest sector and append again. */
-			err = fcb_rotate(&trace_fcb);
+			err = oldest_sector_discard();
 			if (err) {
-				LOG_ERR("fcb_rotate failed, err %d", err);
 				goto out;
 			}
-			err = fcb_append(&trace_fcb, flash_buf_written, &loc_flush);
+			err = fcb_append(&trace_fcb, tb->written, &loc_flush);
 		}
 
 		if (err) {
@@ -123,7 +214,7 @@ static int buffer_flush_to_flash(void)
 	}
 
 	err = flash_area_write(
-		trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc_flush), flash_buf, flash_buf_written);
+		trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc_flush), tb->data, tb->written);
 	if (err) {
 		LOG_ERR("flash_area_write failed, err %d", err);
 		goto out;
@@ -135,13 +226,69 @@ static int buffer_flush_to_flash(void)
 		goto out;
 	}
 
-	flash_buf_written = 0;
+	if (loc_flush.fe_sector != write_sector) {
+		write_sector = loc_flush.fe_sector;
+		sector_ts[write_sector - trace_flash_sectors] = tb->ts;
+	}
+
+	tb->written = 0;
+
+	if (IS_ENABLED(CONFIG_NRF_MODEM_TRACE_FLASH_NOSPACE_CIRCULAR)) {
+		/* Keep a sector erased ahead of the active one, so that writing the next
+		 * buffer does not have to wait for an erase.
+		 */
+		while (fcb_free_sector_cnt(&trace_fcb) < 1) {
+			err = oldest_sector_discard();
+			if (err) {
+				goto out;
+			}
+		}
+	}
 
 out:
 	k_sem_give(&fcb_sem);
 	return err;
 }
 
+static void flush_work_fn(struct k_work *work)
+{
+	int err;
+
+	ARG_UNUSED(work);
+
+	err = buffer_flush_to_flash(true);
+	if (err && (err != -ENODATA)) {
+		LOG_ERR("buffer_flush_to_flash error %d", err);
+		flush_err = err;
+	}
+
+	k_sem_give(&flush_idle_sem);
+}
+
+/* Hand the full buffer over to the flush work and continue in the other one.
+ * Blocks only while the previous buffer is still being written to flash.
+ */
+static int buffer_swap(void)
+{
+	int err;
+
+	k_sem_take(&flush_idle_sem, K_FOREVER);
+
+	err = flush_err;
+	flush_err = 0;
+
+	k_sem_take(&fcb_sem, K_FOREVER);
+	if (!flash_bufs[active_buf ^ 1].written) {
+		active_buf ^= 1;
+	}
+	k_sem_give(&fcb_sem);
+
+	/* Write the full buffer, or retry the previous one if it could not be written. */
+	k_work_submit_to_queue(&flash_workq, &flush_work);
+
+	return err;
+}
+
 static int trace_flash_erase(void)
 {
 	int err;
@@ -167,6 +314,14 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 
 	k_sem_init(&fcb_sem, 0, 1);
 
+	if (!is_initialized) {
+		k_work_init(&flush_work, flush_work_fn);
+		k_work_queue_start(&flash_workq, flash_workq_stack,
+				   K_THREAD_STACK_SIZEOF(flash_workq_stack),
+				   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+		k_thread_name_set(&flash_workq.thread, "modem_trace_flash");
+	}
+
 	trace_processed_callback = trace_processed_cb;
 
 	err = flash_area_open(FIXED_PARTITION_ID(MODEM_TRACE), &modem_trace_area);
@@ -191,8 +346,8 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 	if (magic != TRACE_MAGIC_INITIALIZED) {
 		LOG_DBG("Initializing");
 		read_offset = 0;
-		trace_bytes_unread = 0;
-		flash_buf_written = 0;
+		atomic_set(&trace_bytes_unread, 0);
+		buffers_reset();
 		memset(&loc, 0, sizeof(loc));
 		sector = NULL;
 		magic = TRACE_MAGIC_INITIALIZED;
@@ -229,12 +384,16 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 	LOG_DBG("Modem trace flash storage initialized\n");
 
 	k_sem_give(&fcb_sem);
+
+	/* Write out a buffer that was waiting for flash when a warm boot occurred. */
+	(void)buffer_flush_to_flash(true);
+
 	return 0;
 }
 
 size_t trace_backend_data_size(void)
 {
-	return trace_bytes_unread;
+	return atomic_get(&trace_bytes_unread);
 }
 
 /* Read from offset
@@ -253,7 +412,7 @@ static int read_from_offset(void *buf, size_t len)
 		return err;
 	}
 
-	trace_bytes_unread -= to_read;
+	atomic_sub(&trace_bytes_unread, to_read);
 
 	read_offset += to_read;
 	if (read_offset >= loc.fe_data_len) {
@@ -267,6 +426,7 @@ int trace_backend_read(void *buf, size_t len)
 {
 	int err;
 	size_t to_read = 0;
+	struct trace_buf *tb;
 
 	if (!is_initialized) {
 		return -EPERM;
@@ -284,7 +444,8 @@ int trace_backend_read(void *buf, size_t len)
 	}
 
 	err = fcb_getnext(&trace_fcb, &loc);
-	if (err == -ENOTSUP && !flash_buf_written) {
+	tb = buffer_oldest_get();
+	if (err == -ENOTSUP && !tb) {
 		/* Nothing to read */
 		loc.fe_sector = 0;
 		loc.fe_elem_off = 0;
@@ -292,17 +453,22 @@ int trace_backend_read(void *buf, size_t len)
 		sector = NULL;
 		err = -ENODATA;
 		goto out;
-	} else if (err == -ENOTSUP && flash_buf_written) {
-		to_read = MIN(flash_buf_written, len);
-		memcpy(buf, flash_buf, to_read);
-		if (to_read != flash_buf_written) {
+	} else if (err == -ENOTSUP && tb) {
+		/* The writer may be appending to this buffer if it is the active one. */
+		k_mutex_lock(&buf_lock, K_FOREVER);
+
+		to_read = MIN(tb->written, len);
+		memcpy(buf, tb->data, to_read);
+		if (to_read != tb->written) {
 			/* We haven't read all, move the rest to start of buffer */
-			memmove(flash_buf, &flash_buf[to_read],
-				flash_buf_written - to_read);
+			memmove(tb->data, &tb->data[to_read],
+				tb->written - to_read);
 		}
 
-		flash_buf_written -= to_read;
-		trace_bytes_unread -= to_read;
+		tb->written -= to_read;
+		atomic_sub(&trace_bytes_unread, to_read);
+
+		k_mutex_unlock(&buf_lock);
 
 		err = to_read;
 		goto out;
@@ -343,9 +509,9 @@ static int stream_write(const void *buf, size_t len)
 	while (bytes_left) {
 		written = buffer_append(&bytes[len - bytes_left], bytes_left);
 		if (written != bytes_left) {
-			ret = buffer_flush_to_flash();
+			ret = buffer_swap();
 			if (ret) {
-				LOG_ERR("buffer_flush_to_flash error %d", ret);
+				LOG_ERR("buffer_swap error %d", ret);
 				return ret;
 			}
 		}
@@ -382,16 +548,54 @@ int trace_backend_clear(void)
 		return -EPERM;
 	}
 
+	k_sem_take(&flush_idle_sem, K_FOREVER);
 	k_sem_take(&fcb_sem, K_FOREVER);
 	LOG_DBG("Clearing trace storage");
-	flash_buf_written = 0;
+	k_mutex_lock(&buf_lock, K_FOREVER);
+	buffers_reset();
+	atomic_set(&trace_bytes_unread, 0);
+	k_mutex_unlock(&buf_lock);
+	flush_err = 0;
 	err = fcb_clear(&trace_fcb);
 
 	loc.fe_sector = 0;
 	loc.fe_elem_off = 0;
-	trace_bytes_unread = 0;
 	read_offset = 0;
 	sector = NULL;
+	write_sector = NULL;
+	memset(sector_ts, 0, sizeof(sector_ts));
+
+	k_sem_give(&fcb_sem);
+	k_sem_give(&flush_idle_sem);
+
+	return err;
+}
+
+int trace_backend_seek(int64_t start_ms)
+{
+	int err = 0;
+	struct flash_sector *next;
+
+	if (!is_initialized) {
+		return -EPERM;
+	}
+
+	k_sem_take(&fcb_sem, K_FOREVER);
+
+	/* All data in the oldest sector is older than the start time if the following
+	 * sector was started before it.
+	 */
+	while (trace_fcb.f_oldest != trace_fcb.f_active.fe_sector) {
+		next = sector_next(trace_fcb.f_oldest);
+		if (sector_ts[next - trace_flash_sectors] > start_ms) {
+			break;
+		}
+
+		err = oldest_sector_discard();
+		if (err) {
+			break;
+		}
+	}
 
 	k_sem_give(&fcb_sem);
 
@@ -400,7 +604,12 @@ int trace_backend_clear(void)
 
 int trace_backend_deinit(void)
 {
-	buffer_flush_to_flash();
+	/* Wait for the pending buffer, then write out what is left. */
+	k_sem_take(&flush_idle_sem, K_FOREVER);
+	(void)buffer_flush_to_flash(true);
+	(void)buffer_flush_to_flash(false);
+	k_sem_give(&flush_idle_sem);
+
 	return 0;
 }
 
@@ -411,4 +620,5 @@ struct nrf_modem_lib_trace_backend trace_backend = {
 	.data_size = trace_backend_data_size,
 	.read = trace_backend_read,
 	.clear = trace_backend_clear,
+	.seek = trace_backend_seek,
 };
@@ -6,130 +6,264 @@
 
 #include <pcm_mix.h>
 
+#include <string.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#define PCM_MIX_SIMD 1
+#else
+#define PCM_MIX_SIMD 0
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
+#define PCM_24_MAX ((int32_t)BIT(23) - 1)
+#define PCM_24_MIN (-(int32_t)BIT(23))
+
 /* Clip signal if amplitude is outside legal range */
-static void hard_limiter(int32_t *const pcm)
+static inline int16_t hard_limiter_16(int32_t pcm)
 {
-	if (*pcm < INT16_MIN) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MIN;
-	} else if (*pcm > INT16_MAX) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MAX;
-	}
+#if PCM_MIX_SIMD
+	return (int16_t)__ssat(pcm, 16);
+#else
+	return (int16_t)CLAMP(pcm, INT16_MIN, INT16_MAX);
+#endif
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+static inline int32_t hard_limiter_24(int32_t pcm)
 {
-	int32_t res;
+#if PCM_MIX_SIMD
+	return __ssat(pcm, 24);
+#else
+	return CLAMP(pcm, PCM_24_MIN, PCM_24_MAX);
+#endif
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+static inline int32_t hard_limiter_32(int64_t pcm)
+{
+	return (int32_t)CLAMP(pcm, INT32_MIN, INT32_MAX);
+}
 
-		hard_limiter(&res);
+/* Location of the samples of buffer B in buffer A for a given mix mode */
+struct mix_layout {
+	/* Number of samples in A per sample in B */
+	uint8_t a_stride;
+	/* Index of the first sample in A */
+	uint8_t a_offset;
+	/* Number of consecutive samples in A that are mixed with a single sample in B */
+	uint8_t a_count;
+};
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+static int mix_layout_get(enum pcm_mix_mode mix_mode, struct mix_layout *layout)
+{
+	switch (mix_mode) {
+	case B_STEREO_INTO_A_STEREO:
+		/* Fall through */
+	case B_MONO_INTO_A_MONO:
+		*layout = (struct mix_layout){.a_stride = 1, .a_offset = 0, .a_count = 1};
+		break;
+	case B_MONO_INTO_A_STEREO_LR:
+		*layout = (struct mix_layout){.a_stride = 2, .a_offset = 0, .a_count = 2};
+		break;
+	case B_MONO_INTO_A_STEREO_L:
+		*layout = (struct mix_layout){.a_stride = 2, .a_offset = 0, .a_count = 1};
+		break;
+	case B_MONO_INTO_A_STEREO_R:
+		*layout = (struct mix_layout){.a_stride = 2, .a_offset = 1, .a_count = 1};
+		break;
+	default:
+		return -ESRCH;
 	}
+
+	return 0;
 }
 
-/* Mix mono into both channels of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
-					    void const *const pcm_b, size_t size_b)
+/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
+static void pcm_mix_identical_16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples)
 {
-	int32_t res;
+	size_t i = 0;
 
-	/* Use size_b as this is the length of the mono sample.
-	 * This must be *2 to traverse the stereo sample and /2 since
-	 * the sample is two bytes in size.
+#if PCM_MIX_SIMD
+	/* Two samples per instruction. The buffers may be unaligned, memcpy compiles into
+	 * single word accesses on cores supporting unaligned access.
 	 */
-	for (uint32_t i = 0; i < size_b; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+	for (; (i + 2) <= samples; i += 2) {
+		int16x2_t a;
+		int16x2_t b;
 
-		hard_limiter(&res);
+		memcpy(&a, &pcm_a[i], sizeof(a));
+		memcpy(&b, &pcm_b[i], sizeof(b));
+		a = __qadd16(a, b);
+		memcpy(&pcm_a[i], &a, sizeof(a));
+	}
+#endif
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+	for (; i < samples; i++) {
+		pcm_a[i] = hard_limiter_16((int32_t)pcm_a[i] + pcm_b[i]);
 	}
 }
 
-/* Mix mono into left channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* Mix mono into one or both channels of a stereo buffer */
+static void pcm_mix_mono_into_stereo_16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples,
+					const struct mix_layout *layout)
 {
-	int32_t res;
+#if PCM_MIX_SIMD
+	/* Every sample of B is placed in the half-word of the matching channel and added to
+	 * the whole stereo frame in one instruction. The other channel gets zero added.
+	 */
+	uint32_t mask = 0;
+
+	for (uint8_t ch = layout->a_offset; ch < (layout->a_offset + layout->a_count); ch++) {
+		mask |= 0xFFFFUL << (16 * ch);
+	}
+
+	for (size_t i = 0; i < samples; i++) {
+		uint16_t b = (uint16_t)pcm_b[i];
+		int16x2_t frame_b = (int16x2_t)((((uint32_t)b << 16) | b) & mask);
+		int16x2_t frame_a;
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
+		memcpy(&frame_a, &pcm_a[i * 2], sizeof(frame_a));
+		frame_a = __qadd16(frame_a, frame_b);
+		memcpy(&pcm_a[i * 2], &frame_a, sizeof(frame_a));
+	}
+#else
+	for (size_t i = 0; i < samples; i++) {
+		int16_t *frame_a = &pcm_a[i * 2 + layout->a_offset];
+
+		for (uint8_t ch = 0; ch < layout->a_count; ch++) {
+			frame_a[ch] = hard_limiter_16((int32_t)frame_a[ch] + pcm_b[i]);
+		}
+	}
+#endif
+}
 
-		hard_limiter(&res);
+static void pcm_mix_gain_16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples,
+			    const struct mix_layout *layout, uint16_t gain_b)
+{
+	for (size_t i = 0; i < samples; i++) {
+		int32_t b = ((int32_t)pcm_b[i] * gain_b) >> PCM_MIX_GAIN_FRAC_BITS;
+		int16_t *a = &pcm_a[i * layout->a_stride + layout->a_offset];
 
-		((int16_t *)pcm_a)[i * 2] = (int16_t)res;
+		for (uint8_t ch = 0; ch < layout->a_count; ch++) {
+			a[ch] = hard_limiter_16(a[ch] + b);
+		}
 	}
 }
 
-/* Mix mono into right channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* 24-bit samples are packed in three little-endian bytes, like in the other PCM libraries */
+#define PCM_24_BYTES 3
+
+static inline int32_t pcm_24_get(uint8_t const *pcm)
 {
-	int32_t res;
+	/* Sign extend from bit 23 */
+	return (int32_t)(sys_get_le24(pcm) << 8) >> 8;
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
+static void pcm_mix_24(uint8_t *pcm_a, uint8_t const *pcm_b, size_t samples,
+		       const struct mix_layout *layout, uint16_t gain_b)
+{
+	for (size_t i = 0; i < samples; i++) {
+		int32_t b = pcm_24_get(&pcm_b[i * PCM_24_BYTES]);
+		uint8_t *a = &pcm_a[(i * layout->a_stride + layout->a_offset) * PCM_24_BYTES];
 
-		hard_limiter(&res);
+		if (gain_b != PCM_MIX_GAIN_UNITY) {
+			b = (int32_t)(((int64_t)b * gain_b) >> PCM_MIX_GAIN_FRAC_BITS);
+		}
 
-		((int16_t *)pcm_a)[i * 2 + 1] = (int16_t)res;
+		for (uint8_t ch = 0; ch < layout->a_count; ch++) {
+			sys_put_le24(hard_limiter_24(pcm_24_get(a) + b), a);
+			a += PCM_24_BYTES;
+		}
 	}
 }
 
-int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
-	    enum pcm_mix_mode mix_mode)
+static void pcm_mix_32(int32_t *pcm_a, int32_t const *pcm_b, size_t samples,
+		       const struct mix_layout *layout, uint16_t gain_b)
+{
+	for (size_t i = 0; i < samples; i++) {
+		int64_t b = pcm_b[i];
+		int32_t *a = &pcm_a[i * layout->a_stride + layout->a_offset];
+
+		if (gain_b != PCM_MIX_GAIN_UNITY) {
+			b = (b * gain_b) >> PCM_MIX_GAIN_FRAC_BITS;
+		}
+
+		for (uint8_t ch = 0; ch < layout->a_count; ch++) {
+			a[ch] = hard_limiter_32(a[ch] + b);
+		}
+	}
+}
+
+int pcm_mix_ext(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth, uint16_t gain_b)
 {
+	struct mix_layout layout;
+	size_t bytes_per_sample;
+	size_t samples_b;
+	int ret;
+
 	if (pcm_a == NULL || size_a == 0) {
 		return -EINVAL;
 	}
 
+	switch (pcm_bit_depth) {
+	case 16:
+		bytes_per_sample = sizeof(int16_t);
+		break;
+	case 24:
+		bytes_per_sample = PCM_24_BYTES;
+		break;
+	case 32:
+		bytes_per_sample = sizeof(int32_t);
+		break;
+	default:
+		LOG_ERR("Invalid bit depth: %d", pcm_bit_depth);
+		return -EINVAL;
+	}
+
 	if (pcm_b == NULL || size_b == 0) {
 		/* Nothing to mix, returning */
 		return 0;
 	}
 
-	switch (mix_mode) {
-	case B_STEREO_INTO_A_STEREO:
-		/* Fall through */
-	case B_MONO_INTO_A_MONO:
-		if (size_b > size_a) {
-			return -EPERM;
-		}
-		pcm_mix_identical(pcm_a, size_a, pcm_b, size_b);
-		break;
-	case B_MONO_INTO_A_STEREO_LR:
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
-		pcm_mix_b_mono_into_a_stereo_lr(pcm_a, size_a, pcm_b, size_b);
-		break;
-	case B_MONO_INTO_A_STEREO_L:
-		pcm_mix_b_mono_into_a_stereo_l(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			LOG_ERR("size a %d size b %d", size_a, size_b);
-			return -EPERM;
-		}
-		break;
-	case B_MONO_INTO_A_STEREO_R:
-		pcm_mix_b_mono_into_a_stereo_r(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
-		break;
-	default:
-		return -ESRCH;
-	};
+	ret = mix_layout_get(mix_mode, &layout);
+	if (ret) {
+		return ret;
+	}
+
+	if (size_b > (size_a / layout.a_stride)) {
+		LOG_ERR("size a %zu size b %zu", size_a, size_b);
+		return -EPERM;
+	}
+
+	if ((size_a % bytes_per_sample) || (size_b % bytes_per_sample)) {
+		LOG_ERR("Sizes must be whole %d-bit samples", pcm_bit_depth);
+		return -EINVAL;
+	}
+
+	samples_b = size_b / bytes_per_sample;
+
+	if (pcm_bit_depth == 24) {
+		pcm_mix_24(pcm_a, pcm_b, samples_b, &layout, gain_b);
+	} else if (pcm_bit_depth == 32) {
+		pcm_mix_32(pcm_a, pcm_b, samples_b, &layout, gain_b);
+	} else if (gain_b != PCM_MIX_GAIN_UNITY) {
+		pcm_mix_gain_16(pcm_a, pcm_b, samples_b, &layout, gain_b);
+	} else if (layout.a_stride == 1) {
+		pcm_mix_identical_16(pcm_a, pcm_b, samples_b);
+	} else {
+		pcm_mix_mono_into_stereo_16(pcm_a, pcm_b, samples_b, &layout);
+	}
 
 	return 0;
 }
+
+int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	    enum pcm_mix_mode mix_mode)
+{
+	return pcm_mix_ext(pcm_a, size_a, pcm_b, size_b, mix_mode, 16, PCM_MIX_GAIN_UNITY);
+}
@@ -14,25 +14,8 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
 
-/**
- * The input buffer must be able to store two samples in addition to the block size to meet
- * filter requirements.
- */
-#define INTERNAL_INPUT_BUF_NUMBER_SAMPLES                                                          \
-	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX +                                             \
-	 SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES)
-
-#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
-#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
-	(INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint16_t))
-#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
-	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint16_t))
-#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
-#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
-	(INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint32_t))
-#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
-	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint32_t))
-#endif
+/* Largest conversion ratio that buffers output samples in the ring buffer */
+#define RINGBUF_CONVERSION_RATIO_MAX 3
 
 static int validate_sample_rates(uint32_t sample_rate_input, uint32_t sample_rate_output)
 {
@@ -199,6 +182,97 @@ int sample_rate_converter_open(struct sample_rate_converter_ctx *ctx)
 	return 0;
 }
 
+/**
+ * @brief Runs the interpolation or decimation filter of the context.
+ *
+ * @param[in,out]	ctx		Pointer to the sample rate conversion context.
+ * @param[in]		input		Pointer to the input samples.
+ * @param[out]		output		Pointer to where the filtered samples will be written.
+ * @param[in]		samples		Number of input samples.
+ */
+static void filter_run(struct sample_rate_converter_ctx *ctx, const void *input, void *output,
+		       size_t samples)
+{
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	if (ctx->conversion_ratio > 0) {
+		arm_fir_interpolate_q15(&ctx->fir_interpolate_q15, (q15_t *)input, (q15_t *)output,
+					samples);
+	} else {
+		arm_fir_decimate_q15(&ctx->fir_decimate_q15, (q15_t *)input, (q15_t *)output,
+				     samples);
+	}
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	if (ctx->conversion_ratio > 0) {
+		arm_fir_interpolate_q31(&ctx->fir_interpolate_q31, (q31_t *)input, (q31_t *)output,
+					samples);
+	} else {
+		arm_fir_decimate_q31(&ctx->fir_decimate_q31, (q31_t *)input, (q31_t *)output,
+				     samples);
+	}
+#endif
+}
+
+/**
+ * @brief Interpolates input samples directly into the output ring buffer.
+ *
+ * @details The filter writes into the contiguous space claimed from the ring buffer, so the
+ *	    output samples do not need to be copied in. Only when the output of a single input
+ *	    sample wraps around the end of the ring buffer, it is put through a small bounce
+ *	    buffer.
+ *
+ * @param[in,out]	ctx			Pointer to the sample rate conversion context.
+ * @param[in]		input			Pointer to the input samples.
+ * @param[in]		samples			Number of input samples.
+ * @param[in]		bytes_per_sample	Number of bytes in each sample.
+ *
+ * @retval 0 On success.
+ * @retval -EFAULT Not enough space in the ring buffer.
+ */
+static int filter_to_ringbuf(struct sample_rate_converter_ctx *ctx, const uint8_t *input,
+			     size_t samples, size_t bytes_per_sample)
+{
+	int ret;
+	size_t output_bytes_per_sample = ctx->conversion_ratio * bytes_per_sample;
+
+	while (samples) {
+		uint8_t *data;
+		size_t ringbuf_write_size = ring_buf_put_claim(&ctx->output_ringbuf, &data,
+							       samples * output_bytes_per_sample);
+		size_t samples_to_process = ringbuf_write_size / output_bytes_per_sample;
+
+		if (samples_to_process == 0) {
+			uint8_t wrap_buf[RINGBUF_CONVERSION_RATIO_MAX * sizeof(uint32_t)];
+
+			__ASSERT_NO_MSG(output_bytes_per_sample <= sizeof(wrap_buf));
+
+			ring_buf_put_finish(&ctx->output_ringbuf, 0);
+			filter_run(ctx, input, wrap_buf, 1);
+
+			if (ring_buf_put(&ctx->output_ringbuf, wrap_buf, output_bytes_per_sample) !=
+			    output_bytes_per_sample) {
+				LOG_ERR("Ring buffer storage exhausted");
+				return -EFAULT;
+			}
+
+			samples_to_process = 1;
+		} else {
+			filter_run(ctx, input, data, samples_to_process);
+
+			ret = ring_buf_put_finish(&ctx->output_ringbuf,
+						  samples_to_process * output_bytes_per_sample);
+			if (ret) {
+				LOG_ERR("Ringbuf err: %d", ret);
+				return -EFAULT;
+			}
+		}
+
+		input += samples_to_process * bytes_per_sample;
+		samples -= samples_to_process;
+	}
+
+	return 0;
+}
+
 int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  enum sample_rate_converter_filter filter, void const *const input,
 				  size_t input_size, uint32_t sample_rate_input, void *const output,
@@ -206,12 +280,6 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  uint32_t sample_rate_output)
 {
 	int ret;
-	const uint8_t *read_ptr;
-	uint8_t *write_ptr;
-	size_t samples_to_process;
-
-	uint8_t internal_input_buf[SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE];
-	uint8_t internal_output_buf[SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE];
 
 #if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
 	size_t bytes_per_sample = sizeof(uint16_t);
@@ -266,106 +334,51 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		return -EINVAL;
 	}
 
-	if (*output_written > SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE) {
-		LOG_ERR("Conversion process will produce more bytes than the internal output "
-			"buffer can hold");
+	if (*output_written > (CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * bytes_per_sample)) {
+		LOG_ERR("Conversion process will produce more samples than the block size");
 		return -EINVAL;
 	}
 
-	if (ctx->conversion_ratio == 3) {
-		read_ptr = internal_input_buf;
-		write_ptr = internal_output_buf;
-
-		if (((samples_in + (ctx->input_buf.bytes_in_buf * bytes_per_sample)) %
-		     ctx->conversion_ratio) == 0) {
-			size_t extra_samples =
-				ctx->conversion_ratio - (samples_in % ctx->conversion_ratio);
-
-			LOG_DBG("Using %d extra samples from input buffer", extra_samples);
-			samples_to_process = samples_in + extra_samples;
-		} else {
-			size_t extra_samples = (samples_in % ctx->conversion_ratio);
-
-			LOG_DBG("Storing %d samples in input buffer for next iteration",
-				extra_samples);
-			samples_to_process = samples_in - extra_samples;
-		}
-
-		/* Merge bytes in input buffer and incoming bytes into the internal buffer
-		 * for processing
-		 */
-		memcpy(internal_input_buf, ctx->input_buf.buf, ctx->input_buf.bytes_in_buf);
-		memcpy(internal_input_buf + ctx->input_buf.bytes_in_buf, input, input_size);
-	} else {
-		write_ptr = output;
-		read_ptr = input;
-		samples_to_process = samples_in;
-	}
-
-#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
-	if (ctx->conversion_ratio > 0) {
-		arm_fir_interpolate_q15(&ctx->fir_interpolate_q15, (q15_t *)read_ptr,
-					(q15_t *)write_ptr, samples_to_process);
-	} else {
-		arm_fir_decimate_q15(&ctx->fir_decimate_q15, (q15_t *)read_ptr, (q15_t *)write_ptr,
-				     samples_to_process);
-	}
-#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
-	if (ctx->conversion_ratio > 0) {
-		arm_fir_interpolate_q31(&ctx->fir_interpolate_q31, (q31_t *)read_ptr,
-					(q31_t *)write_ptr, samples_to_process);
-	} else {
-		arm_fir_decimate_q31(&ctx->fir_decimate_q31, (q31_t *)read_ptr, (q31_t *)write_ptr,
-				     samples_to_process);
-	}
-#endif
-
 	if (ctx->conversion_ratio != 3) {
-		/* Nothing needs to be done in output buffer */
+		/* Filter straight from the input into the output */
+		filter_run(ctx, input, output, samples_in);
 		return 0;
 	}
 
-	if (samples_to_process < samples_in) {
-		size_t number_overflow_samples = samples_in - samples_to_process;
-
-		ctx->input_buf.bytes_in_buf += number_overflow_samples * bytes_per_sample;
-		memcpy(ctx->input_buf.buf, read_ptr + (samples_to_process * bytes_per_sample),
-		       ctx->input_buf.bytes_in_buf);
-		LOG_DBG("%d overflow samples stored in buffer", number_overflow_samples);
-	} else if ((ctx->input_buf.bytes_in_buf) &&
-		   (((samples_in + (ctx->input_buf.bytes_in_buf * bytes_per_sample)) %
-		     ctx->conversion_ratio) == 0)) {
-		uint8_t overflow_samples_used =
-			ctx->conversion_ratio - (samples_in % ctx->conversion_ratio);
-
-		ctx->input_buf.bytes_in_buf -= overflow_samples_used * bytes_per_sample;
-		LOG_DBG("%d overflow samples has been used", overflow_samples_used);
-	}
+	/* Only a multiple of the conversion ratio is processed, starting with the samples kept in
+	 * the input buffer. The rest is kept for the next call.
+	 */
+	size_t samples_buffered = ctx->input_buf.bytes_in_buf / bytes_per_sample;
+	size_t samples_total = samples_buffered + samples_in;
+	size_t samples_to_process = samples_total - (samples_total % ctx->conversion_ratio);
+	size_t samples_from_buf = MIN(samples_buffered, samples_to_process);
+	size_t samples_from_input = samples_to_process - samples_from_buf;
+	size_t samples_kept_in_buf = samples_buffered - samples_from_buf;
+	size_t samples_kept_from_input = samples_in - samples_from_input;
 
-	int bytes_to_write = samples_to_process * ctx->conversion_ratio * bytes_per_sample;
-	uint8_t *ringbuf_write_ptr = (uint8_t *)internal_output_buf;
+	LOG_DBG("Processing %zu buffered and %zu new samples", samples_from_buf, samples_from_input);
 
-	LOG_DBG("Writing %d bytes to output buffer", bytes_to_write);
-	while (bytes_to_write) {
-		uint8_t *data;
-		size_t ringbuf_write_size =
-			ring_buf_put_claim(&ctx->output_ringbuf, &data, bytes_to_write);
-		if (ringbuf_write_size == 0) {
-			LOG_ERR("Ring buffer storage exhausted");
-			return -EFAULT;
-		}
+	ret = filter_to_ringbuf(ctx, ctx->input_buf.buf, samples_from_buf, bytes_per_sample);
+	if (ret) {
+		return ret;
+	}
+
+	ret = filter_to_ringbuf(ctx, input, samples_from_input, bytes_per_sample);
+	if (ret) {
+		return ret;
+	}
 
-		memcpy(data, ringbuf_write_ptr, ringbuf_write_size);
+	memmove(ctx->input_buf.buf, ctx->input_buf.buf + (samples_from_buf * bytes_per_sample),
+		samples_kept_in_buf * bytes_per_sample);
+	memcpy(ctx->input_buf.buf + (samples_kept_in_buf * bytes_per_sample),
+	       (const uint8_t *)input + (samples_from_input * bytes_per_sample),
+	       samples_kept_from_input * bytes_per_sample);
+	ctx->input_buf.bytes_in_buf = (samples_kept_in_buf + samples_kept_from_input) *
+				      bytes_per_sample;
 
-		ret = ring_buf_put_finish(&ctx->output_ringbuf, ringbuf_write_size);
-		if (ret) {
-			LOG_ERR("Ringbuf err: %d", ret);
-			return -EFAULT;
-		}
+	LOG_DBG("%zu overflow samples stored in buffer",
+		samples_kept_in_buf + samples_kept_from_input);
 
-		ringbuf_write_ptr += ringbuf_write_size;
-		bytes_to_write -= ringbuf_write_size;
-	}
 	int bytes_to_read = input_size * ctx->conversion_ratio;
 	uint8_t *ringbuf_output_ptr = (uint8_t *)output;
 
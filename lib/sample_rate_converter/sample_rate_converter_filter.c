@@ -135,6 +135,321 @@ static const q31_t filter_24khz_to_48khz_32bit_simple[] = {
 #endif
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER_FILTER_SIMPLE */
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/**
+ * Prototype filter for the polyphase converter. Kaiser windowed (beta 7.5) sinc low-pass filter
+ * with the cut-off at 0.45 times the input sample rate, spanning 20 input samples. Only the
+ * right half of the symmetric filter is stored, sampled at 128 points per input sample.
+ */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+static const q15_t filter_polyphase_prototype_16bit[] = {
+	0x7333, 0x7331, 0x7329, 0x731D, 0x730C, 0x72F6, 0x72DB, 0x72BB, 0x7296, 0x726C, 0x723E,
+	0x720A, 0x71D2, 0x7195, 0x7153, 0x710D, 0x70C1, 0x7071, 0x701C, 0x6FC3, 0x6F65, 0x6F02,
+	0x6E9B, 0x6E2F, 0x6DBF, 0x6D4A, 0x6CD0, 0x6C53, 0x6BD0, 0x6B4A, 0x6ABF, 0x6A30, 0x699D,
+	0x6906, 0x686A, 0x67CA, 0x6727, 0x667F, 0x65D4, 0x6524, 0x6471, 0x63BA, 0x6300, 0x6241,
+	0x617F, 0x60BA, 0x5FF1, 0x5F25, 0x5E55, 0x5D82, 0x5CAC, 0x5BD3, 0x5AF6, 0x5A17, 0x5934,
+	0x584F, 0x5767, 0x567C, 0x558F, 0x549E, 0x53AC, 0x52B6, 0x51BF, 0x50C5, 0x4FC9, 0x4ECA,
+	0x4DCA, 0x4CC8, 0x4BC3, 0x4ABD, 0x49B5, 0x48AB, 0x47A0, 0x4693, 0x4584, 0x4474, 0x4363,
+	0x4250, 0x413D, 0x4028, 0x3F12, 0x3DFB, 0x3CE4, 0x3BCB, 0x3AB2, 0x3999, 0x387E, 0x3764,
+	0x3648, 0x352D, 0x3411, 0x32F6, 0x31DA, 0x30BE, 0x2FA2, 0x2E86, 0x2D6B, 0x2C50, 0x2B35,
+	0x2A1B, 0x2901, 0x27E8, 0x26D0, 0x25B8, 0x24A1, 0x238B, 0x2276, 0x2162, 0x2050, 0x1F3E,
+	0x1E2E, 0x1D1F, 0x1C11, 0x1B05, 0x19FA, 0x18F1, 0x17EA, 0x16E4, 0x15E0, 0x14DE, 0x13DE,
+	0x12E0, 0x11E4, 0x10E9, 0x0FF2, 0x0EFC, 0x0E08, 0x0D17, 0x0C28, 0x0B3C, 0x0A52, 0x096B,
+	0x0886, 0x07A4, 0x06C4, 0x05E7, 0x050D, 0x0436, 0x0361, 0x028F, 0x01C1, 0x00F5, 0x002C,
+	0xFF66, 0xFEA4, 0xFDE4, 0xFD28, 0xFC6E, 0xFBB8, 0xFB05, 0xFA56, 0xF9A9, 0xF900, 0xF85B,
+	0xF7B8, 0xF719, 0xF67D, 0xF5E5, 0xF550, 0xF4BF, 0xF431, 0xF3A6, 0xF31F, 0xF29C, 0xF21C,
+	0xF19F, 0xF126, 0xF0B1, 0xF03E, 0xEFD0, 0xEF65, 0xEEFE, 0xEE9A, 0xEE39, 0xEDDC, 0xED83,
+	0xED2D, 0xECDB, 0xEC8C, 0xEC40, 0xEBF8, 0xEBB4, 0xEB73, 0xEB35, 0xEAFB, 0xEAC4, 0xEA91,
+	0xEA61, 0xEA34, 0xEA0B, 0xE9E5, 0xE9C2, 0xE9A3, 0xE986, 0xE96D, 0xE957, 0xE945, 0xE935,
+	0xE929, 0xE91F, 0xE919, 0xE915, 0xE915, 0xE917, 0xE91D, 0xE925, 0xE930, 0xE93E, 0xE94E,
+	0xE962, 0xE978, 0xE990, 0xE9AB, 0xE9C9, 0xE9E9, 0xEA0C, 0xEA31, 0xEA59, 0xEA83, 0xEAAF,
+	0xEADD, 0xEB0E, 0xEB40, 0xEB75, 0xEBAC, 0xEBE5, 0xEC20, 0xEC5C, 0xEC9B, 0xECDB, 0xED1E,
+	0xED61, 0xEDA7, 0xEDEE, 0xEE37, 0xEE81, 0xEECD, 0xEF1A, 0xEF68, 0xEFB8, 0xF009, 0xF05B,
+	0xF0AE, 0xF103, 0xF158, 0xF1AF, 0xF206, 0xF25F, 0xF2B8, 0xF312, 0xF36C, 0xF3C8, 0xF424,
+	0xF481, 0xF4DE, 0xF53B, 0xF59A, 0xF5F8, 0xF657, 0xF6B6, 0xF715, 0xF775, 0xF7D5, 0xF834,
+	0xF894, 0xF8F4, 0xF954, 0xF9B4, 0xFA13, 0xFA73, 0xFAD2, 0xFB31, 0xFB90, 0xFBEE, 0xFC4C,
+	0xFCAA, 0xFD07, 0xFD63, 0xFDBF, 0xFE1B, 0xFE75, 0xFECF, 0xFF29, 0xFF81, 0xFFD9, 0x0030,
+	0x0086, 0x00DC, 0x0130, 0x0184, 0x01D6, 0x0228, 0x0278, 0x02C7, 0x0316, 0x0363, 0x03AF,
+	0x03FA, 0x0443, 0x048B, 0x04D3, 0x0518, 0x055D, 0x05A0, 0x05E2, 0x0623, 0x0662, 0x06A0,
+	0x06DC, 0x0717, 0x0750, 0x0788, 0x07BF, 0x07F4, 0x0827, 0x0859, 0x088A, 0x08B9, 0x08E6,
+	0x0912, 0x093C, 0x0965, 0x098C, 0x09B2, 0x09D6, 0x09F8, 0x0A19, 0x0A38, 0x0A56, 0x0A72,
+	0x0A8C, 0x0AA5, 0x0ABD, 0x0AD2, 0x0AE6, 0x0AF9, 0x0B0A, 0x0B19, 0x0B27, 0x0B33, 0x0B3E,
+	0x0B47, 0x0B4F, 0x0B55, 0x0B5A, 0x0B5D, 0x0B5F, 0x0B5F, 0x0B5E, 0x0B5B, 0x0B57, 0x0B51,
+	0x0B4A, 0x0B42, 0x0B38, 0x0B2D, 0x0B21, 0x0B13, 0x0B04, 0x0AF3, 0x0AE2, 0x0ACF, 0x0ABB,
+	0x0AA6, 0x0A8F, 0x0A77, 0x0A5F, 0x0A45, 0x0A2A, 0x0A0E, 0x09F1, 0x09D2, 0x09B3, 0x0993,
+	0x0972, 0x0950, 0x092D, 0x090A, 0x08E5, 0x08BF, 0x0899, 0x0872, 0x084A, 0x0822, 0x07F9,
+	0x07CF, 0x07A4, 0x0779, 0x074D, 0x0721, 0x06F4, 0x06C7, 0x0699, 0x066B, 0x063C, 0x060D,
+	0x05DD, 0x05AE, 0x057D, 0x054D, 0x051C, 0x04EB, 0x04BA, 0x0489, 0x0457, 0x0425, 0x03F4,
+	0x03C2, 0x0390, 0x035E, 0x032C, 0x02FA, 0x02C8, 0x0296, 0x0264, 0x0233, 0x0201, 0x01D0,
+	0x019F, 0x016E, 0x013D, 0x010D, 0x00DD, 0x00AD, 0x007D, 0x004E, 0x001F, 0xFFF1, 0xFFC2,
+	0xFF95, 0xFF68, 0xFF3B, 0xFF0F, 0xFEE3, 0xFEB8, 0xFE8D, 0xFE63, 0xFE39, 0xFE10, 0xFDE8,
+	0xFDC0, 0xFD99, 0xFD72, 0xFD4C, 0xFD27, 0xFD02, 0xFCDF, 0xFCBB, 0xFC99, 0xFC77, 0xFC56,
+	0xFC36, 0xFC17, 0xFBF8, 0xFBDA, 0xFBBD, 0xFBA1, 0xFB85, 0xFB6B, 0xFB51, 0xFB38, 0xFB20,
+	0xFB08, 0xFAF2, 0xFADC, 0xFAC7, 0xFAB3, 0xFAA0, 0xFA8E, 0xFA7C, 0xFA6C, 0xFA5C, 0xFA4D,
+	0xFA3F, 0xFA32, 0xFA26, 0xFA1B, 0xFA10, 0xFA06, 0xF9FE, 0xF9F6, 0xF9EF, 0xF9E8, 0xF9E3,
+	0xF9DE, 0xF9DA, 0xF9D8, 0xF9D5, 0xF9D4, 0xF9D4, 0xF9D4, 0xF9D5, 0xF9D7, 0xF9DA, 0xF9DD,
+	0xF9E1, 0xF9E6, 0xF9EC, 0xF9F2, 0xF9FA, 0xFA02, 0xFA0A, 0xFA13, 0xFA1D, 0xFA28, 0xFA34,
+	0xFA3F, 0xFA4C, 0xFA59, 0xFA67, 0xFA76, 0xFA85, 0xFA95, 0xFAA5, 0xFAB6, 0xFAC7, 0xFAD9,
+	0xFAEB, 0xFAFE, 0xFB11, 0xFB25, 0xFB39, 0xFB4E, 0xFB63, 0xFB79, 0xFB8F, 0xFBA5, 0xFBBC,
+	0xFBD3, 0xFBEA, 0xFC02, 0xFC1A, 0xFC33, 0xFC4B, 0xFC64, 0xFC7D, 0xFC97, 0xFCB0, 0xFCCA,
+	0xFCE4, 0xFCFE, 0xFD19, 0xFD33, 0xFD4E, 0xFD69, 0xFD84, 0xFD9E, 0xFDBA, 0xFDD5, 0xFDF0,
+	0xFE0B, 0xFE26, 0xFE41, 0xFE5C, 0xFE78, 0xFE93, 0xFEAE, 0xFEC9, 0xFEE4, 0xFEFE, 0xFF19,
+	0xFF34, 0xFF4E, 0xFF69, 0xFF83, 0xFF9D, 0xFFB7, 0xFFD0, 0xFFEA, 0x0003, 0x001C, 0x0035,
+	0x004D, 0x0065, 0x007D, 0x0095, 0x00AC, 0x00C4, 0x00DA, 0x00F1, 0x0107, 0x011D, 0x0132,
+	0x0148, 0x015C, 0x0171, 0x0185, 0x0199, 0x01AC, 0x01BF, 0x01D1, 0x01E4, 0x01F5, 0x0207,
+	0x0217, 0x0228, 0x0238, 0x0248, 0x0257, 0x0265, 0x0274, 0x0282, 0x028F, 0x029C, 0x02A8,
+	0x02B4, 0x02C0, 0x02CB, 0x02D6, 0x02E0, 0x02E9, 0x02F3, 0x02FB, 0x0304, 0x030B, 0x0313,
+	0x031A, 0x0320, 0x0326, 0x032B, 0x0330, 0x0335, 0x0339, 0x033D, 0x0340, 0x0343, 0x0345,
+	0x0347, 0x0348, 0x0349, 0x0349, 0x034A, 0x0349, 0x0348, 0x0347, 0x0346, 0x0343, 0x0341,
+	0x033E, 0x033B, 0x0337, 0x0333, 0x032F, 0x032A, 0x0325, 0x031F, 0x0319, 0x0313, 0x030D,
+	0x0306, 0x02FE, 0x02F7, 0x02EF, 0x02E7, 0x02DE, 0x02D5, 0x02CC, 0x02C3, 0x02B9, 0x02AF,
+	0x02A5, 0x029B, 0x0290, 0x0285, 0x027A, 0x026F, 0x0263, 0x0257, 0x024C, 0x023F, 0x0233,
+	0x0227, 0x021A, 0x020D, 0x0200, 0x01F3, 0x01E6, 0x01D8, 0x01CB, 0x01BD, 0x01B0, 0x01A2,
+	0x0194, 0x0186, 0x0178, 0x016A, 0x015C, 0x014E, 0x0140, 0x0132, 0x0123, 0x0115, 0x0107,
+	0x00F9, 0x00EB, 0x00DC, 0x00CE, 0x00C0, 0x00B2, 0x00A4, 0x0096, 0x0088, 0x007A, 0x006C,
+	0x005F, 0x0051, 0x0044, 0x0036, 0x0029, 0x001C, 0x000E, 0x0001, 0xFFF5, 0xFFE8, 0xFFDB,
+	0xFFCF, 0xFFC3, 0xFFB6, 0xFFAA, 0xFF9F, 0xFF93, 0xFF88, 0xFF7C, 0xFF71, 0xFF66, 0xFF5B,
+	0xFF51, 0xFF47, 0xFF3C, 0xFF33, 0xFF29, 0xFF1F, 0xFF16, 0xFF0D, 0xFF04, 0xFEFB, 0xFEF3,
+	0xFEEB, 0xFEE3, 0xFEDB, 0xFED3, 0xFECC, 0xFEC5, 0xFEBE, 0xFEB8, 0xFEB1, 0xFEAB, 0xFEA5,
+	0xFEA0, 0xFE9A, 0xFE95, 0xFE90, 0xFE8C, 0xFE87, 0xFE83, 0xFE7F, 0xFE7B, 0xFE78, 0xFE75,
+	0xFE72, 0xFE6F, 0xFE6C, 0xFE6A, 0xFE68, 0xFE66, 0xFE65, 0xFE63, 0xFE62, 0xFE61, 0xFE61,
+	0xFE60, 0xFE60, 0xFE60, 0xFE60, 0xFE61, 0xFE61, 0xFE62, 0xFE63, 0xFE65, 0xFE66, 0xFE68,
+	0xFE6A, 0xFE6C, 0xFE6E, 0xFE70, 0xFE73, 0xFE76, 0xFE79, 0xFE7C, 0xFE7F, 0xFE83, 0xFE86,
+	0xFE8A, 0xFE8E, 0xFE92, 0xFE96, 0xFE9B, 0xFE9F, 0xFEA4, 0xFEA8, 0xFEAD, 0xFEB2, 0xFEB8,
+	0xFEBD, 0xFEC2, 0xFEC8, 0xFECD, 0xFED3, 0xFED9, 0xFEDF, 0xFEE5, 0xFEEB, 0xFEF1, 0xFEF7,
+	0xFEFD, 0xFF03, 0xFF0A, 0xFF10, 0xFF17, 0xFF1D, 0xFF24, 0xFF2B, 0xFF31, 0xFF38, 0xFF3F,
+	0xFF45, 0xFF4C, 0xFF53, 0xFF5A, 0xFF61, 0xFF67, 0xFF6E, 0xFF75, 0xFF7C, 0xFF83, 0xFF89,
+	0xFF90, 0xFF97, 0xFF9E, 0xFFA4, 0xFFAB, 0xFFB2, 0xFFB8, 0xFFBF, 0xFFC6, 0xFFCC, 0xFFD2,
+	0xFFD9, 0xFFDF, 0xFFE6, 0xFFEC, 0xFFF2, 0xFFF8, 0xFFFE, 0x0004, 0x000A, 0x0010, 0x0015,
+	0x001B, 0x0021, 0x0026, 0x002C, 0x0031, 0x0036, 0x003B, 0x0040, 0x0045, 0x004A, 0x004F,
+	0x0053, 0x0058, 0x005C, 0x0061, 0x0065, 0x0069, 0x006D, 0x0071, 0x0075, 0x0079, 0x007C,
+	0x0080, 0x0083, 0x0087, 0x008A, 0x008D, 0x0090, 0x0092, 0x0095, 0x0098, 0x009A, 0x009D,
+	0x009F, 0x00A1, 0x00A3, 0x00A5, 0x00A7, 0x00A9, 0x00AA, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B4, 0x00B4, 0x00B5, 0x00B5, 0x00B5, 0x00B5,
+	0x00B5, 0x00B5, 0x00B5, 0x00B4, 0x00B4, 0x00B3, 0x00B3, 0x00B2, 0x00B1, 0x00B0, 0x00AF,
+	0x00AE, 0x00AD, 0x00AC, 0x00AA, 0x00A9, 0x00A8, 0x00A6, 0x00A4, 0x00A3, 0x00A1, 0x009F,
+	0x009D, 0x009C, 0x009A, 0x0098, 0x0095, 0x0093, 0x0091, 0x008F, 0x008D, 0x008A, 0x0088,
+	0x0086, 0x0083, 0x0081, 0x007E, 0x007B, 0x0079, 0x0076, 0x0074, 0x0071, 0x006E, 0x006C,
+	0x0069, 0x0066, 0x0063, 0x0060, 0x005E, 0x005B, 0x0058, 0x0055, 0x0052, 0x004F, 0x004D,
+	0x004A, 0x0047, 0x0044, 0x0041, 0x003E, 0x003B, 0x0039, 0x0036, 0x0033, 0x0030, 0x002D,
+	0x002B, 0x0028, 0x0025, 0x0022, 0x0020, 0x001D, 0x001A, 0x0018, 0x0015, 0x0013, 0x0010,
+	0x000D, 0x000B, 0x0009, 0x0006, 0x0004, 0x0001, 0xFFFF, 0xFFFD, 0xFFFA, 0xFFF8, 0xFFF6,
+	0xFFF4, 0xFFF2, 0xFFF0, 0xFFEE, 0xFFEC, 0xFFEA, 0xFFE8, 0xFFE6, 0xFFE4, 0xFFE2, 0xFFE1,
+	0xFFDF, 0xFFDD, 0xFFDC, 0xFFDA, 0xFFD9, 0xFFD7, 0xFFD6, 0xFFD4, 0xFFD3, 0xFFD2, 0xFFD0,
+	0xFFCF, 0xFFCE, 0xFFCD, 0xFFCC, 0xFFCB, 0xFFCA, 0xFFC9, 0xFFC8, 0xFFC7, 0xFFC6, 0xFFC6,
+	0xFFC5, 0xFFC4, 0xFFC4, 0xFFC3, 0xFFC3, 0xFFC2, 0xFFC2, 0xFFC1, 0xFFC1, 0xFFC1, 0xFFC0,
+	0xFFC0, 0xFFC0, 0xFFC0, 0xFFC0, 0xFFC0, 0xFFC0, 0xFFC0, 0xFFC0, 0xFFC0, 0xFFC0, 0xFFC0,
+	0xFFC0, 0xFFC0, 0xFFC1, 0xFFC1, 0xFFC1, 0xFFC2, 0xFFC2, 0xFFC2, 0xFFC3, 0xFFC3, 0xFFC4,
+	0xFFC4, 0xFFC5, 0xFFC5, 0xFFC6, 0xFFC7, 0xFFC7, 0xFFC8, 0xFFC9, 0xFFC9, 0xFFCA, 0xFFCB,
+	0xFFCB, 0xFFCC, 0xFFCD, 0xFFCE, 0xFFCF, 0xFFCF, 0xFFD0, 0xFFD1, 0xFFD2, 0xFFD3, 0xFFD4,
+	0xFFD5, 0xFFD6, 0xFFD7, 0xFFD7, 0xFFD8, 0xFFD9, 0xFFDA, 0xFFDB, 0xFFDC, 0xFFDD, 0xFFDE,
+	0xFFDF, 0xFFE0, 0xFFE1, 0xFFE2, 0xFFE3, 0xFFE4, 0xFFE5, 0xFFE6, 0xFFE7, 0xFFE8, 0xFFE9,
+	0xFFEA, 0xFFEB, 0xFFEC, 0xFFED, 0xFFED, 0xFFEE, 0xFFEF, 0xFFF0, 0xFFF1, 0xFFF2, 0xFFF3,
+	0xFFF4, 0xFFF5, 0xFFF5, 0xFFF6, 0xFFF7, 0xFFF8, 0xFFF9, 0xFFFA, 0xFFFA, 0xFFFB, 0xFFFC,
+	0xFFFD, 0xFFFD, 0xFFFE, 0xFFFF, 0xFFFF, 0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0003,
+	0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007, 0x0007, 0x0008, 0x0008, 0x0009, 0x0009,
+	0x0009, 0x000A, 0x000A, 0x000B, 0x000B, 0x000B, 0x000C, 0x000C, 0x000C, 0x000D, 0x000D,
+	0x000D, 0x000D, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000F, 0x000F, 0x000F, 0x000F,
+	0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x0010, 0x0010, 0x0010, 0x0010,
+	0x0010, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F, 0x000F,
+	0x000F, 0x000F, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000E, 0x000D, 0x000D,
+	0x000D, 0x000D, 0x000D, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x000B, 0x000B, 0x000B,
+	0x000B, 0x000B, 0x000A, 0x000A, 0x000A, 0x000A, 0x0009, 0x0009, 0x0009, 0x0009, 0x0008,
+	0x0008, 0x0008, 0x0008, 0x0008, 0x0007, 0x0007, 0x0007, 0x0007, 0x0006, 0x0006, 0x0006,
+	0x0006, 0x0006, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0004, 0x0004, 0x0004, 0x0004,
+	0x0004, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0002, 0x0002, 0x0002, 0x0002,
+	0x0002, 0x0002, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000};
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+static const q31_t filter_polyphase_prototype_32bit[] = {
+	0x73333333, 0x7330BD2A, 0x73295B41, 0x731D0E0F, 0x730BD68D, 0x72F5B61A, 0x72DAAE79,
+	0x72BAC1CE, 0x7295F2A3, 0x726C43E4, 0x723DB8E2, 0x720A554D, 0x71D21D3B, 0x71951521,
+	0x715341D7, 0x710CA895, 0x70C14EF4, 0x70713AEE, 0x701C72D9, 0x6FC2FD6D, 0x6F64E1BF,
+	0x6F022741, 0x6E9AD5C2, 0x6E2EF56C, 0x6DBE8EC5, 0x6D49AAAD, 0x6CD0525E, 0x6C528F69,
+	0x6BD06BB8, 0x6B49F18A, 0x6ABF2B76, 0x6A302466, 0x699CE796, 0x69058098, 0x6869FB4C,
+	0x67CA63E4, 0x6726C6E2, 0x667F3112, 0x65D3AF90, 0x65244FC2, 0x64711F58, 0x63BA2C4B,
+	0x62FF84DB, 0x6241378E, 0x617F532E, 0x60B9E6C9, 0x5FF101AE, 0x5F24B36D, 0x5E550BD3,
+	0x5D821AED, 0x5CABF101, 0x5BD29E91, 0x5AF63456, 0x5A16C340, 0x59345C75, 0x584F1150,
+	0x5766F35B, 0x567C1453, 0x558E8621, 0x549E5ADE, 0x53ABA4CC, 0x52B67657, 0x51BEE214,
+	0x50C4FABC, 0x4FC8D32E, 0x4ECA7E6A, 0x4DCA0F92, 0x4CC799E6, 0x4BC330C3, 0x4ABCE7A2,
+	0x49B4D215, 0x48AB03C6, 0x479F9073, 0x46928BF0, 0x45840A22, 0x44741EFF, 0x4362DE8B,
+	0x42505CD5, 0x413CADFA, 0x4027E61D, 0x3F121968, 0x3DFB5C0B, 0x3CE3C23A, 0x3BCB6029,
+	0x3AB24A0B, 0x39989413, 0x387E526D, 0x37639942, 0x36487CB1, 0x352D10D0, 0x341169A9,
+	0x32F59B3A, 0x31D9B970, 0x30BDD82A, 0x2FA20B31, 0x2E86663C, 0x2D6AFCEC, 0x2C4FE2C8,
+	0x2B352B40, 0x2A1AE9A6, 0x29013131, 0x27E814F8, 0x26CFA7F3, 0x25B7FCF7, 0x24A126B5,
+	0x238B37B9, 0x2276426A, 0x21625904, 0x204F8D9A, 0x1F3DF213, 0x1E2D9829, 0x1D1E9169,
+	0x1C10EF2E, 0x1B04C2A3, 0x19FA1CBF, 0x18F10E45, 0x17E9A7C2, 0x16E3F98C, 0x15E013C3,
+	0x14DE064A, 0x13DDE0CA, 0x12DFB2B1, 0x11E38B2E, 0x10E97933, 0x0FF18B72, 0x0EFBD05A,
+	0x0E08561A, 0x0D172A9E, 0x0C285B8C, 0x0B3BF648, 0x0A5207EC, 0x096A9D4E, 0x0885C2FA,
+	0x07A38534, 0x06C3EFF6, 0x05E70EF0, 0x050CED85, 0x043596CD, 0x03611593, 0x028F7454,
+	0x01C0BD3E, 0x00F4FA32, 0x002C34BF, 0xFF667627, 0xFEA3C757, 0xFDE430EF, 0xFD27BB3B,
+	0xFC6E6E36, 0xFBB85187, 0xFB056C84, 0xFA55C62F, 0xF9A96536, 0xF9004FF4, 0xF85A8C70,
+	0xF7B8205D, 0xF7191119, 0xF67D63AD, 0xF5E51CCF, 0xF55040E0, 0xF4BED3EC, 0xF430D9AA,
+	0xF3A6557D, 0xF31F4A73, 0xF29BBB46, 0xF21BAA5C, 0xF19F19C6, 0xF1260B42, 0xF0B0803A,
+	0xF03E79C5, 0xEFCFF8A7, 0xEF64FD4F, 0xEEFD87DD, 0xEE99981E, 0xEE392D8C, 0xEDDC4752,
+	0xED82E449, 0xED2D02FB, 0xECDAA1A1, 0xEC8BBE26, 0xEC405629, 0xEBF866F7, 0xEBB3ED93,
+	0xEB72E6B4, 0xEB354EC3, 0xEAFB21E0, 0xEAC45BE1, 0xEA90F853, 0xEA60F27A, 0xEA344553,
+	0xEA0AEB93, 0xE9E4DFAB, 0xE9C21BC7, 0xE9A299CF, 0xE9865368, 0xE96D41F5, 0xE9575E99,
+	0xE944A236, 0xE9350571, 0xE92880B0, 0xE91F0C1E, 0xE9189FA9, 0xE9153306, 0xE914BDB0,
+	0xE91736EB, 0xE91C95C5, 0xE924D116, 0xE92FDF80, 0xE93DB775, 0xE94E4F34, 0xE9619CCB,
+	0xE977961A, 0xE99030D4, 0xE9AB627D, 0xE9C92070, 0xE9E95FDD, 0xEA0C15CD, 0xEA313722,
+	0xEA58B895, 0xEA828EBF, 0xEAAEAE14, 0xEADD0AE6, 0xEB0D9969, 0xEB404DAF, 0xEB751BB1,
+	0xEBABF749, 0xEBE4D437, 0xEC1FA622, 0xEC5C609B, 0xEC9AF71B, 0xECDB5D08, 0xED1D85B2,
+	0xED61645B, 0xEDA6EC30, 0xEDEE1054, 0xEE36C3D9, 0xEE80F9C7, 0xEECCA518, 0xEF19B8C2,
+	0xEF6827AE, 0xEFB7E4C1, 0xF008E2DD, 0xF05B14DC, 0xF0AE6D9A, 0xF102DFEF, 0xF1585EB7,
+	0xF1AEDCCB, 0xF2064D0D, 0xF25EA261, 0xF2B7CFB0, 0xF311C7EB, 0xF36C7E0F, 0xF3C7E51F,
+	0xF423F02A, 0xF480924E, 0xF4DDBEB4, 0xF53B6897, 0xF5998341, 0xF5F8020E, 0xF656D86C,
+	0xF6B5F9DF, 0xF71559FF, 0xF774EC7A, 0xF7D4A519, 0xF83477B9, 0xF8945855, 0xF8F43B01,
+	0xF95413EE, 0xF9B3D769, 0xFA1379E0, 0xFA72EFDD, 0xFAD22E0D, 0xFB31293D, 0xFB8FD65C,
+	0xFBEE2A7E, 0xFC4C1ADA, 0xFCA99CCC, 0xFD06A5D6, 0xFD632BA2, 0xFDBF2400, 0xFE1A84EA,
+	0xFE754483, 0xFECF5917, 0xFF28B91F, 0xFF815B3E, 0xFFD93643, 0x0030412C, 0x00867322,
+	0x00DBC380, 0x013029CB, 0x01839DBB, 0x01D61738, 0x02278E59, 0x0277FB67, 0x02C756DD,
+	0x03159966, 0x0362BBE3, 0x03AEB764, 0x03F98530, 0x04431EBE, 0x048B7DBD, 0x04D29C0C,
+	0x051873C1, 0x055CFF28, 0x05A038BF, 0x05E21B3C, 0x0622A189, 0x0661C6C6, 0x069F8649,
+	0x06DBDB9D, 0x0716C284, 0x075036F5, 0x0788351F, 0x07BEB965, 0x07F3C060, 0x082746E1,
+	0x085949EE, 0x0889C6C2, 0x08B8BACE, 0x08E623B9, 0x0911FF61, 0x093C4BD6, 0x09650760,
+	0x098C307A, 0x09B1C5D5, 0x09D5C656, 0x09F83114, 0x0A19055E, 0x0A3842B2, 0x0A55E8C4,
+	0x0A71F77A, 0x0A8C6EEA, 0x0AA54F60, 0x0ABC9957, 0x0AD24D7A, 0x0AE66CA6, 0x0AF8F7E9,
+	0x0B09F07E, 0x0B1957D0, 0x0B272F7A, 0x0B337943, 0x0B3E371E, 0x0B476B2F, 0x0B4F17C1,
+	0x0B553F4F, 0x0B59E47B, 0x0B5D0A13, 0x0B5EB30E, 0x0B5EE28D, 0x0B5D9BD6, 0x0B5AE25A,
+	0x0B56B9AD, 0x0B51258C, 0x0B4A29D7, 0x0B41CA93, 0x0B380BE8, 0x0B2CF222, 0x0B2081AD,
+	0x0B12BF18, 0x0B03AF11, 0x0AF35666, 0x0AE1BA04, 0x0ACEDEF4, 0x0ABACA5E, 0x0AA58185,
+	0x0A8F09C8, 0x0A77689F, 0x0A5EA39C, 0x0A44C06A, 0x0A29C4CA, 0x0A0DB697, 0x09F09BBE,
+	0x09D27A44, 0x09B3583F, 0x09933BDB, 0x09722B55, 0x09502CFB, 0x092D472B, 0x09098053,
+	0x08E4DEF0, 0x08BF698D, 0x089926BE, 0x08721D28, 0x084A5377, 0x0821D063, 0x07F89AAB,
+	0x07CEB918, 0x07A4327A, 0x07790DA5, 0x074D5176, 0x072104CC, 0x06F42E8A, 0x06C6D595,
+	0x069900D5, 0x066AB733, 0x063BFF98, 0x060CE0EB, 0x05DD6212, 0x05AD89F1, 0x057D5F68,
+	0x054CE953, 0x051C2E89, 0x04EB35DC, 0x04BA0616, 0x0488A5F9, 0x04571C41, 0x04256FA0,
+	0x03F3A6BD, 0x03C1C836, 0x038FDA9E, 0x035DE479, 0x032BEC43, 0x02F9F865, 0x02C80F3F,
+	0x0296371F, 0x02647644, 0x0232D2DE, 0x02015309, 0x01CFFCD4, 0x019ED639, 0x016DE51F,
+	0x013D2F5B, 0x010CBAAD, 0x00DC8CC2, 0x00ACAB30, 0x007D1B78, 0x004DE307, 0x001F0730,
+	0xFFF08D31, 0xFFC27A30, 0xFF94D33B, 0xFF679D47, 0xFF3ADD30, 0xFF0E97B9, 0xFEE2D18B,
+	0xFEB78F36, 0xFE8CD52D, 0xFE62A7CB, 0xFE390B4D, 0xFE1003D6, 0xFDE7956D, 0xFDBFC3FC,
+	0xFD989353, 0xFD720722, 0xFD4C22FE, 0xFD26EA5E, 0xFD02609C, 0xFCDE88F6, 0xFCBB6689,
+	0xFC98FC57, 0xFC774D42, 0xFC565C0F, 0xFC362B63, 0xFC16BDC8, 0xFBF815A6, 0xFBDA3548,
+	0xFBBD1EDB, 0xFBA0D46B, 0xFB8557E9, 0xFB6AAB24, 0xFB50CFCE, 0xFB37C77A, 0xFB1F939D,
+	0xFB08358D, 0xFAF1AE81, 0xFADBFF93, 0xFAC729BD, 0xFAB32DDC, 0xFAA00CB0, 0xFA8DC6D9,
+	0xFA7C5CDB, 0xFA6BCF1C, 0xFA5C1DE3, 0xFA4D495C, 0xFA3F5197, 0xFA323683, 0xFA25F7F7,
+	0xFA1A95AC, 0xFA100F3F, 0xFA066431, 0xF9FD93E8, 0xF9F59DB0, 0xF9EE80B8, 0xF9E83C16,
+	0xF9E2CEC6, 0xF9DE37A9, 0xF9DA7589, 0xF9D78714, 0xF9D56AE1, 0xF9D41F6E, 0xF9D3A323,
+	0xF9D3F44D, 0xF9D51126, 0xF9D6F7CD, 0xF9D9A64D, 0xF9DD1A9D, 0xF9E1529B, 0xF9E64C13,
+	0xF9EC04BA, 0xF9F27A34, 0xF9F9AA0E, 0xFA0191C5, 0xFA0A2EC1, 0xFA137E5A, 0xFA1D7DD5,
+	0xFA282A67, 0xFA338134, 0xFA3F7F4E, 0xFA4C21BB, 0xFA59656F, 0xFA674751, 0xFA75C439,
+	0xFA84D8F3, 0xFA94823D, 0xFAA4BCC8, 0xFAB5853B, 0xFAC6D830, 0xFAD8B236, 0xFAEB0FD3,
+	0xFAFDED82, 0xFB1147B7, 0xFB251ADB, 0xFB396350, 0xFB4E1D6F, 0xFB63458D, 0xFB78D7F5,
+	0xFB8ED0F0, 0xFBA52CBD, 0xFBBBE799, 0xFBD2FDBE, 0xFBEA6B5E, 0xFC022CAB, 0xFC1A3DD3,
+	0xFC329B03, 0xFC4B4065, 0xFC642A21, 0xFC7D5462, 0xFC96BB4E, 0xFCB05B10, 0xFCCA2FD0,
+	0xFCE435BA, 0xFCFE68FA, 0xFD18C5C0, 0xFD33483E, 0xFD4DECA9, 0xFD68AF3A, 0xFD838C2F,
+	0xFD9E7FCA, 0xFDB98652, 0xFDD49C14, 0xFDEFBD63, 0xFE0AE698, 0xFE261415, 0xFE41423F,
+	0xFE5C6D88, 0xFE779267, 0xFE92AD5B, 0xFEADBAEF, 0xFEC8B7B4, 0xFEE3A048, 0xFEFE714F,
+	0xFF19277C, 0xFF33BF89, 0xFF4E363D, 0xFF68886C, 0xFF82B2F1, 0xFF9CB2B9, 0xFFB684B9,
+	0xFFD025F5, 0xFFE9937D, 0x0002CA6F, 0x001BC7F5, 0x0034894A, 0x004D0BB3, 0x00654C88,
+	0x007D492B, 0x0094FF0F, 0x00AC6BB7, 0x00C38CB4, 0x00DA5FA5, 0x00F0E23B, 0x01071236,
+	0x011CED66, 0x013271AA, 0x01479CF2, 0x015C6D40, 0x0170E0A4, 0x0184F540, 0x0198A945,
+	0x01ABFAF8, 0x01BEE8AD, 0x01D170C8, 0x01E391BF, 0x01F54A1B, 0x02069874, 0x02177B73,
+	0x0227F1D3, 0x0237FA61, 0x024793FA, 0x0256BD8D, 0x0265761B, 0x0273BCB4, 0x0281907C,
+	0x028EF0A5, 0x029BDC77, 0x02A85346, 0x02B4547A, 0x02BFDF8B, 0x02CAF402, 0x02D5917B,
+	0x02DFB79E, 0x02E96629, 0x02F29CE7, 0x02FB5BB4, 0x0303A27D, 0x030B7140, 0x0312C809,
+	0x0319A6F5, 0x03200E31, 0x0325FDF8, 0x032B7698, 0x0330786A, 0x033503D9, 0x0339195D,
+	0x033CB97E, 0x033FE4D1, 0x03429BFC, 0x0344DFB0, 0x0346B0AE, 0x03480FC3, 0x0348FDCB,
+	0x03497BAE, 0x03498A61, 0x03492AE6, 0x03485E4B, 0x034725AC, 0x0345822F, 0x03437505,
+	0x0340FF6D, 0x033E22AF, 0x033AE01F, 0x0337391B, 0x03332F0B, 0x032EC362, 0x0329F79D,
+	0x0324CD40, 0x031F45DB, 0x03196306, 0x03132661, 0x030C9194, 0x0305A650, 0x02FE664D,
+	0x02F6D34C, 0x02EEEF12, 0x02E6BB6D, 0x02DE3A32, 0x02D56D3A, 0x02CC5665, 0x02C2F799,
+	0x02B952C0, 0x02AF69CB, 0x02A53EAD, 0x029AD360, 0x029029DF, 0x0285442C, 0x027A2449,
+	0x026ECC3E, 0x02633E15, 0x02577BD9, 0x024B8799, 0x023F6365, 0x0233114E, 0x02269368,
+	0x0219EBC7, 0x020D1C80, 0x020027A7, 0x01F30F52, 0x01E5D596, 0x01D87C88, 0x01CB063B,
+	0x01BD74C3, 0x01AFCA30, 0x01A20894, 0x019431FD, 0x01864875, 0x01784E09, 0x016A44BE,
+	0x015C2E99, 0x014E0D9B, 0x013FE3C2, 0x0131B309, 0x01237D66, 0x011544CB, 0x01070B27,
+	0x00F8D262, 0x00EA9C63, 0x00DC6B08, 0x00CE402C, 0x00C01DA6, 0x00B20543, 0x00A3F8CF,
+	0x0095FA0E, 0x00880ABC, 0x007A2C92, 0x006C6141, 0x005EAA73, 0x005109CB, 0x004380E6,
+	0x00361158, 0x0028BCB1, 0x001B8476, 0x000E6A25, 0x00016F37, 0xFFF4951A, 0xFFE7DD35,
+	0xFFDB48E8, 0xFFCED989, 0xFFC29067, 0xFFB66EC8, 0xFFAA75E9, 0xFF9EA6FF, 0xFF930336,
+	0xFF878BB2, 0xFF7C418D, 0xFF7125D9, 0xFF66399E, 0xFF5B7DDC, 0xFF50F389, 0xFF469B92,
+	0xFF3C76DC, 0xFF328641, 0xFF28CA92, 0xFF1F4498, 0xFF15F512, 0xFF0CDCB6, 0xFF03FC2F,
+	0xFEFB5421, 0xFEF2E525, 0xFEEAAFCB, 0xFEE2B49B, 0xFEDAF412, 0xFED36EA4, 0xFECC24BC,
+	0xFEC516BD, 0xFEBE4500, 0xFEB7AFD2, 0xFEB1577C, 0xFEAB3C3A, 0xFEA55E41, 0xFE9FBDBD,
+	0xFE9A5ACF, 0xFE953592, 0xFE904E17, 0xFE8BA465, 0xFE87387E, 0xFE830A57, 0xFE7F19E1,
+	0xFE7B6701, 0xFE77F197, 0xFE74B977, 0xFE71BE71, 0xFE6F004A, 0xFE6C7EC2, 0xFE6A398E,
+	0xFE68305F, 0xFE6662DC, 0xFE64D0A5, 0xFE637953, 0xFE625C79, 0xFE6179A2, 0xFE60D052,
+	0xFE606007, 0xFE602838, 0xFE602855, 0xFE605FC9, 0xFE60CDF9, 0xFE617243, 0xFE624BFF,
+	0xFE635A80, 0xFE649D13, 0xFE661301, 0xFE67BB8C, 0xFE6995F1, 0xFE6BA16A, 0xFE6DDD2B,
+	0xFE704863, 0xFE72E23D, 0xFE75A9DF, 0xFE789E6D, 0xFE7BBF06, 0xFE7F0AC3, 0xFE8280BD,
+	0xFE862007, 0xFE89E7B3, 0xFE8DD6CD, 0xFE91EC60, 0xFE962774, 0xFE9A870E, 0xFE9F0A31,
+	0xFEA3AFDE, 0xFEA87712, 0xFEAD5ECA, 0xFEB26601, 0xFEB78BAF, 0xFEBCCECD, 0xFEC22E50,
+	0xFEC7A92D, 0xFECD3E59, 0xFED2ECC6, 0xFED8B367, 0xFEDE912E, 0xFEE4850E, 0xFEEA8DF6,
+	0xFEF0AADA, 0xFEF6DAAA, 0xFEFD1C58, 0xFF036ED6, 0xFF09D117, 0xFF10420F, 0xFF16C0B1,
+	0xFF1D4BF4, 0xFF23E2CC, 0xFF2A8432, 0xFF312F1F, 0xFF37E28C, 0xFF3E9D77, 0xFF455EDD,
+	0xFF4C25BD, 0xFF52F11A, 0xFF59BFF8, 0xFF60915B, 0xFF67644E, 0xFF6E37DB, 0xFF750B0F,
+	0xFF7BDCFB, 0xFF82ACB1, 0xFF897949, 0xFF9041DB, 0xFF970582, 0xFF9DC35F, 0xFFA47A94,
+	0xFFAB2A46, 0xFFB1D1A0, 0xFFB86FCE, 0xFFBF0401, 0xFFC58D6D, 0xFFCC0B4B, 0xFFD27CD6,
+	0xFFD8E14F, 0xFFDF37F8, 0xFFE5801A, 0xFFEBB902, 0xFFF1E1FF, 0xFFF7FA65, 0xFFFE018E,
+	0x0003F6D6, 0x0009D99F, 0x000FA94F, 0x00156550, 0x001B0D0F, 0x0020A002, 0x00261D9F,
+	0x002B8563, 0x0030D6CE, 0x00361167, 0x003B34B7, 0x0040404E, 0x004533BE, 0x004A0EA0,
+	0x004ED090, 0x00537931, 0x00580828, 0x005C7D21, 0x0060D7CA, 0x006517D9, 0x00693D05,
+	0x006D470E, 0x007135B4, 0x007508BE, 0x0078BFF8, 0x007C5B33, 0x007FDA42, 0x00833CFF,
+	0x00868347, 0x0089ACFC, 0x008CBA05, 0x008FAA4D, 0x00927DC2, 0x00953459, 0x0097CE0A,
+	0x009A4AD0, 0x009CAAAC, 0x009EEDA3, 0x00A113BC, 0x00A31D05, 0x00A5098D, 0x00A6D96A,
+	0x00A88CB4, 0x00AA2387, 0x00AB9E04, 0x00ACFC4D, 0x00AE3E8A, 0x00AF64E5, 0x00B06F8F,
+	0x00B15EB7, 0x00B23294, 0x00B2EB5D, 0x00B3894F, 0x00B40CA8, 0x00B475AB, 0x00B4C49C,
+	0x00B4F9C3, 0x00B5156C, 0x00B517E2, 0x00B50178, 0x00B4D27F, 0x00B48B4E, 0x00B42C3B,
+	0x00B3B5A2, 0x00B327DF, 0x00B28351, 0x00B1C858, 0x00B0F758, 0x00B010B7, 0x00AF14DA,
+	0x00AE042B, 0x00ACDF13, 0x00ABA601, 0x00AA5960, 0x00A8F9A1, 0x00A78733, 0x00A60289,
+	0x00A46C17, 0x00A2C450, 0x00A10BAA, 0x009F429B, 0x009D699B, 0x009B8123, 0x009989AA,
+	0x009783AA, 0x00956F9F, 0x00934E02, 0x00911F4F, 0x008EE402, 0x008C9C96, 0x008A4987,
+	0x0087EB52, 0x00858272, 0x00830F65, 0x008092A6, 0x007E0CB2, 0x007B7E03, 0x0078E717,
+	0x00764867, 0x0073A26E, 0x0070F5A7, 0x006E428C, 0x006B8995, 0x0068CB3A, 0x006607F4,
+	0x00634038, 0x0060747E, 0x005DA539, 0x005AD2DE, 0x0057FDDF, 0x005526AE, 0x00524DBD,
+	0x004F737A, 0x004C9853, 0x0049BCB6, 0x0046E10D, 0x004405C3, 0x00412B41, 0x003E51ED,
+	0x003B7A2D, 0x0038A466, 0x0035D0F9, 0x00330048, 0x003032B0, 0x002D6891, 0x002AA245,
+	0x0027E026, 0x0025228B, 0x002269CC, 0x001FB63C, 0x001D082D, 0x001A5FF1, 0x0017BDD4,
+	0x00152225, 0x00128D2C, 0x000FFF34, 0x000D7881, 0x000AF958, 0x000881FC, 0x000612AD,
+	0x0003ABA9, 0x00014D2C, 0xFFFEF76F, 0xFFFCAAAB, 0xFFFA6716, 0xFFF82CE2, 0xFFF5FC41,
+	0xFFF3D563, 0xFFF1B875, 0xFFEFA5A1, 0xFFED9D11, 0xFFEB9EEB, 0xFFE9AB55, 0xFFE7C26F,
+	0xFFE5E45C, 0xFFE41139, 0xFFE24922, 0xFFE08C33, 0xFFDEDA81, 0xFFDD3425, 0xFFDB9932,
+	0xFFDA09B9, 0xFFD885CB, 0xFFD70D75, 0xFFD5A0C5, 0xFFD43FC3, 0xFFD2EA77, 0xFFD1A0E9,
+	0xFFD0631C, 0xFFCF3113, 0xFFCE0ACF, 0xFFCCF04D, 0xFFCBE18B, 0xFFCADE85, 0xFFC9E734,
+	0xFFC8FB8F, 0xFFC81B8D, 0xFFC74722, 0xFFC67E40, 0xFFC5C0DA, 0xFFC50EDE, 0xFFC4683C,
+	0xFFC3CCDE, 0xFFC33CB1, 0xFFC2B79F, 0xFFC23D8F, 0xFFC1CE68, 0xFFC16A11, 0xFFC1106D,
+	0xFFC0C160, 0xFFC07CCB, 0xFFC0428F, 0xFFC0128B, 0xFFBFEC9E, 0xFFBFD0A6, 0xFFBFBE7D,
+	0xFFBFB601, 0xFFBFB70A, 0xFFBFC173, 0xFFBFD513, 0xFFBFF1C3, 0xFFC01759, 0xFFC045AA,
+	0xFFC07C8E, 0xFFC0BBD7, 0xFFC1035A, 0xFFC152EA, 0xFFC1AA5A, 0xFFC2097B, 0xFFC27021,
+	0xFFC2DE1A, 0xFFC35339, 0xFFC3CF4D, 0xFFC45226, 0xFFC4DB95, 0xFFC56B67, 0xFFC6016C,
+	0xFFC69D73, 0xFFC73F4B, 0xFFC7E6C1, 0xFFC893A4, 0xFFC945C2, 0xFFC9FCEA, 0xFFCAB8E8,
+	0xFFCB798C, 0xFFCC3EA4, 0xFFCD07FD, 0xFFCDD566, 0xFFCEA6AD, 0xFFCF7BA2, 0xFFD05412,
+	0xFFD12FCC, 0xFFD20EA1, 0xFFD2F05F, 0xFFD3D4D6, 0xFFD4BBD6, 0xFFD5A531, 0xFFD690B5,
+	0xFFD77E36, 0xFFD86D85, 0xFFD95E73, 0xFFDA50D3, 0xFFDB4479, 0xFFDC3939, 0xFFDD2EE5,
+	0xFFDE2554, 0xFFDF1C5A, 0xFFE013CD, 0xFFE10B85, 0xFFE20357, 0xFFE2FB1D, 0xFFE3F2AD,
+	0xFFE4E9E3, 0xFFE5E097, 0xFFE6D6A4, 0xFFE7CBE6, 0xFFE8C038, 0xFFE9B377, 0xFFEAA582,
+	0xFFEB9636, 0xFFEC8573, 0xFFED7318, 0xFFEE5F06, 0xFFEF491F, 0xFFF03146, 0xFFF1175D,
+	0xFFF1FB49, 0xFFF2DCEE, 0xFFF3BC32, 0xFFF498FC, 0xFFF57334, 0xFFF64AC1, 0xFFF71F8D,
+	0xFFF7F181, 0xFFF8C08A, 0xFFF98C91, 0xFFFA5585, 0xFFFB1B53, 0xFFFBDDE8, 0xFFFC9D34,
+	0xFFFD5928, 0xFFFE11B3, 0xFFFEC6C8, 0xFFFF785A, 0x0000265C, 0x0000D0C1, 0x00017780,
+	0x00021A8E, 0x0002B9E1, 0x00035572, 0x0003ED39, 0x0004812F, 0x0005114E, 0x00059D90,
+	0x000625F1, 0x0006AA6E, 0x00072B03, 0x0007A7AE, 0x0008206E, 0x00089542, 0x00090629,
+	0x00097324, 0x0009DC35, 0x000A415E, 0x000AA2A0, 0x000B0000, 0x000B5981, 0x000BAF28,
+	0x000C00FA, 0x000C4EFC, 0x000C9935, 0x000CDFAB, 0x000D2267, 0x000D616F, 0x000D9CCD,
+	0x000DD48A, 0x000E08AE, 0x000E3944, 0x000E6655, 0x000E8FEE, 0x000EB619, 0x000ED8E2,
+	0x000EF855, 0x000F147E, 0x000F2D6A, 0x000F4326, 0x000F55C0, 0x000F6546, 0x000F71C6,
+	0x000F7B4D, 0x000F81EC, 0x000F85B0, 0x000F86AA, 0x000F84E7, 0x000F8079, 0x000F796E,
+	0x000F6FD8, 0x000F63C5, 0x000F5546, 0x000F446D, 0x000F3149, 0x000F1BEB, 0x000F0463,
+	0x000EEAC4, 0x000ECF1D, 0x000EB17F, 0x000E91FD, 0x000E70A6, 0x000E4D8B, 0x000E28BF,
+	0x000E0251, 0x000DDA54, 0x000DB0D7, 0x000D85EB, 0x000D59A3, 0x000D2C0E, 0x000CFD3C,
+	0x000CCD40, 0x000C9C29, 0x000C6A07, 0x000C36EB, 0x000C02E5, 0x000BCE04, 0x000B9859,
+	0x000B61F4, 0x000B2AE3, 0x000AF336, 0x000ABAFC, 0x000A8244, 0x000A491C, 0x000A0F94,
+	0x0009D5B8, 0x00099B98, 0x00096140, 0x000926BF, 0x0008EC21, 0x0008B173, 0x000876C3,
+	0x00083C1D, 0x0008018C, 0x0007C71D, 0x00078CDC, 0x000752D3, 0x0007190D, 0x0006DF96,
+	0x0006A678, 0x00066DBD, 0x0006356F, 0x0005FD97, 0x0005C63E, 0x00058F6E, 0x0005592F,
+	0x0005238A, 0x0004EE86, 0x0004BA2B, 0x00048680, 0x0004538D, 0x00042158, 0x0003EFE7,
+	0x0003BF42, 0x00038F6C, 0x0003606D, 0x00033249, 0x00030505, 0x0002D8A5, 0x0002AD2E,
+	0x000282A4, 0x0002590B, 0x00023065, 0x000208B6, 0x0001E201, 0x0001BC48, 0x0001978E,
+	0x000173D3, 0x0001511B, 0x00012F66, 0x00010EB5, 0x0000EF0A, 0x0000D065, 0x0000B2C5,
+	0x0000962C, 0x00007A99, 0x0000600C, 0x00004684, 0x00002E00, 0x0000167F, 0x00000000};
+#endif
+BUILD_ASSERT(SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS ==
+	     2 * SAMPLE_RATE_CONVERTER_FILTER_POLYPHASE_HALF_LENGTH);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 enum filter_conversion_ratio {
 	CONVERSION_48KHZ_TO_16KHZ = -3,
 	CONVERSION_48KHZ_TO_24KHZ = -2,
@@ -301,3 +616,21 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
 	return 0;
 }
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+int sample_rate_converter_filter_polyphase_get(void const **filter_ptr, size_t *filter_size)
+{
+	__ASSERT(filter_ptr != NULL, "Filter pointer cannot be NULL");
+	__ASSERT(filter_size != NULL, "Filter size pointer cannot be NULL");
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	*filter_ptr = filter_polyphase_prototype_16bit;
+	*filter_size = ARRAY_SIZE(filter_polyphase_prototype_16bit);
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	*filter_ptr = filter_polyphase_prototype_32bit;
+	*filter_size = ARRAY_SIZE(filter_polyphase_prototype_32bit);
+#endif
+
+	return 0;
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
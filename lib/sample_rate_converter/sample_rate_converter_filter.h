@@ -24,4 +24,23 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 				     int conversion_ratio, void const **filter_ptr,
 				     size_t *filter_size);
 
+/** Number of input samples spanned by each half of the polyphase prototype filter. */
+#define SAMPLE_RATE_CONVERTER_FILTER_POLYPHASE_HALF_LENGTH 10
+
+/** Number of prototype filter coefficients per input sample. */
+#define SAMPLE_RATE_CONVERTER_FILTER_POLYPHASE_OVERSAMPLING 128
+
+/**
+ * @brief Get the pointer to the prototype filter for the polyphase converter.
+ *
+ * @details The prototype filter is symmetric, only the coefficients from the center and out are
+ *	    given. The last coefficient is zero.
+ *
+ * @param[out]	filter_ptr	Pointer to the filter coefficients.
+ * @param[out]	filter_size	Number of filter coefficients.
+ *
+ * @retval	0	On success.
+ */
+int sample_rate_converter_filter_polyphase_get(void const **filter_ptr, size_t *filter_size);
+
 #endif /* _SAMPLE_RATE_CONVERTER_FILTER_H_ */
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sample_rate_converter.h"
+#include "sample_rate_converter_filter.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(sample_rate_converter_polyphase, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef q15_t sample_t;
+/* Coefficients are stored in Q15 format */
+#define COEFF_FRAC_BITS	    15
+#define PROTOTYPE_FRAC_BITS 15
+#define SAMPLE_MAX	    INT16_MAX
+#define SAMPLE_MIN	    INT16_MIN
+#define CTX_COEFFS(ctx)	    ((ctx)->coeffs_15)
+#define CTX_HISTORY(ctx)    ((ctx)->history_15)
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef q31_t sample_t;
+/* Coefficients are stored in Q30 format, so that the sum of a full phase cannot overflow the
+ * 64-bit accumulator.
+ */
+#define COEFF_FRAC_BITS	    30
+#define PROTOTYPE_FRAC_BITS 31
+#define SAMPLE_MAX	    INT32_MAX
+#define SAMPLE_MIN	    INT32_MIN
+#define CTX_COEFFS(ctx)	    ((ctx)->coeffs_31)
+#define CTX_HISTORY(ctx)    ((ctx)->history_31)
+#endif
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+	while (b != 0) {
+		uint32_t tmp = a % b;
+
+		a = b;
+		b = tmp;
+	}
+
+	return a;
+}
+
+/**
+ * @brief Evaluates the prototype filter by linear interpolation between its coefficients.
+ *
+ * @param[in]	prototype	Pointer to the prototype filter coefficients.
+ * @param[in]	prototype_size	Number of prototype filter coefficients.
+ * @param[in]	num		Numerator of the position, in prototype coefficient steps.
+ * @param[in]	den		Denominator of the position.
+ *
+ * @return Prototype filter value at the position.
+ */
+static int64_t prototype_value_get(const sample_t *prototype, size_t prototype_size, uint64_t num,
+				   uint32_t den)
+{
+	uint64_t index = num / den;
+	uint32_t frac = num % den;
+
+	if (index >= (prototype_size - 1)) {
+		return 0;
+	}
+
+	return prototype[index] +
+	       (((int64_t)prototype[index + 1] - prototype[index]) * frac) / (int64_t)den;
+}
+
+/**
+ * @brief Calculates the filter coefficients for all phases of the conversion.
+ *
+ * @details The coefficient for tap k of phase p is the prototype filter evaluated at
+ *	    (taps / 2 - 1 - k + p / interpolation) input samples from its center. When
+ *	    downsampling, the prototype is stretched by decimation / interpolation to move the
+ *	    cut-off below the output Nyquist frequency. Each phase is normalized to unity gain
+ *	    to avoid a gain ripple between phases.
+ */
+static void coeffs_calculate(struct sample_rate_converter_poly_ctx *ctx,
+			     const sample_t *prototype, size_t prototype_size)
+{
+	sample_t *coeffs = CTX_COEFFS(ctx);
+	uint32_t den = MAX(ctx->interpolation, ctx->decimation);
+
+	for (uint16_t phase = 0; phase < ctx->interpolation; phase++) {
+		sample_t *phase_coeffs = &coeffs[phase * ctx->taps];
+		int64_t sum = 0;
+		uint16_t peak = 0;
+
+		for (uint16_t tap = 0; tap < ctx->taps; tap++) {
+			int64_t pos = ((int64_t)ctx->taps / 2 - 1 - tap) * ctx->interpolation + phase;
+			int64_t value = prototype_value_get(
+				prototype, prototype_size,
+				(uint64_t)(pos < 0 ? -pos : pos) *
+					SAMPLE_RATE_CONVERTER_FILTER_POLYPHASE_OVERSAMPLING,
+				den);
+
+			if (ctx->decimation > ctx->interpolation) {
+				value = (value * ctx->interpolation) / ctx->decimation;
+			}
+
+			value >>= (PROTOTYPE_FRAC_BITS - COEFF_FRAC_BITS);
+			phase_coeffs[tap] = (sample_t)value;
+			sum += value;
+
+			if (value > phase_coeffs[peak]) {
+				peak = tap;
+			}
+		}
+
+		phase_coeffs[peak] += (sample_t)(BIT64(COEFF_FRAC_BITS) - sum);
+	}
+}
+
+static inline sample_t saturate(int64_t acc)
+{
+	return (sample_t)CLAMP(acc >> COEFF_FRAC_BITS, SAMPLE_MIN, SAMPLE_MAX);
+}
+
+int sample_rate_converter_poly_open(struct sample_rate_converter_poly_ctx *ctx,
+				    uint32_t sample_rate_input, uint32_t sample_rate_output,
+				    uint8_t channels)
+{
+	int ret;
+	uint32_t divisor;
+	uint32_t interpolation;
+	uint32_t decimation;
+	uint32_t taps;
+	const sample_t *prototype;
+	size_t prototype_size;
+
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if ((channels == 0) || (channels > CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_CHANNELS_MAX)) {
+		LOG_ERR("Invalid number of channels: %d", channels);
+		return -EINVAL;
+	}
+
+	if ((sample_rate_input == 0) || (sample_rate_output == 0)) {
+		LOG_ERR("Sample rates cannot be 0");
+		return -EINVAL;
+	}
+
+	if (sample_rate_input == sample_rate_output) {
+		LOG_ERR("Input and out sample rates are the same");
+		return -EINVAL;
+	}
+
+	divisor = gcd(sample_rate_input, sample_rate_output);
+	interpolation = sample_rate_output / divisor;
+	decimation = sample_rate_input / divisor;
+
+	if (decimation > (interpolation * SAMPLE_RATE_CONVERTER_POLYPHASE_DECIMATION_MAX)) {
+		LOG_ERR("Downsampling from %d to %d is not supported", sample_rate_input,
+			sample_rate_output);
+		return -EINVAL;
+	}
+
+	if (decimation > interpolation) {
+		taps = 2 * DIV_ROUND_UP(SAMPLE_RATE_CONVERTER_FILTER_POLYPHASE_HALF_LENGTH *
+						decimation,
+					interpolation);
+	} else {
+		taps = SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS;
+	}
+
+	if ((interpolation > UINT16_MAX) || (decimation > UINT16_MAX) ||
+	    ((interpolation * taps) > CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_COEFFS_MAX)) {
+		LOG_ERR("Conversion from %d to %d needs %d phases of %d coefficients",
+			sample_rate_input, sample_rate_output, interpolation, taps);
+		return -EINVAL;
+	}
+
+	ret = sample_rate_converter_filter_polyphase_get((void const **)&prototype,
+							 &prototype_size);
+	if (ret) {
+		LOG_ERR("Failed to get filter (%d)", ret);
+		return ret;
+	}
+
+	memset(ctx, 0, sizeof(struct sample_rate_converter_poly_ctx));
+
+	ctx->sample_rate_input = sample_rate_input;
+	ctx->sample_rate_output = sample_rate_output;
+	ctx->channels = channels;
+	ctx->interpolation = interpolation;
+	ctx->decimation = decimation;
+	ctx->taps = taps;
+
+	coeffs_calculate(ctx, prototype, prototype_size);
+
+	LOG_DBG("Polyphase converter initialized. Input sample rate: %d, Output sample rate: %d, "
+		"ratio: %d/%d, taps: %d, channels: %d",
+		sample_rate_input, sample_rate_output, interpolation, decimation, taps, channels);
+
+	return 0;
+}
+
+/**
+ * @brief Calculates one output frame from input frames that are all in the input buffer.
+ */
+static inline void frame_filter(const sample_t *input, const sample_t *coeffs, uint16_t taps,
+				uint8_t channels, sample_t *output)
+{
+	for (uint8_t ch = 0; ch < channels; ch++) {
+		const sample_t *x = &input[ch];
+		int64_t acc = 0;
+
+		for (uint16_t tap = 0; tap < taps; tap++) {
+			acc += (int64_t)x[tap * channels] * coeffs[tap];
+		}
+
+		output[ch] = saturate(acc);
+	}
+}
+
+/**
+ * @brief Calculates one output frame from input frames that start in the history.
+ *
+ * @param[in]	first	Index of the oldest input frame used, this is negative.
+ */
+static void frame_filter_history(const sample_t *history, const sample_t *input, int32_t first,
+				 const sample_t *coeffs, uint16_t taps, uint8_t channels,
+				 sample_t *output)
+{
+	int32_t history_frames = taps - 1;
+
+	for (uint8_t ch = 0; ch < channels; ch++) {
+		int64_t acc = 0;
+
+		for (uint16_t tap = 0; tap < taps; tap++) {
+			int32_t frame = first + tap;
+			sample_t x;
+
+			if (frame < 0) {
+				x = history[(history_frames + frame) * channels + ch];
+			} else {
+				x = input[frame * channels + ch];
+			}
+
+			acc += (int64_t)x * coeffs[tap];
+		}
+
+		output[ch] = saturate(acc);
+	}
+}
+
+int sample_rate_converter_poly_process(struct sample_rate_converter_poly_ctx *ctx,
+				       void const *const input, size_t input_size,
+				       void *const output, size_t output_size,
+				       size_t *output_written)
+{
+	if ((ctx == NULL) || (input == NULL) || (output == NULL) || (output_written == NULL)) {
+		LOG_ERR("Null pointer received");
+		return -EINVAL;
+	}
+
+	if (ctx->channels == 0) {
+		LOG_ERR("Context has not been opened");
+		return -EINVAL;
+	}
+
+	size_t frame_size = ctx->channels * sizeof(sample_t);
+
+	if (input_size % frame_size != 0) {
+		LOG_ERR("Size of input is not a multiple of the frame size");
+		return -EINVAL;
+	}
+
+	const sample_t *in = input;
+	sample_t *out = output;
+	const sample_t *coeffs = CTX_COEFFS(ctx);
+	sample_t *history = CTX_HISTORY(ctx);
+	size_t frames_in = input_size / frame_size;
+	size_t history_frames = ctx->taps - 1;
+	uint64_t pos = (uint64_t)ctx->frame_index * ctx->interpolation + ctx->phase;
+	uint64_t end = (uint64_t)frames_in * ctx->interpolation;
+	size_t frames_out = (end > pos) ? DIV_ROUND_UP(end - pos, ctx->decimation) : 0;
+
+	if ((frames_out * frame_size) > output_size) {
+		LOG_ERR("Conversion process will produce more bytes than the output buffer can "
+			"hold");
+		return -EINVAL;
+	}
+
+	uint32_t index = ctx->frame_index;
+	uint32_t phase = ctx->phase;
+
+	for (size_t i = 0; i < frames_out; i++) {
+		int32_t first = (int32_t)index - (int32_t)history_frames;
+		const sample_t *phase_coeffs = &coeffs[phase * ctx->taps];
+
+		if (first >= 0) {
+			frame_filter(&in[first * ctx->channels], phase_coeffs, ctx->taps,
+				     ctx->channels, out);
+		} else {
+			frame_filter_history(history, in, first, phase_coeffs, ctx->taps,
+					     ctx->channels, out);
+		}
+
+		out += ctx->channels;
+		phase += ctx->decimation;
+		index += phase / ctx->interpolation;
+		phase %= ctx->interpolation;
+	}
+
+	ctx->frame_index = index - frames_in;
+	ctx->phase = phase;
+
+	/* Keep the newest input frames for the next call */
+	if (frames_in >= history_frames) {
+		memcpy(history, &in[(frames_in - history_frames) * ctx->channels],
+		       history_frames * frame_size);
+	} else if (frames_in > 0) {
+		memmove(history, &history[frames_in * ctx->channels],
+			(history_frames - frames_in) * frame_size);
+		memcpy(&history[(history_frames - frames_in) * ctx->channels], in,
+		       frames_in * frame_size);
+	}
+
+	*output_written = frames_out * frame_size;
+
+	return 0;
+}
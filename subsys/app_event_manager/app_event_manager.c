@@ -23,6 +23,20 @@ static K_WORK_DEFINE(event_processor, event_processor_fn);
 static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
 static struct k_spinlock lock;
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_QUEUE)
+static sys_slist_t eventq_high_prio = SYS_SLIST_STATIC_INIT(&eventq_high_prio);
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_WORKQUEUE_DEDICATED)
+static K_THREAD_STACK_DEFINE(event_processor_stack_area,
+			     CONFIG_APP_EVENT_MANAGER_WORKQUEUE_STACK_SIZE);
+static struct k_work_q event_processor_work_q;
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB)
+static atomic_t slab_fallback_cnt[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+#endif
+
 static bool log_is_event_displayed(const struct event_type *et)
 {
 	size_t idx = et - _event_type_list_start;
@@ -76,26 +90,20 @@ static void log_event(const struct app_event_header *aeh)
 	}
 }
 
-static void log_event_progress(const struct event_type *et,
-			       const struct event_listener *el)
+static bool log_is_event_handlers_displayed(const struct event_type *et)
 {
-	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENTS) ||
-	    !IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) ||
-	    !log_is_event_displayed(et)) {
-		return;
-	}
+	return IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENTS) &&
+	       IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) &&
+	       log_is_event_displayed(et);
+}
 
+static void log_event_progress(const struct event_listener *el)
+{
 	LOG_INF("|\tnotifying %s", el->name);
 }
 
-static void log_event_consumed(const struct event_type *et)
+static void log_event_consumed(void)
 {
-	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENTS) ||
-	    !IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS) ||
-	    !log_is_event_displayed(et)) {
-		return;
-	}
-
 	LOG_INF("|\tevent consumed");
 }
 
@@ -134,73 +142,218 @@ void * __weak app_event_manager_alloc(size_t size)
 
 void __weak app_event_manager_free(void *addr)
 {
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB)
+	if (app_event_manager_slab_free(addr)) {
+		return;
+	}
+#endif
+
 	k_free(addr);
 }
 
-static void event_processor_fn(struct k_work *work)
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB)
+static bool slab_contains(const struct k_mem_slab *slab, const void *addr)
 {
-	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+	const char *start = slab->buffer;
+	const char *end = start + (slab->info.block_size * slab->info.num_blocks);
 
-	/* Make current event list local. */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	return ((const char *)addr >= start) && ((const char *)addr < end);
+}
 
-	if (sys_slist_is_empty(&eventq)) {
-		k_spin_unlock(&lock, key);
-		return;
+void *_app_event_manager_slab_alloc(const struct event_type *et, size_t size)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	if (!et->slab) {
+		return app_event_manager_alloc(size);
 	}
 
-	sys_slist_merge_slist(&events, &eventq);
+	void *event;
 
-	k_spin_unlock(&lock, key);
+	if ((size <= et->slab->info.block_size) &&
+	    !k_mem_slab_alloc(et->slab, &event, K_NO_WAIT)) {
+		return event;
+	}
 
-	/* Traverse the list of events. */
-	sys_snode_t *node;
-	while (NULL != (node = sys_slist_get(&events))) {
-		struct app_event_header *aeh = CONTAINER_OF(node,
-						       struct app_event_header,
-						       node);
+	atomic_inc(&slab_fallback_cnt[et - _event_type_list_start]);
 
-		APP_EVENT_ASSERT_ID(aeh->type_id);
+	return app_event_manager_alloc(size);
+}
 
-		const struct event_type *et = aeh->type_id;
+bool app_event_manager_slab_free(void *addr)
+{
+	const struct app_event_header *aeh = addr;
+	const struct event_type *et = aeh->type_id;
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
-				h->hook(aeh);
-			}
+	/* Memory allocated with app_event_manager_alloc may not hold a valid event type. */
+	if ((et < _event_type_list_start) || (et >= _event_type_list_end) || !et->slab ||
+	    !slab_contains(et->slab, addr)) {
+		return false;
+	}
+
+	k_mem_slab_free(et->slab, addr);
+
+	return true;
+}
+
+static int event_slabs_init(void)
+{
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct k_mem_slab *slab = et->slab;
+		int err;
+
+		if (!slab) {
+			continue;
 		}
 
-		log_event(aeh);
+		/* Until the slab is initialized, its free list is empty and events are allocated
+		 * using app_event_manager_alloc.
+		 */
+		err = k_mem_slab_init(slab, slab->buffer, slab->info.block_size,
+				      slab->info.num_blocks);
+		if (err) {
+			LOG_ERR("Cannot initialize memory slab of %s (err %d)", et->name, err);
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+int app_event_manager_slab_stats_get(const struct event_type *et,
+				     struct app_event_manager_slab_stats *stats)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	if (!et->slab) {
+		return -ENOENT;
+	}
 
-		bool consumed = false;
+	stats->block_size = et->slab->info.block_size;
+	stats->num_blocks = et->slab->info.num_blocks;
+	stats->num_used = k_mem_slab_num_used_get(et->slab);
+	stats->max_used = k_mem_slab_max_used_get(et->slab);
+	stats->fallback_cnt = atomic_get(&slab_fallback_cnt[et - _event_type_list_start]);
 
-		for (const struct event_subscriber *es = et->subs_start;
-		     (es != et->subs_stop) && !consumed;
-		     es++) {
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_SLAB */
 
-			__ASSERT_NO_MSG(es != NULL);
+static void event_notify(const struct app_event_header *aeh)
+{
+	const struct event_type *et = aeh->type_id;
+	/* The logging conditions are checked once per event, not for every listener. */
+	const bool log_handlers = log_is_event_handlers_displayed(et);
 
-			const struct event_listener *el = es->listener;
+	for (const struct event_subscriber *es = et->subs_start;
+	     es != et->subs_stop;
+	     es++) {
 
-			__ASSERT_NO_MSG(el != NULL);
-			__ASSERT_NO_MSG(el->notification != NULL);
+		__ASSERT_NO_MSG(es != NULL);
 
-			log_event_progress(et, el);
+		const struct event_listener *el = es->listener;
 
-			consumed = el->notification(aeh);
+		__ASSERT_NO_MSG(el != NULL);
+		__ASSERT_NO_MSG(el->notification != NULL);
 
-			if (consumed) {
-				log_event_consumed(et);
-			}
+		if (log_handlers) {
+			log_event_progress(el);
 		}
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
-				h->hook(aeh);
+		if (el->notification(aeh)) {
+			if (log_handlers) {
+				log_event_consumed();
 			}
+			break;
+		}
+	}
+}
+
+static void event_process(struct app_event_header *aeh)
+{
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+			h->hook(aeh);
 		}
+	}
+
+	log_event(aeh);
+
+	event_notify(aeh);
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+	app_event_manager_free(aeh);
+}
 
-		app_event_manager_free(aeh);
+static sys_snode_t *high_prio_event_get(void)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_QUEUE)
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	sys_snode_t *node = sys_slist_get(&eventq_high_prio);
+
+	k_spin_unlock(&lock, key);
+
+	return node;
+#else
+	return NULL;
+#endif
+}
+
+static sys_slist_t *event_queue_get(const struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_QUEUE)
+	if (app_event_get_type_flag(aeh->type_id, APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY)) {
+		return &eventq_high_prio;
+	}
+#endif
+
+	return &eventq;
+}
+
+static void event_processor_submit(void)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_WORKQUEUE_DEDICATED)
+	k_work_submit_to_queue(&event_processor_work_q, &event_processor);
+#else
+	k_work_submit(&event_processor);
+#endif
+}
+
+static void event_processor_fn(struct k_work *work)
+{
+	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+
+	/* Make current event list local. */
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	sys_slist_merge_slist(&events, &eventq);
+
+	k_spin_unlock(&lock, key);
+
+	/* Traverse the list of events. High priority events submitted in the
+	 * meantime are processed before the next normal priority event.
+	 */
+	sys_snode_t *node;
+
+	while (true) {
+		node = high_prio_event_get();
+
+		if (!node) {
+			node = sys_slist_get(&events);
+		}
+
+		if (!node) {
+			break;
+		}
+
+		event_process(CONTAINER_OF(node, struct app_event_header, node));
 	}
 }
 
@@ -216,10 +369,10 @@ void _event_submit(struct app_event_header *aeh)
 			h->hook(aeh);
 		}
 	}
-	sys_slist_append(&eventq, &aeh->node);
+	sys_slist_append(event_queue_get(aeh), &aeh->node);
 	k_spin_unlock(&lock, key);
 
-	k_work_submit(&event_processor);
+	event_processor_submit();
 }
 
 int app_event_manager_init(void)
@@ -231,6 +384,23 @@ int app_event_manager_init(void)
 
 	log_event_init();
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB)
+	ret = event_slabs_init();
+	if (ret) {
+		return ret;
+	}
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_WORKQUEUE_DEDICATED)
+	k_work_queue_start(&event_processor_work_q, event_processor_stack_area,
+			   K_THREAD_STACK_SIZEOF(event_processor_stack_area),
+			   CONFIG_APP_EVENT_MANAGER_WORKQUEUE_PRIORITY, NULL);
+	k_thread_name_set(&event_processor_work_q.thread, "app_event_manager");
+
+	/* Process events that were submitted before the work queue was started. */
+	event_processor_submit();
+#endif
+
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK)) {
 		STRUCT_SECTION_FOREACH(app_event_manager_postinit_hook, h) {
 			ret = h->hook();
@@ -119,6 +119,16 @@ extern "C" {
 #define _EVENT_ID(ename) (&_CONCAT(__event_type_, ename))
 
 
+/* Allocate memory for an event of the given ename type. Events are taken
+ * from the memory slab of the event type if slab allocation is enabled.
+ */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB)
+#define _APP_EVENT_ALLOC(ename, size) _app_event_manager_slab_alloc(_EVENT_ID(ename), (size))
+#else
+#define _APP_EVENT_ALLOC(ename, size) app_event_manager_alloc(size)
+#endif
+
+
 /* Macro generates a function of name new_ename where ename is provided as
  * an argument. Allocator function is used to create an event of the given
  * ename type.
@@ -127,7 +137,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(void)			\
 	{									\
 		struct ename *event =						\
-			(struct ename *)app_event_manager_alloc(sizeof(*event));\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event));\
 		BUILD_ASSERT(offsetof(struct ename, header) == 0,		\
 				 "");						\
 		if (event != NULL) {						\
@@ -145,7 +155,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(size_t size)			\
 	{										\
 		struct ename *event =							\
-			(struct ename *)app_event_manager_alloc(sizeof(*event) + size);	\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event) + size);	\
 		BUILD_ASSERT((offsetof(struct ename, dyndata) +				\
 				  sizeof(event->dyndata.size)) ==			\
 				 sizeof(*event), "");					\
@@ -219,6 +229,36 @@ extern "C" {
 #define _APP_EVENT_TYPE_DEFINE_SIZES(ename)
 #endif
 
+/* Every event type without dynamic data gets a memory slab with blocks matching the event
+ * structure size. Event types with dynamic data are always allocated using
+ * app_event_manager_alloc. Whether an event type has dynamic data is not known to the
+ * preprocessor, so the slab and its buffer are static objects that are only referenced for
+ * event types without dynamic data. For other event types, they are discarded by the compiler.
+ * The slabs are not placed in the k_mem_slab iterable section and are initialized by
+ * app_event_manager_init.
+ */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB)
+#define _APP_EVENT_SLAB_NAME(ename) _CONCAT(__event_slab_, ename)
+#define _APP_EVENT_SLAB_BUF_NAME(ename) _CONCAT(__event_slab_buf_, ename)
+
+#define _APP_EVENT_TYPE_DEFINE_SLAB_OBJ(ename)						\
+	static char __noinit __aligned(WB_UP(__alignof(struct ename))) __unused		\
+		_APP_EVENT_SLAB_BUF_NAME(ename)[_CONCAT(ename, _HAS_DYNDATA) ? 0 :	\
+			(WB_UP(sizeof(struct ename)) *					\
+			 CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_BLOCK_CNT)];		\
+	static struct k_mem_slab __unused _APP_EVENT_SLAB_NAME(ename) =			\
+		Z_MEM_SLAB_INITIALIZER(_APP_EVENT_SLAB_NAME(ename),			\
+				       _APP_EVENT_SLAB_BUF_NAME(ename),			\
+				       WB_UP(sizeof(struct ename)),			\
+				       CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_BLOCK_CNT);
+
+#define _APP_EVENT_TYPE_DEFINE_SLAB(ename)						\
+	.slab = (_CONCAT(ename, _HAS_DYNDATA) ? NULL : &_APP_EVENT_SLAB_NAME(ename)),
+#else
+#define _APP_EVENT_TYPE_DEFINE_SLAB_OBJ(ename)
+#define _APP_EVENT_TYPE_DEFINE_SLAB(ename)
+#endif
+
 /** @brief Event header.
  *
  * When defining an event structure, the application event header
@@ -292,6 +332,11 @@ struct event_type {
 	/** The size of the event structure */
 	uint16_t struct_size;
 #endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB)
+	/** Memory slab used to allocate events of this type. */
+	struct k_mem_slab *slab;
+#endif
 };
 
 
@@ -304,6 +349,7 @@ extern struct event_type _event_type_list_end[];
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START))<<					\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START)) == 0);				\
 	_APP_EVENT_SUBSCRIBERS_ARRAY_TAGS(ename);					\
+	_APP_EVENT_TYPE_DEFINE_SLAB_OBJ(ename) /* No semicolon here intentionally */	\
 	STRUCT_SECTION_ITERABLE(event_type, _CONCAT(__event_type_, ename)) = {		\
 		.name            = STRINGIFY(ename),					\
 		.subs_start      = _APP_EVENT_SUBSCRIBERS_START_TAG(ename),		\
@@ -315,6 +361,7 @@ extern struct event_type _event_type_list_end[];
 				((et_flags) | BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) :	\
 				((et_flags) & (~BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)))),\
 		_APP_EVENT_TYPE_DEFINE_SIZES(ename) /* No comma here intentionally */	\
+		_APP_EVENT_TYPE_DEFINE_SLAB(ename) /* No comma here intentionally */	\
 	}
 
 /**
@@ -433,6 +480,17 @@ struct event_postprocess_hook {
  */
 void _event_submit(struct app_event_header *aeh);
 
+/** @brief Allocate an event of the given type.
+ *
+ * The event is allocated from the memory slab of the event type. If the slab is
+ * exhausted or the event type has no slab, @ref app_event_manager_alloc is used.
+ *
+ * @param et    Pointer to the event type.
+ * @param size  Size of the event (in bytes).
+ * @retval Address of the allocated memory if successful, otherwise NULL.
+ */
+void *_app_event_manager_slab_alloc(const struct event_type *et, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -81,6 +81,34 @@ static int show_subscribers(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB)
+static int show_slabs(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Event memory slabs:\n");
+
+	for (const struct event_type *et = _event_type_list_start;
+	     (et != NULL) && (et != _event_type_list_end); et++) {
+
+		struct app_event_manager_slab_stats stats;
+		size_t ev_id = et - _event_type_list_start;
+
+		if (app_event_manager_slab_stats_get(et, &stats)) {
+			shell_fprintf(shell, SHELL_NORMAL,
+				      "%zu:\t%s\tno slab\n", ev_id, et->name);
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "%zu:\t%s\tblock: %zu B, used: %u/%u, peak: %u, fallback: %u\n",
+			      ev_id, et->name, stats.block_size, stats.num_used,
+			      stats.num_blocks, stats.max_used, stats.fallback_cnt);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_SLAB */
+
 static void set_event_displaying(const struct shell *shell, size_t argc,
 				 char **argv, bool enable)
 {
@@ -155,6 +183,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB)
+	SHELL_CMD_ARG(show_slabs, NULL, "Show event memory slab usage",
+		      show_slabs, 0, 0),
+#endif
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
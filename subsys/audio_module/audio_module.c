@@ -126,7 +126,12 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 		return false;
 	}
 
-	if (parameters->thread.stack == NULL || parameters->thread.stack_size == 0) {
+	if (parameters->thread.fused) {
+		/* An input module generates audio data within its own thread. */
+		if (parameters->description->type == AUDIO_MODULE_TYPE_INPUT) {
+			return false;
+		}
+	} else if (parameters->thread.stack == NULL || parameters->thread.stack_size == 0) {
 		return false;
 	}
 
@@ -160,6 +165,9 @@ static void audio_data_release_cb(struct audio_module_handle_private *handle,
 	}
 }
 
+static int fused_data_process(struct audio_module_handle *handle,
+			      struct audio_data const *const audio_data, bool owned);
+
 /**
  * @brief Send an audio data item to a module, all data is consumed by the module.
  *
@@ -178,6 +186,21 @@ static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_ha
 	int ret;
 	struct audio_module_message *data_msg_rx;
 
+	if (rx_handle->thread.fused) {
+		ret = fused_data_process(rx_handle, audio_data, false);
+		if (ret) {
+			LOG_ERR("Data process error in module %s, ret %d", rx_handle->name, ret);
+		}
+
+		/* As in the module threads, the audio data is consumed even if processing failed. */
+		if (data_in_response_cb != NULL) {
+			data_in_response_cb((struct audio_module_handle_private *)tx_handle,
+					    audio_data);
+		}
+
+		return 0;
+	}
+
 	if (rx_handle->state == AUDIO_MODULE_STATE_RUNNING) {
 		ret = data_fifo_pointer_first_vacant_get(rx_handle->thread.msg_rx,
 							 (void **)&data_msg_rx, K_NO_WAIT);
@@ -284,6 +307,42 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 		return 0;
 	}
 
+	/* A single fused destination is run directly, the audio data is handed over without
+	 * counting the receivers or queuing a message.
+	 */
+	if (handle->dest_count == 1 && !handle->use_tx_queue) {
+		ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
+		if (ret) {
+			LOG_ERR("Failed to take MUTEX lock in time");
+			return ret;
+		}
+
+		handle_to = SYS_SLIST_PEEK_HEAD_CONTAINER(&handle->handle_dest_list, handle_to,
+							  node);
+
+		ret = k_mutex_unlock(&handle->dest_mutex);
+		if (ret) {
+			LOG_ERR("Failed to release MUTEX");
+			return ret;
+		}
+
+		if (handle_to != NULL && handle_to->thread.fused) {
+			ret = fused_data_process(handle_to, audio_data,
+						 handle_to->thread.data_slab ==
+							 handle->thread.data_slab);
+			if (ret < 0) {
+				LOG_ERR("Data process error in module %s, ret %d", handle_to->name,
+					ret);
+			}
+
+			if (ret <= 0) {
+				k_mem_slab_free(handle->thread.data_slab, (void *)audio_data->data);
+			}
+
+			return 0;
+		}
+	}
+
 	/* We need to ensure that all receiving modules have got the audio data.
 	 * This is so the first receiver cannot free the audio data before all receivers
 	 * have all gotten the audio data.
@@ -343,6 +402,97 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 	return 0;
 }
 
+/**
+ * @brief Run the data process function of a fused module.
+ *
+ * @note A fused module can be sent audio data from several threads, by several modules or by
+ *       the application. The calls are serialized, as the module's context is not thread safe.
+ *
+ * @param handle          [in/out]  The handle for the fused module instance.
+ * @param audio_data_in   [in]      Pointer to the input audio data.
+ * @param audio_data_out  [out]     Pointer to the output audio data, can be NULL.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int fused_module_data_process(struct audio_module_handle *handle,
+				     struct audio_data const *const audio_data_in,
+				     struct audio_data *audio_data_out)
+{
+	int ret;
+
+	(void)k_mutex_lock(&handle->fused_mutex, K_FOREVER);
+
+	ret = handle->description->functions->data_process(
+		(struct audio_module_handle_private *)handle, audio_data_in, audio_data_out);
+
+	(void)k_mutex_unlock(&handle->fused_mutex);
+
+	return ret;
+}
+
+/**
+ * @brief Process audio data in a fused module, in the thread of the sender, and send the result
+ *        on to the module's destinations.
+ *
+ * @param handle      [in/out]  The handle for the fused module instance.
+ * @param audio_data  [in]      Pointer to the audio data to process.
+ * @param owned       [in]      Flag to indicate that the module is the only receiver of the audio
+ *                              data and that the buffer is taken from the module's data slab.
+ *
+ * @return 1 if the buffer of the audio data was passed on and must not be released by the sender,
+ *         0 if successful, error otherwise.
+ */
+static int fused_data_process(struct audio_module_handle *handle,
+			      struct audio_data const *const audio_data, bool owned)
+{
+	int ret;
+	struct audio_data audio_data_out;
+	void *data = NULL;
+
+	if (handle->state != AUDIO_MODULE_STATE_RUNNING) {
+		LOG_WRN("Receiving module %s is in an invalid state %d", handle->name,
+			handle->state);
+		return -ECANCELED;
+	}
+
+	if (handle->description->type == AUDIO_MODULE_TYPE_OUTPUT) {
+		return fused_module_data_process(handle, audio_data, NULL);
+	}
+
+	/* Only a buffer that is not shared can be written to and passed on. */
+	if (owned && handle->description->data_in_place) {
+		memcpy(&audio_data_out, audio_data, sizeof(struct audio_data));
+
+		ret = fused_module_data_process(handle, audio_data, &audio_data_out);
+		if (ret) {
+			return ret;
+		}
+
+		send_to_connected_modules(handle, &audio_data_out);
+
+		return 1;
+	}
+
+	ret = k_mem_slab_alloc(handle->thread.data_slab, (void **)&data, K_NO_WAIT);
+	if (ret) {
+		LOG_ERR("No free data buffer for module %s, ret %d", handle->name, ret);
+		return ret;
+	}
+
+	audio_data_out.data = data;
+	audio_data_out.data_size = handle->thread.data_size;
+
+	ret = fused_module_data_process(handle, audio_data, &audio_data_out);
+	if (ret) {
+		k_mem_slab_free(handle->thread.data_slab, data);
+		return ret;
+	}
+
+	send_to_connected_modules(handle, &audio_data_out);
+
+	return 0;
+}
+
 /**
  * @brief The thread that receives data from outside (e.g. the system and passes it into the audio
  *        system.
@@ -639,6 +789,16 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 	sys_slist_init(&handle->handle_dest_list);
 	k_mutex_init(&handle->dest_mutex);
 
+	if (handle->thread.fused) {
+		k_mutex_init(&handle->fused_mutex);
+
+		handle->state = AUDIO_MODULE_STATE_CONFIGURED;
+
+		LOG_DBG("Module %s runs in the thread of the sending module", handle->name);
+
+		return 0;
+	}
+
 	handle->thread_id = k_thread_create(
 		&handle->thread_data, handle->thread.stack, handle->thread.stack_size, thread_entry,
 		(void *)handle, NULL, NULL, K_PRIO_PREEMPT(handle->thread.priority), 0, K_FOREVER);
@@ -698,7 +858,9 @@ int audio_module_close(struct audio_module_handle *handle)
 	 *       Test the semaphore and wait for it to be zero.
 	 */
 
-	k_thread_abort(handle->thread_id);
+	if (!handle->thread.fused) {
+		k_thread_abort(handle->thread_id);
+	}
 
 	/* Ensure module handle data is fully cleared. */
 	memset(handle, 0, sizeof(struct audio_module_handle));
@@ -1037,7 +1199,7 @@ int audio_module_data_tx(struct audio_module_handle *handle,
 		return -ECANCELED;
 	}
 
-	if (handle->thread.msg_rx == NULL) {
+	if (handle->thread.msg_rx == NULL && !handle->thread.fused) {
 		LOG_ERR("Module %s has message queue set to NULL", handle->name);
 		return -ECANCELED;
 	}
@@ -1153,7 +1315,8 @@ int audio_module_data_tx_rx(struct audio_module_handle *handle_tx,
 		return -EINVAL;
 	}
 
-	if (handle_tx->thread.msg_rx == NULL || handle_rx->thread.msg_tx == NULL) {
+	if ((handle_tx->thread.msg_rx == NULL && !handle_tx->thread.fused) ||
+	    handle_rx->thread.msg_tx == NULL) {
 		LOG_ERR("Modules have message queue set to NULL");
 		return -EINVAL;
 	}
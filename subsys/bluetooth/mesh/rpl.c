@@ -18,10 +18,56 @@ LOG_MODULE_REGISTER(bt_mesh_rpl);
 #include <mesh/rpl.h>
 #include <emds/emds.h>
 
+#define RPL_INDEX_SIZE	(2 * CONFIG_BT_MESH_CRPL)
+#define RPL_INDEX_EMPTY UINT16_MAX
+
 static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 
 EMDS_STATIC_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list, sizeof(replay_list));
 
+/* The replay list is stored as is in EMDS, so the source addresses are indexed by a separate
+ * open addressing hash table in RAM. Entries are the replay list slot of the address. The
+ * used slots are always at the start of the replay list, so the index is only rebuilt when
+ * the replay list is cleared, compacted or restored from EMDS.
+ */
+static uint16_t rpl_index[RPL_INDEX_SIZE];
+/* Number of used slots in the replay list */
+static uint16_t rpl_count;
+static bool rpl_index_valid;
+
+static inline size_t rpl_hash(uint16_t addr)
+{
+	/* Multiplicative hashing spreads the sequential unicast addresses of a network */
+	return (((uint32_t)addr * 2654435761U) >> 16) % RPL_INDEX_SIZE;
+}
+
+static uint16_t *rpl_index_slot(uint16_t addr)
+{
+	size_t i = rpl_hash(addr);
+
+	/* The index is never more than half full, so there always is an empty entry */
+	while (rpl_index[i] != RPL_INDEX_EMPTY && replay_list[rpl_index[i]].src != addr) {
+		i = (i + 1) % RPL_INDEX_SIZE;
+	}
+
+	return &rpl_index[i];
+}
+
+static void rpl_index_build(void)
+{
+	(void)memset(rpl_index, 0xff, sizeof(rpl_index));
+
+	for (rpl_count = 0; rpl_count < ARRAY_SIZE(replay_list); rpl_count++) {
+		if (!replay_list[rpl_count].src) {
+			break;
+		}
+
+		*rpl_index_slot(replay_list[rpl_count].src) = rpl_count;
+	}
+
+	rpl_index_valid = true;
+}
+
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
 {
@@ -32,6 +78,17 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
+	if (rpl_index_valid && rpl->src != rx->ctx.addr) {
+		uint16_t slot = rpl - replay_list;
+
+		if (!rpl->src && slot == rpl_count) {
+			*rpl_index_slot(rx->ctx.addr) = slot;
+			rpl_count++;
+		} else {
+			rpl_index_valid = false;
+		}
+	}
+
 	rpl->src = rx->ctx.addr;
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
@@ -45,7 +102,8 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match, bool bridge)
 {
-	int i;
+	struct bt_mesh_rpl *rpl;
+	uint16_t slot;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -57,48 +115,55 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
+	if (!rpl_index_valid) {
+		rpl_index_build();
+	}
 
-		/* Empty slot */
-		if (!rpl->src) {
-			if (match) {
-				*match = rpl;
-			} else {
-				bt_mesh_rpl_update(rpl, rx);
-			}
+	slot = *rpl_index_slot(rx->ctx.addr);
 
-			return false;
+	/* Empty slot */
+	if (slot == RPL_INDEX_EMPTY) {
+		if (rpl_count == ARRAY_SIZE(replay_list)) {
+			LOG_ERR("RPL is full!");
+			return true;
 		}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
+		rpl = &replay_list[rpl_count];
 
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				if (match) {
-					*match = rpl;
-				} else {
-					bt_mesh_rpl_update(rpl, rx);
-				}
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
+		}
 
-				return false;
-			} else {
-				return true;
-			}
+		return false;
+	}
+
+	/* Existing slot for given address */
+	rpl = &replay_list[slot];
+
+	if (rx->old_iv && !rpl->old_iv) {
+		return true;
+	}
+
+	if ((!rx->old_iv && rpl->old_iv) ||
+	    rpl->seq < rx->seq) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
+
+		return false;
 	}
 
-	LOG_ERR("RPL is full!");
 	return true;
 }
 
 void bt_mesh_rpl_clear(void)
 {
 	(void)memset(replay_list, 0, sizeof(replay_list));
+	rpl_index_valid = false;
 }
 
 void bt_mesh_rpl_reset(void)
@@ -130,6 +195,7 @@ void bt_mesh_rpl_reset(void)
 	}
 
 	(void) memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+	rpl_index_valid = false;
 }
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
@@ -23,6 +23,25 @@ LOG_MODULE_REGISTER(fp_crypto, CONFIG_FP_CRYPTO_LOG_LEVEL);
 					 FP_CRYPTO_ADDITIONAL_DATA_NONCE_LEN)
 
 
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_AES128_ECB_DECRYPT_CTX_SUPPORT)
+int fp_crypto_aes128_ecb_decrypt_multi(uint8_t *out, const uint8_t *in,
+				       const struct fp_crypto_aes128_ecb_decrypt_ctx *ctxs,
+				       size_t ctx_cnt)
+{
+	int err;
+
+	for (size_t i = 0; i < ctx_cnt; i++) {
+		err = fp_crypto_aes128_ecb_ctx_decrypt(&out[i * FP_CRYPTO_AES128_BLOCK_LEN], in,
+						       &ctxs[i]);
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BT_FAST_PAIR_CRYPTO_AES128_ECB_DECRYPT_CTX_SUPPORT */
+
 int fp_crypto_aes128_ctr_encrypt(uint8_t *out, const uint8_t *in, size_t data_len,
 				 const uint8_t *key, const uint8_t *nonce)
 {
@@ -191,6 +191,36 @@ int fp_crypto_aes128_ecb_decrypt(uint8_t *out, const uint8_t *in, const uint8_t
 	return fp_crypto_aes128_ecb_crypt(out, in, k, false);
 }
 
+int fp_crypto_aes128_ecb_decrypt_ctx_init(struct fp_crypto_aes128_ecb_decrypt_ctx *ctx,
+					  const uint8_t *k)
+{
+	ctx->key_id = import_aes128_key(k);
+	if (ctx->key_id == PSA_KEY_ID_NULL) {
+		LOG_ERR("import_aes128_key failed");
+		return -EIO;
+	}
+
+	return 0;
+}
+
+void fp_crypto_aes128_ecb_decrypt_ctx_free(struct fp_crypto_aes128_ecb_decrypt_ctx *ctx)
+{
+	psa_status_t status;
+
+	status = psa_destroy_key(ctx->key_id);
+	if (status != PSA_SUCCESS) {
+		LOG_ERR("psa_destroy_key failed (err: %d)", status);
+	}
+
+	ctx->key_id = PSA_KEY_ID_NULL;
+}
+
+int fp_crypto_aes128_ecb_ctx_decrypt(uint8_t *out, const uint8_t *in,
+				     const struct fp_crypto_aes128_ecb_decrypt_ctx *ctx)
+{
+	return fp_crypto_psa_aes128_ecb_crypt(out, in, ctx->key_id, false);
+}
+
 static psa_key_id_t import_ecdh_priv_key(const uint8_t *data)
 {
 	static const size_t len = 32;
@@ -11,6 +11,12 @@
 
 #include "fp_common.h"
 
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_TINYCRYPT)
+#include <tinycrypt/aes.h>
+#elif defined(CONFIG_BT_FAST_PAIR_CRYPTO_PSA)
+#include <psa/crypto.h>
+#endif
+
 /**
  * @defgroup fp_crypto Fast Pair crypto
  * @brief Internal API for Fast Pair crypto
@@ -97,6 +103,71 @@ int fp_crypto_aes128_ecb_encrypt(uint8_t *out, const uint8_t *in, const uint8_t
  */
 int fp_crypto_aes128_ecb_decrypt(uint8_t *out, const uint8_t *in, const uint8_t *k);
 
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_AES128_ECB_DECRYPT_CTX_SUPPORT)
+/** AES-128-ECB decryption context.
+ *
+ * The context holds the key prepared for decryption by the cryptographic backend (expanded key
+ * schedule or imported key), so that the key can be used for many decryptions without being
+ * prepared again each time.
+ *
+ * Only available with the backends that prepare the key separately from the decryption.
+ */
+struct fp_crypto_aes128_ecb_decrypt_ctx {
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_TINYCRYPT)
+	/** Expanded decryption key schedule. */
+	struct tc_aes_key_sched_struct sched;
+#elif defined(CONFIG_BT_FAST_PAIR_CRYPTO_PSA)
+	/** Identifier of the imported volatile key. */
+	psa_key_id_t key_id;
+#endif
+};
+
+/** Prepare AES-128-ECB decryption context.
+ *
+ * The context must be released using @ref fp_crypto_aes128_ecb_decrypt_ctx_free.
+ *
+ * @param[out] ctx Decryption context.
+ * @param[in] k 128-bit (16-byte) AES key.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int fp_crypto_aes128_ecb_decrypt_ctx_init(struct fp_crypto_aes128_ecb_decrypt_ctx *ctx,
+					  const uint8_t *k);
+
+/** Release AES-128-ECB decryption context and clear the key material it holds.
+ *
+ * @param[in] ctx Decryption context.
+ */
+void fp_crypto_aes128_ecb_decrypt_ctx_free(struct fp_crypto_aes128_ecb_decrypt_ctx *ctx);
+
+/** Decrypt message using AES-128-ECB and a prepared decryption context.
+ *
+ * @param[out] out 128-bit (16-byte) buffer to receive plaintext message.
+ * @param[in] in 128-bit (16-byte) ciphertext message.
+ * @param[in] ctx Decryption context.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int fp_crypto_aes128_ecb_ctx_decrypt(uint8_t *out, const uint8_t *in,
+				     const struct fp_crypto_aes128_ecb_decrypt_ctx *ctx);
+
+/** Decrypt the same message using AES-128-ECB with each of the prepared decryption contexts.
+ *
+ * Used for trial decryption, when it is not known which of the keys was used for encryption.
+ *
+ * @param[out] out Buffer to receive ctx_cnt 128-bit (16-byte) plaintext messages. The n-th
+ *                 message is decrypted using the n-th context.
+ * @param[in] in 128-bit (16-byte) ciphertext message.
+ * @param[in] ctxs Array of decryption contexts.
+ * @param[in] ctx_cnt Number of decryption contexts.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int fp_crypto_aes128_ecb_decrypt_multi(uint8_t *out, const uint8_t *in,
+				       const struct fp_crypto_aes128_ecb_decrypt_ctx *ctxs,
+				       size_t ctx_cnt);
+#endif /* CONFIG_BT_FAST_PAIR_CRYPTO_AES128_ECB_DECRYPT_CTX_SUPPORT */
+
 /** Encrypt data using AES-128-CTR.
  *
  * @param[out] out Buffer to receive encrypted data.
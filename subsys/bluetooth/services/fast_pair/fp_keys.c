@@ -29,6 +29,15 @@ LOG_MODULE_DECLARE(fast_pair, CONFIG_BT_FAST_PAIR_LOG_LEVEL);
 #define FP_KEY_GEN_FAILURE_MAX_CNT		10
 #define FP_KEY_GEN_FAILURE_CNT_RESET_TIMEOUT	K_MINUTES(5)
 
+#define ACCOUNT_KEY_CNT (IS_ENABLED(CONFIG_BT_FAST_PAIR_SUBSEQUENT_PAIRING) ? \
+			 CONFIG_BT_FAST_PAIR_STORAGE_ACCOUNT_KEY_MAX : 1)
+
+#if defined(CONFIG_BT_FAST_PAIR_SUBSEQUENT_PAIRING_AK_DECRYPT_CTX_CNT)
+#define AK_DECRYPT_CTX_CNT CONFIG_BT_FAST_PAIR_SUBSEQUENT_PAIRING_AK_DECRYPT_CTX_CNT
+#else
+#define AK_DECRYPT_CTX_CNT 0
+#endif
+
 BUILD_ASSERT(FP_ACCOUNT_KEY_LEN == FP_CRYPTO_AES128_KEY_LEN);
 
 enum wait_for {
@@ -56,6 +65,10 @@ struct fp_procedure {
 struct fp_key_gen_account_key_check_context {
 	const struct bt_conn *conn;
 	struct fp_keys_keygen_params *keygen_params;
+	const struct fp_account_key *account_keys;
+	const uint8_t *reqs;
+	size_t account_key_cnt;
+	size_t req_cnt;
 };
 
 static uint8_t key_gen_failure_cnt;
@@ -67,6 +80,15 @@ static struct fp_procedure fp_procedures[CONFIG_BT_MAX_CONN];
 
 static bool is_enabled;
 
+#if AK_DECRYPT_CTX_CNT > 0
+/* Decryption contexts of the first stored Account Keys, used for trial decryption of the
+ * Key-based Pairing request. The n-th context belongs to the n-th Account Key returned by the
+ * storage. A context is prepared again only if the Account Key at its position changes.
+ */
+static struct fp_crypto_aes128_ecb_decrypt_ctx ak_decrypt_ctxs[AK_DECRYPT_CTX_CNT];
+static struct fp_account_key ak_decrypt_ctx_keys[AK_DECRYPT_CTX_CNT];
+static bool ak_decrypt_ctx_ready[AK_DECRYPT_CTX_CNT];
+#endif
 
 void bt_fast_pair_set_pairing_mode(bool pairing_mode)
 {
@@ -242,20 +264,131 @@ static int key_gen_public_key(const struct bt_conn *conn,
 	return err;
 }
 
+#if AK_DECRYPT_CTX_CNT > 0
+static void ak_decrypt_ctx_release(size_t idx)
+{
+	if (ak_decrypt_ctx_ready[idx]) {
+		fp_crypto_aes128_ecb_decrypt_ctx_free(&ak_decrypt_ctxs[idx]);
+		memset(&ak_decrypt_ctx_keys[idx], 0, sizeof(ak_decrypt_ctx_keys[idx]));
+		ak_decrypt_ctx_ready[idx] = false;
+	}
+}
+
+static void ak_decrypt_ctxs_release(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(ak_decrypt_ctxs); i++) {
+		ak_decrypt_ctx_release(i);
+	}
+}
+
+static void ak_decrypt_ctxs_update(const struct fp_account_key *account_keys,
+				   size_t account_key_cnt)
+{
+	int err;
+
+	for (size_t i = 0; i < ARRAY_SIZE(ak_decrypt_ctxs); i++) {
+		if (i >= account_key_cnt) {
+			ak_decrypt_ctx_release(i);
+			continue;
+		}
+
+		if (ak_decrypt_ctx_ready[i] &&
+		    !memcmp(ak_decrypt_ctx_keys[i].key, account_keys[i].key,
+			    sizeof(account_keys[i].key))) {
+			continue;
+		}
+
+		ak_decrypt_ctx_release(i);
+
+		err = fp_crypto_aes128_ecb_decrypt_ctx_init(&ak_decrypt_ctxs[i],
+							    account_keys[i].key);
+		if (err) {
+			/* The request is decrypted with this Account Key directly. */
+			LOG_WRN("Failed to prepare Account Key decryption context: %d", err);
+			continue;
+		}
+
+		ak_decrypt_ctx_keys[i] = account_keys[i];
+		ak_decrypt_ctx_ready[i] = true;
+	}
+}
+
+/* Decrypt the request with the prepared contexts of the first Account Keys at once. Returns the
+ * number of decrypted requests.
+ */
+static size_t ak_reqs_decrypt(uint8_t *reqs, const uint8_t *req_enc,
+			      const struct fp_account_key *account_keys, size_t account_key_cnt)
+{
+	size_t req_cnt = 0;
+	int err;
+
+	ak_decrypt_ctxs_update(account_keys, account_key_cnt);
+
+	while ((req_cnt < MIN(account_key_cnt, ARRAY_SIZE(ak_decrypt_ctxs))) &&
+	       ak_decrypt_ctx_ready[req_cnt]) {
+		req_cnt++;
+	}
+
+	err = fp_crypto_aes128_ecb_decrypt_multi(reqs, req_enc, ak_decrypt_ctxs, req_cnt);
+	if (err) {
+		/* The request is decrypted with every Account Key directly. */
+		LOG_WRN("Failed to decrypt with prepared Account Key contexts: %d", err);
+		return 0;
+	}
+
+	return req_cnt;
+}
+#else
+static void ak_decrypt_ctxs_release(void)
+{
+}
+
+static size_t ak_reqs_decrypt(uint8_t *reqs, const uint8_t *req_enc,
+			      const struct fp_account_key *account_keys, size_t account_key_cnt)
+{
+	ARG_UNUSED(reqs);
+	ARG_UNUSED(req_enc);
+	ARG_UNUSED(account_keys);
+	ARG_UNUSED(account_key_cnt);
+
+	return 0;
+}
+#endif /* AK_DECRYPT_CTX_CNT > 0 */
+
 static bool key_gen_account_key_check(const struct fp_account_key *account_key, void *context)
 {
 	int err;
-	uint8_t req[FP_CRYPTO_AES128_BLOCK_LEN];
 	struct fp_key_gen_account_key_check_context *ak_check_context = context;
 	const struct bt_conn *conn = ak_check_context->conn;
 	struct fp_keys_keygen_params *keygen_params = ak_check_context->keygen_params;
 	struct fp_procedure *proc = &fp_procedures[bt_conn_index(conn)];
+	uint8_t req_buf[FP_CRYPTO_AES128_BLOCK_LEN];
+	const uint8_t *req;
+	size_t idx;
+
+	/* Find the request decrypted with the Account Key. */
+	for (idx = 0; idx < ak_check_context->account_key_cnt; idx++) {
+		if (!memcmp(ak_check_context->account_keys[idx].key, account_key->key,
+			    sizeof(account_key->key))) {
+			break;
+		}
+	}
+
+	if (idx == ak_check_context->account_key_cnt) {
+		return false;
+	}
 
 	memcpy(proc->aes_key, account_key->key, FP_ACCOUNT_KEY_LEN);
 
-	err = fp_keys_decrypt(conn, req, keygen_params->req_enc);
-	if (err) {
-		return false;
+	if (idx < ak_check_context->req_cnt) {
+		req = &ak_check_context->reqs[idx * FP_CRYPTO_AES128_BLOCK_LEN];
+	} else {
+		/* No prepared decryption context for the Account Key. */
+		err = fp_keys_decrypt(conn, req_buf, keygen_params->req_enc);
+		if (err) {
+			return false;
+		}
+		req = req_buf;
 	}
 
 	err = keygen_params->req_validate_cb(conn, req, keygen_params->context);
@@ -269,10 +402,29 @@ static bool key_gen_account_key_check(const struct fp_account_key *account_key,
 static int key_gen_account_key(const struct bt_conn *conn,
 			       struct fp_keys_keygen_params *keygen_params)
 {
+	struct fp_account_key account_keys[ACCOUNT_KEY_CNT];
+	uint8_t reqs[MAX(AK_DECRYPT_CTX_CNT, 1) * FP_CRYPTO_AES128_BLOCK_LEN];
+	size_t account_key_cnt = ARRAY_SIZE(account_keys);
 	struct fp_key_gen_account_key_check_context context = {
 		.conn = conn,
 		.keygen_params = keygen_params,
+		.account_keys = account_keys,
+		.reqs = reqs,
 	};
+	int err;
+
+	err = fp_storage_ak_get(account_keys, &account_key_cnt);
+	if (err) {
+		return err;
+	}
+
+	/* Decrypt the request with the Account Keys that have a prepared decryption context
+	 * at once. The request is decrypted with the other Account Keys when they are checked.
+	 * The requests are validated in the Account Key storage order.
+	 */
+	context.req_cnt = ak_reqs_decrypt(reqs, keygen_params->req_enc, account_keys,
+					  account_key_cnt);
+	context.account_key_cnt = account_key_cnt;
 
 	/* This function call assigns the Account Key internally to the Fast Pair Keys
 	 * module. The assignment happens in the provided callback method.
@@ -531,6 +683,8 @@ static int fp_keys_uninit(void)
 		ARG_UNUSED(ret);
 	}
 
+	ak_decrypt_ctxs_release();
+
 	return 0;
 }
 
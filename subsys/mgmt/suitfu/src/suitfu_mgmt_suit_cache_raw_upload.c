@@ -89,6 +89,8 @@ int suitfu_mgmt_suit_cache_raw_upload(struct smp_streamer *ctx)
 
 		int rc = suitfu_mgmt_erase(&device_info, req.size);
 
+		suit_dfu_cache_index_invalidate();
+
 		if (rc != MGMT_ERR_EOK) {
 			LOG_ERR("Cache pool %d, erasing partition failed", req.target_id);
 			return MGMT_ERR_EBADSTATE;
@@ -126,6 +128,10 @@ int suitfu_mgmt_suit_cache_raw_upload(struct smp_streamer *ctx)
 
 	int rc = suitfu_mgmt_write(&device_info, req.off, req.img_data.value, req.img_data.len,
 				   last);
+
+	/* Slots indexed while the upload is in progress may be overwritten by this chunk */
+	suit_dfu_cache_index_invalidate();
+
 	if (rc == MGMT_ERR_EOK) {
 
 		req.off += req.img_data.len;
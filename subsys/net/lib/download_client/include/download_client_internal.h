@@ -15,13 +15,19 @@ int url_parse_host(const char *url, char *host, size_t len);
 int url_parse_file(const char *url, char *file, size_t len);
 int http_parse(struct download_client *client, size_t len);
 int http_get_request_send(struct download_client *client);
+bool http_pipelined(const struct download_client *client);
+size_t http_pipeline_next(struct download_client *client, size_t frag_len);
 
 int coap_block_init(struct download_client *client, size_t from);
 int coap_get_recv_timeout(struct download_client *dl);
 int coap_initiate_retransmission(struct download_client *dl);
 int coap_parse(struct download_client *client, size_t len);
 int coap_request_send(struct download_client *client);
+bool coap_windowed(const struct download_client *client);
+size_t coap_window_next(struct download_client *client);
 
 int socket_send(const struct download_client *client, size_t len, int timeout);
+int socket_send_buf(const struct download_client *client, const char *buf, size_t len,
+		    int timeout);
 
 #endif /* DOWNLOAD_CLIENT_INTERNAL_H */
@@ -8,23 +8,35 @@
 #include <zephyr/net/coap.h>
 #include <net/download_client.h>
 #include <zephyr/logging/log.h>
+#include <limits.h>
 #include <string.h>
 #include <zephyr/sys/__assert.h>
+#include "download_client_internal.h"
 
 LOG_MODULE_DECLARE(download_client, CONFIG_DOWNLOAD_CLIENT_LOG_LEVEL);
 
 #define COAP_VER 1
 #define FILENAME_SIZE CONFIG_DOWNLOAD_CLIENT_MAX_FILENAME_SIZE
 #define COAP_PATH_ELEM_DELIM "/"
+#define WINDOW_SIZE CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE
+
+/* State of a request in the window */
+enum slot_state {
+	/* The request has not been sent */
+	SLOT_FREE,
+	/* The request has been sent, waiting for the response */
+	SLOT_SENT,
+	/* The request timed out and has to be sent again */
+	SLOT_RESEND,
+	/* The response has been received before the current block */
+	SLOT_RECEIVED,
+};
 
 /* declaration of strtok_r appears to be missing in some cases,
  * even though it's defined in the minimal libc, so we forward declare it
  */
 extern char *strtok_r(char *str, const char *sep, char **state);
 
-int url_parse_file(const char *url, char *file, size_t len);
-int socket_send(const struct download_client *client, size_t len, int timeout);
-
 static int coap_get_current_from_response_pkt(const struct coap_packet *cpkt)
 {
 	int block = 0;
@@ -42,12 +54,328 @@ static bool has_pending(struct download_client *client)
 	return client->coap.pending.timeout > 0;
 }
 
+bool coap_windowed(const struct download_client *client)
+{
+	return WINDOW_SIZE > 1 &&
+	       (client->proto == IPPROTO_UDP || client->proto == IPPROTO_DTLS_1_2);
+}
+
+static int request_build(struct download_client *client, struct coap_packet *request,
+			 uint16_t id, struct coap_block_context *block_ctx)
+{
+	int err;
+	char file[FILENAME_SIZE];
+	char *path_elem;
+	char *path_elem_saveptr;
+
+	err = coap_packet_init(request, client->buf, CONFIG_DOWNLOAD_CLIENT_BUF_SIZE, COAP_VER,
+			       COAP_TYPE_CON, 8, coap_next_token(), COAP_METHOD_GET, id);
+	if (err) {
+		LOG_ERR("Failed to init CoAP message, err %d", err);
+		return err;
+	}
+
+	err = url_parse_file(client->file, file, sizeof(file));
+	if (err) {
+		LOG_ERR("Unable to parse url");
+		return err;
+	}
+
+	path_elem = strtok_r(file, COAP_PATH_ELEM_DELIM, &path_elem_saveptr);
+	do {
+		err = coap_packet_append_option(request, COAP_OPTION_URI_PATH,
+			path_elem, strlen(path_elem));
+		if (err) {
+			LOG_ERR("Unable add option to request");
+			return err;
+		}
+	} while ((path_elem = strtok_r(NULL, COAP_PATH_ELEM_DELIM, &path_elem_saveptr)));
+
+	err = coap_append_block2_option(request, block_ctx);
+	if (err) {
+		LOG_ERR("Unable to add block2 option");
+		return err;
+	}
+
+	err = coap_append_size2_option(request, block_ctx);
+	if (err) {
+		LOG_ERR("Unable to add size2 option");
+		return err;
+	}
+
+	return 0;
+}
+
+static int request_pending_init(struct download_client *client, struct coap_pending *pending,
+				const struct coap_packet *request)
+{
+	int err;
+	struct coap_transmission_parameters params = coap_get_transmission_parameters();
+
+	params.max_retransmission = CONFIG_DOWNLOAD_CLIENT_COAP_MAX_RETRANSMIT_REQUEST_COUNT;
+	err = coap_pending_init(pending, request, &client->remote_addr, &params);
+	if (err < 0) {
+		return -EINVAL;
+	}
+
+	coap_pending_cycle(pending);
+
+	return 0;
+}
+
+/* Time left before the retransmission of a request, in milliseconds */
+static int pending_timeout(const struct coap_pending *pending)
+{
+	return pending->t0 + pending->timeout - k_uptime_get_32();
+}
+
+#if CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE > 1
+
+static size_t block_bytes(const struct download_client *client)
+{
+	return coap_block_size_to_bytes(client->coap.block_ctx.block_size);
+}
+
+/* Number of the block that is delivered next */
+static uint32_t window_base(const struct download_client *client)
+{
+	return client->coap.block_ctx.current / block_bytes(client);
+}
+
+static struct download_client_coap_slot *window_slot(struct download_client *client,
+						     uint32_t num)
+{
+	return &client->coap.window[num % WINDOW_SIZE];
+}
+
+static struct download_client_coap_slot *window_find(struct download_client *client,
+						     uint16_t id)
+{
+	for (size_t i = 0; i < WINDOW_SIZE; i++) {
+		struct download_client_coap_slot *slot = &client->coap.window[i];
+
+		if (slot->state != SLOT_FREE && slot->id == id) {
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+
+static void window_reset(struct download_client *client)
+{
+	for (size_t i = 0; i < WINDOW_SIZE; i++) {
+		client->coap.window[i].state = SLOT_FREE;
+		coap_pending_clear(&client->coap.window[i].pending);
+	}
+}
+
+static int window_request_send(struct download_client *client,
+			       struct download_client_coap_slot *slot, uint32_t num)
+{
+	int err;
+	struct coap_packet request;
+	struct coap_block_context block_ctx = client->coap.block_ctx;
+
+	/* The current block may have been partially downloaded */
+	if (num != window_base(client)) {
+		block_ctx.current = num * block_bytes(client);
+	}
+
+	if (slot->state == SLOT_FREE) {
+		slot->id = coap_next_id();
+	}
+
+	err = request_build(client, &request, slot->id, &block_ctx);
+	if (err) {
+		return err;
+	}
+
+	if (slot->state == SLOT_FREE) {
+		err = request_pending_init(client, &slot->pending, &request);
+		if (err) {
+			return err;
+		}
+		slot->num = num;
+	}
+
+	/* If sending fails, the request is sent again when it times out */
+	slot->state = SLOT_SENT;
+
+	LOG_DBG("CoAP block %d requested", num);
+
+	err = socket_send(client, request.offset, slot->pending.timeout);
+	if (err) {
+		LOG_ERR("Failed to send CoAP request, errno %d", errno);
+		return err;
+	}
+
+	if (IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_LOG_HEADERS)) {
+		LOG_HEXDUMP_DBG(request.data, request.offset, "CoAP request");
+	}
+
+	return 0;
+}
+
+/* Send the requests of the window that have not been sent or have timed out */
+static int window_send(struct download_client *client)
+{
+	int err;
+	uint32_t base = window_base(client);
+	uint32_t end = base + 1;
+
+	/* Blocks are only requested ahead once the size of the file is known */
+	if (client->file_size) {
+		end = MIN(base + WINDOW_SIZE, DIV_ROUND_UP(client->file_size, block_bytes(client)));
+	}
+
+	for (uint32_t num = base; num < end; num++) {
+		struct download_client_coap_slot *slot = window_slot(client, num);
+
+		if (slot->state == SLOT_FREE || slot->state == SLOT_RESEND) {
+			err = window_request_send(client, slot, num);
+			if (err) {
+				return err;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int window_recv_timeout(struct download_client *client)
+{
+	int timeout = INT_MAX;
+
+	for (size_t i = 0; i < WINDOW_SIZE; i++) {
+		struct download_client_coap_slot *slot = &client->coap.window[i];
+
+		if (slot->state == SLOT_SENT || slot->state == SLOT_RESEND) {
+			timeout = MIN(timeout, pending_timeout(&slot->pending));
+		}
+	}
+
+	__ASSERT(timeout != INT_MAX, "Must have coap pending");
+
+	return MAX(timeout, 0);
+}
+
+static int window_retransmission(struct download_client *client)
+{
+	for (size_t i = 0; i < WINDOW_SIZE; i++) {
+		struct download_client_coap_slot *slot = &client->coap.window[i];
+
+		if (slot->state != SLOT_SENT || pending_timeout(&slot->pending) > 0) {
+			continue;
+		}
+
+		if (!coap_pending_cycle(&slot->pending)) {
+			LOG_ERR("CoAP max-retransmissions exceeded");
+			return -1;
+		}
+
+		slot->state = SLOT_RESEND;
+	}
+
+	return 0;
+}
+
+/* Keep the response to a request for a block after the current one */
+static void window_store(struct download_client *client, struct download_client_coap_slot *slot,
+			 const struct coap_packet *response, size_t len)
+{
+	int block = coap_get_option_int(response, COAP_OPTION_BLOCK2);
+
+	if (block < 0 || GET_BLOCK_NUM(block) != slot->num ||
+	    GET_BLOCK_SIZE(block) != client->coap.block_ctx.block_size) {
+		LOG_WRN("Unexpected block in response to block %d", slot->num);
+		return;
+	}
+
+	if (len > sizeof(slot->buf)) {
+		/* It is received again once it is the current block */
+		LOG_DBG("Response to block %d too large to be kept", slot->num);
+		return;
+	}
+
+	LOG_DBG("Keeping block %d until block %d is received", slot->num, window_base(client));
+
+	memcpy(slot->buf, client->buf, len);
+	slot->len = len;
+	slot->state = SLOT_RECEIVED;
+	coap_pending_clear(&slot->pending);
+}
+
+/* Returns:
+ *  1 if the response is not for the current block
+ *  0 if the response is for the current block
+ */
+static int window_response(struct download_client *client, const struct coap_packet *response,
+			   size_t len)
+{
+	struct download_client_coap_slot *slot;
+
+	slot = window_find(client, coap_header_get_id(response));
+	if (!slot) {
+		/* Duplicate or late response to a request that was already answered */
+		LOG_DBG("Response is not pending, ignored");
+		return 1;
+	}
+
+	if (slot->num != window_base(client)) {
+		window_store(client, slot, response, len);
+		return 1;
+	}
+
+	coap_pending_clear(&slot->pending);
+	slot->state = SLOT_FREE;
+
+	return 0;
+}
+
+size_t coap_window_next(struct download_client *client)
+{
+	int err;
+	struct download_client_coap_slot *slot;
+
+	client->offset = 0;
+
+	err = window_send(client);
+	if (err) {
+		LOG_DBG("Failed to request the next blocks, err %d", err);
+	}
+
+	/* Hand over the next block if its response has already been received */
+	slot = window_slot(client, window_base(client));
+	if (slot->state != SLOT_RECEIVED) {
+		return 0;
+	}
+
+	memcpy(client->buf, slot->buf, slot->len);
+
+	return slot->len;
+}
+
+#else
+
+static void window_reset(struct download_client *client)
+{
+}
+
+size_t coap_window_next(struct download_client *client)
+{
+	return 0;
+}
+
+#endif /* CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE > 1 */
+
 int coap_block_init(struct download_client *client, size_t from)
 {
 	coap_block_transfer_init(&client->coap.block_ctx,
 				 CONFIG_DOWNLOAD_CLIENT_COAP_BLOCK_SIZE, 0);
 	client->coap.block_ctx.current = from;
 	coap_pending_clear(&client->coap.pending);
+	window_reset(client);
 	return 0;
 }
 
@@ -55,13 +383,19 @@ int coap_get_recv_timeout(struct download_client *dl)
 {
 	int timeout;
 
+#if CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE > 1
+	if (coap_windowed(dl)) {
+		return window_recv_timeout(dl);
+	}
+#endif
+
 	__ASSERT(has_pending(dl), "Must have coap pending");
 
 	/* Retransmission is cycled in case recv() times out. In case sending request
 	 * blocks, the time that is used for sending request must be substracted next time
 	 * recv() is called.
 	 */
-	timeout = dl->coap.pending.t0 + dl->coap.pending.timeout - k_uptime_get_32();
+	timeout = pending_timeout(&dl->coap.pending);
 	if (timeout < 0) {
 		/* All time is spent when sending request and time this
 		 * method is called, there is no time left for receiving;
@@ -76,6 +410,12 @@ int coap_get_recv_timeout(struct download_client *dl)
 
 int coap_initiate_retransmission(struct download_client *dl)
 {
+#if CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE > 1
+	if (coap_windowed(dl)) {
+		return window_retransmission(dl);
+	}
+#endif
+
 	if (dl->coap.pending.timeout == 0) {
 		return -EINVAL;
 	}
@@ -142,6 +482,7 @@ int coap_parse(struct download_client *client, size_t len)
 	uint16_t payload_len;
 	const uint8_t *payload;
 	struct coap_packet response;
+	enum coap_block_size block_size;
 	bool more;
 
 	/* TODO: currently we stop download on every error, but this is mostly not necessary
@@ -154,14 +495,15 @@ int coap_parse(struct download_client *client, size_t len)
 		return -EBADMSG;
 	}
 
+	if (!coap_windowed(client)) {
+		if (coap_header_get_id(&response) != client->coap.pending.id) {
+			LOG_ERR("Response is not pending");
+			return -EBADMSG;
+		}
 
-	if (coap_header_get_id(&response) != client->coap.pending.id) {
-		LOG_ERR("Response is not pending");
-		return -EBADMSG;
+		coap_pending_clear(&client->coap.pending);
 	}
 
-	coap_pending_clear(&client->coap.pending);
-
 	if (coap_header_get_type(&response) != COAP_TYPE_ACK) {
 		LOG_ERR("Response must be of coap type ACK");
 		return -EBADMSG;
@@ -174,11 +516,28 @@ int coap_parse(struct download_client *client, size_t len)
 		return -EBADMSG;
 	}
 
+#if CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE > 1
+	if (coap_windowed(client)) {
+		err = window_response(client, &response, len);
+		if (err) {
+			/* Not the response to the current block */
+			return err;
+		}
+	}
+#endif
+
+	block_size = client->coap.block_ctx.block_size;
+
 	err = coap_block_update(client, &response, &blk_off, &more);
 	if (err) {
 		return -EBADMSG;
 	}
 
+	if (client->coap.block_ctx.block_size != block_size) {
+		/* The blocks that were requested ahead have a different size */
+		window_reset(client);
+	}
+
 	payload = coap_packet_get_payload(&response, &payload_len);
 	if (!payload) {
 		LOG_WRN("No CoAP payload!");
@@ -192,8 +551,8 @@ int coap_parse(struct download_client *client, size_t len)
 	 */
 	LOG_DBG("CoAP response: %d, copying %d bytes",
 		coap_header_get_code(&response), payload_len - blk_off);
-	memcpy(client->buf + client->offset, payload + blk_off,
-	       payload_len - blk_off);
+	memmove(client->buf + client->offset, payload + blk_off,
+		payload_len - blk_off);
 
 	client->offset += payload_len - blk_off;
 	client->progress += payload_len - blk_off;
@@ -210,64 +569,30 @@ int coap_request_send(struct download_client *client)
 {
 	int err;
 	uint16_t id;
-	char file[FILENAME_SIZE];
-	char *path_elem;
-	char *path_elem_saveptr;
 	struct coap_packet request;
 
+#if CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE > 1
+	if (coap_windowed(client)) {
+		return window_send(client);
+	}
+#endif
+
 	if (has_pending(client)) {
 		id = client->coap.pending.id;
 	} else {
 		id = coap_next_id();
 	}
 
-	err = coap_packet_init(&request, client->buf, CONFIG_DOWNLOAD_CLIENT_BUF_SIZE, COAP_VER,
-			       COAP_TYPE_CON, 8, coap_next_token(), COAP_METHOD_GET, id);
+	err = request_build(client, &request, id, &client->coap.block_ctx);
 	if (err) {
-		LOG_ERR("Failed to init CoAP message, err %d", err);
 		return err;
 	}
 
-	err = url_parse_file(client->file, file, sizeof(file));
-	if (err) {
-		LOG_ERR("Unable to parse url");
-		return err;
-	}
-
-	path_elem = strtok_r(file, COAP_PATH_ELEM_DELIM, &path_elem_saveptr);
-	do {
-		err = coap_packet_append_option(&request, COAP_OPTION_URI_PATH,
-			path_elem, strlen(path_elem));
+	if (!has_pending(client)) {
+		err = request_pending_init(client, &client->coap.pending, &request);
 		if (err) {
-			LOG_ERR("Unable add option to request");
 			return err;
 		}
-	} while ((path_elem = strtok_r(NULL, COAP_PATH_ELEM_DELIM, &path_elem_saveptr)));
-
-	err = coap_append_block2_option(&request, &client->coap.block_ctx);
-	if (err) {
-		LOG_ERR("Unable to add block2 option");
-		return err;
-	}
-
-	err = coap_append_size2_option(&request, &client->coap.block_ctx);
-	if (err) {
-		LOG_ERR("Unable to add size2 option");
-		return err;
-	}
-
-	if (!has_pending(client)) {
-		struct coap_transmission_parameters params = coap_get_transmission_parameters();
-
-		params.max_retransmission =
-			CONFIG_DOWNLOAD_CLIENT_COAP_MAX_RETRANSMIT_REQUEST_COUNT;
-		err = coap_pending_init(&client->coap.pending, &request, &client->remote_addr,
-					&params);
-		if (err < 0) {
-			return -EINVAL;
-		}
-
-		coap_pending_cycle(&client->coap.pending);
 	}
 
 	LOG_DBG("CoAP next block: %d", client->coap.block_ctx.current);
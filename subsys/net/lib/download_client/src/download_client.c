@@ -466,6 +466,12 @@ cleanup:
 }
 
 int socket_send(const struct download_client *client, size_t len, int timeout)
+{
+	return socket_send_buf(client, client->buf, len, timeout);
+}
+
+int socket_send_buf(const struct download_client *client, const char *buf, size_t len,
+		    int timeout)
 {
 	int err;
 	int sent;
@@ -477,7 +483,7 @@ int socket_send(const struct download_client *client, size_t len, int timeout)
 	}
 
 	while (len) {
-		sent = send(client->fd, client->buf + off, len, 0);
+		sent = send(client->fd, buf + off, len, 0);
 		if (sent < 0) {
 			return -errno;
 		}
@@ -683,10 +689,19 @@ static int handle_socket_error(struct download_client *dl, ssize_t len)
  * 1 wait for more data,
  * -1 to stop
  * 0 to send a next request
+ *
+ * When HTTP requests are pipelined, `next_len` is set to the number of bytes
+ * of the next responses that were received after the fragment. They are moved
+ * to the start of the buffer and have to be handled as received data.
+ * Likewise for the response to the next CoAP block, when it was received
+ * before the current one.
  */
-static int handle_received(struct download_client *dl, ssize_t len)
+static int handle_received_data(struct download_client *dl, ssize_t len, size_t *next_len)
 {
 	int rc;
+	size_t frag_len;
+
+	*next_len = 0;
 
 	LOG_DBG("Read %d bytes from socket", len);
 
@@ -725,6 +740,8 @@ static int handle_received(struct download_client *dl, ssize_t len)
 		LOG_INF("Downloaded %u bytes", dl->progress);
 	}
 
+	frag_len = dl->offset;
+
 	/* Send fragment to application.
 	 * If the application callback returns non-zero, stop.
 	 */
@@ -742,6 +759,12 @@ static int handle_received(struct download_client *dl, ssize_t len)
 		dl->callback(&evt);
 		/* Restart and suspend */
 		rc = -1;
+	} else if (rc == 0 && http_pipelined(dl)) {
+		/* The next ranges have already been requested */
+		rc = 1;
+	} else if (rc == 0 && IS_ENABLED(CONFIG_COAP) && coap_windowed(dl)) {
+		/* The next blocks have already been requested */
+		rc = 1;
 	} else if ((dl->proto == IPPROTO_TCP || dl->proto == IPPROTO_TLS_1_2) &&
 		   IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_RANGE_REQUESTS)) {
 		/* Request a next range */
@@ -759,6 +782,26 @@ static int handle_received(struct download_client *dl, ssize_t len)
 			rc = -1;
 		}
 	}
+
+	if (rc > 0 && http_pipelined(dl)) {
+		*next_len = http_pipeline_next(dl, frag_len);
+	} else if (rc > 0 && IS_ENABLED(CONFIG_COAP) && coap_windowed(dl)) {
+		*next_len = coap_window_next(dl);
+	}
+
+	return rc;
+}
+
+static int handle_received(struct download_client *dl, ssize_t len)
+{
+	int rc;
+	size_t next_len;
+
+	do {
+		rc = handle_received_data(dl, len, &next_len);
+		len = next_len;
+	} while (rc > 0 && len > 0);
+
 	return rc;
 }
 
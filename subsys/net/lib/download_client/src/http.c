@@ -43,7 +43,14 @@ LOG_MODULE_DECLARE(download_client, CONFIG_DOWNLOAD_CLIENT_LOG_LEVEL);
 
 extern char *strnstr(const char *haystack, const char *needle, size_t haystack_sz);
 
-int http_get_request_send(struct download_client *client)
+static size_t http_frag_size(const struct download_client *client)
+{
+	return client->config.frag_size_override ? client->config.frag_size_override :
+						   CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE;
+}
+
+/* Send a request for the bytes from `client->http.requested`, built in the given buffer. */
+static int http_request_send(struct download_client *client, char *buf, size_t size)
 {
 	int err;
 	int len;
@@ -54,8 +61,6 @@ int http_get_request_send(struct download_client *client)
 	__ASSERT_NO_MSG(client->host);
 	__ASSERT_NO_MSG(client->file);
 
-	client->http.has_header = false;
-
 	err = url_parse_host(client->host, host, sizeof(host));
 	if (err) {
 		return err;
@@ -67,12 +72,7 @@ int http_get_request_send(struct download_client *client)
 	}
 
 	/* Offset of last byte in range (Content-Range) */
-	if (client->config.frag_size_override) {
-		off = client->progress + client->config.frag_size_override - 1;
-	} else {
-		off = client->progress +
-			CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE - 1;
-	}
+	off = client->http.requested + http_frag_size(client) - 1;
 
 	if (client->file_size != 0) {
 		/* Don't request bytes past the end of file */
@@ -81,40 +81,93 @@ int http_get_request_send(struct download_client *client)
 
 	if (client->proto == IPPROTO_TLS_1_2
 	   || IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_RANGE_REQUESTS)) {
-		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
-			HTTP_GET_RANGE, file, host, client->progress, off);
+		len = snprintf(buf, size, HTTP_GET_RANGE, file, host, client->http.requested, off);
 		client->http.ranged = true;
-	} else if (client->progress) {
-		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
-			HTTP_GET_OFFSET, file, host, client->progress);
+	} else if (client->http.requested) {
+		len = snprintf(buf, size, HTTP_GET_OFFSET, file, host, client->http.requested);
 		client->http.ranged = false;
 	} else {
-		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
-			HTTP_GET, file, host);
+		len = snprintf(buf, size, HTTP_GET, file, host);
 		client->http.ranged = false;
 	}
 
-	if (len < 0 || len > CONFIG_DOWNLOAD_CLIENT_BUF_SIZE) {
-		LOG_ERR("Cannot create GET request, buffer too small");
+	if (len < 0 || len >= size) {
 		return -ENOMEM;
 	}
 
 	if (IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_LOG_HEADERS)) {
-		LOG_HEXDUMP_DBG(client->buf, len, "HTTP request");
+		LOG_HEXDUMP_DBG(buf, len, "HTTP request");
 	}
 
-	err = socket_send(client, len, 0);
+	err = socket_send_buf(client, buf, len, 0);
 	if (err) {
 		LOG_ERR("Failed to send HTTP request, errno %d", errno);
 		return err;
 	}
 
+	client->http.requested = off + 1;
+	client->http.pending++;
+
 	return 0;
 }
 
+int http_get_request_send(struct download_client *client)
+{
+	int err;
+
+	client->http.has_header = false;
+	client->http.requested = client->progress;
+	client->http.pending = 0;
+	client->http.excess = 0;
+
+	err = http_request_send(client, client->buf, sizeof(client->buf));
+	if (err == -ENOMEM) {
+		LOG_ERR("Cannot create GET request, buffer too small");
+	}
+
+	return err;
+}
+
+bool http_pipelined(const struct download_client *client)
+{
+	return CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE_DEPTH > 1 &&
+	       (client->proto == IPPROTO_TCP || client->proto == IPPROTO_TLS_1_2) &&
+	       client->http.ranged;
+}
+
+/* Request the next ranges until CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE_DEPTH requests are
+ * pending. The requests are built in the buffer after the first `used` bytes.
+ */
+static void http_pipeline_fill(struct download_client *client, size_t used)
+{
+	while (client->http.pending < CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE_DEPTH &&
+	       client->http.requested < client->file_size &&
+	       !client->http.connection_close) {
+		if (http_request_send(client, client->buf + used, sizeof(client->buf) - used)) {
+			/* Try again when the next fragment has been received */
+			LOG_DBG("Range request for %u deferred", client->http.requested);
+			break;
+		}
+	}
+}
+
+size_t http_pipeline_next(struct download_client *client, size_t frag_len)
+{
+	size_t excess = client->http.excess;
+
+	if (excess > 0) {
+		LOG_DBG("Moving %u bytes of the next response", excess);
+		memmove(client->buf, client->buf + frag_len, excess);
+		client->http.excess = 0;
+	}
+
+	client->offset = 0;
+
+	http_pipeline_fill(client, excess);
+
+	return excess;
+}
+
 /* Returns:
  *  1 while the header is being received
  *  0 if the header has been fully received
@@ -128,8 +181,11 @@ static int http_header_parse(struct download_client *client, size_t *hdr_len)
 
 	const unsigned int expected_status = (client->http.ranged || client->progress) ? 206 : 200;
 
-	p = strnstr(client->buf, "\r\n\r\n", sizeof(client->buf));
-	if (!p || p > client->buf + client->offset) {
+	/* Only look at the received bytes, the rest of the buffer may hold
+	 * a stale header from a previous response.
+	 */
+	p = strnstr(client->buf, "\r\n\r\n", client->offset);
+	if (!p) {
 		/* Waiting full HTTP header */
 		LOG_DBG("Waiting full header in response");
 		return 1;
@@ -272,6 +328,12 @@ int http_parse(struct download_client *client, size_t len)
 			 */
 			client->offset = 0;
 		}
+
+		if (http_pipelined(client)) {
+			client->http.body_left = MIN(http_frag_size(client),
+						     client->file_size - client->progress);
+			http_pipeline_fill(client, client->offset);
+		}
 	}
 
 	/* Accumulate overall file progress.
@@ -281,14 +343,36 @@ int http_parse(struct download_client *client, size_t len)
 	 * `offset` is less than `len` and it represents
 	 * the actual payload bytes.
 	 */
-	client->progress += MIN(client->offset, len);
+	size_t payload = MIN(client->offset, len);
+
+	if (http_pipelined(client)) {
+		/* With pipelined requests, the bytes after the end of the
+		 * range belong to the next response. They are kept after
+		 * the fragment in the buffer.
+		 */
+		client->http.excess = payload - MIN(payload, client->http.body_left);
+		client->offset -= client->http.excess;
+		payload -= client->http.excess;
+		client->http.body_left -= payload;
+		client->progress += payload;
+
+		if (client->http.body_left > 0) {
+			return 1;
+		}
+
+		/* The next bytes are the header of the next response */
+		client->http.has_header = false;
+		client->http.pending--;
+
+		return 0;
+	}
+
+	client->progress += payload;
 
 	/* Have we received a whole fragment or the whole file? */
 	if (client->progress != client->file_size) {
 		if (client->http.ranged) {
-			if (client->offset < (client->config.frag_size_override != 0 ?
-						      client->config.frag_size_override :
-						      CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE)) {
+			if (client->offset < http_frag_size(client)) {
 				/* Ranged query: read until a full fragment */
 				return 1;
 			}
@@ -32,6 +32,7 @@
 #include "nrf_cloud_log_internal.h"
 #include "nrf_cloud_fota.h"
 #include "nrf_cloud_transport.h"
+#include "nrf_cloud_json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -93,6 +94,12 @@ int nrf_cloud_alert_encode(const struct nrf_cloud_alert_info *alert,
 int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *input,
 				 struct nrf_cloud_data *output);
 
+/** @brief Write the sensor data message using the provided JSON writer, without heap usage.
+ * The output is identical to that of @ref nrf_cloud_sensor_data_encode.
+ */
+int nrf_cloud_sensor_data_json_write(const struct nrf_cloud_sensor_data *input,
+				     struct nrf_cloud_json_writer *const wr);
+
 /** @brief Encode general message of either a given numeric value or, if not NULL,
  *  a string value.  If topic is present, that topic will be used.
  */
@@ -281,11 +288,26 @@ int nrf_cloud_cell_info_json_encode(cJSON * const data_obj,
 int nrf_cloud_cell_pos_req_json_encode(struct lte_lc_cells_info const *const inf,
 				       cJSON * const req_obj_out);
 
+/** @brief Write a cellular positioning request into the object currently open in the
+ * provided JSON writer, without heap usage. The output is identical to that of
+ * @ref nrf_cloud_cell_pos_req_json_encode. On failure, nothing is added to the writer.
+ */
+int nrf_cloud_cell_pos_req_json_write(struct lte_lc_cells_info const *const inf,
+				      struct nrf_cloud_json_writer *const wr);
+
 /** @brief Add the location request data payload to the provided initialized object */
 int nrf_cloud_obj_location_request_payload_add(struct nrf_cloud_obj *const obj,
 					       struct lte_lc_cells_info const *const cells_inf,
 					       struct wifi_scan_info const *const wifi_inf);
 
+/** @brief Encode the location request data payload to a JSON string without building a
+ * cJSON tree. The output is identical to that of @ref nrf_cloud_obj_location_request_payload_add
+ * on an empty object, and must be freed with nrf_cloud_free().
+ */
+int nrf_cloud_location_request_payload_encode(struct lte_lc_cells_info const *const cells_inf,
+					      struct wifi_scan_info const *const wifi_inf,
+					      struct nrf_cloud_data *const output);
+
 /** @brief Build a Wi-Fi positioning request in the provided cJSON object using the provided
  * Wi-Fi info. Local MAC addresses are not included in the request.
  *
@@ -296,6 +318,23 @@ int nrf_cloud_obj_location_request_payload_add(struct nrf_cloud_obj *const obj,
 int nrf_cloud_wifi_req_json_encode(struct wifi_scan_info const *const wifi,
 				   cJSON *const req_obj_out);
 
+/** @brief Write a Wi-Fi positioning request into the object currently open in the
+ * provided JSON writer, without heap usage. The output is identical to that of
+ * @ref nrf_cloud_wifi_req_json_encode. On failure, nothing is added to the writer.
+ *
+ * @retval 0 Success.
+ * @retval -ENODATA Access point (non-local) count less than NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN.
+ */
+int nrf_cloud_wifi_req_json_write(struct wifi_scan_info const *const wifi,
+				  struct nrf_cloud_json_writer *const wr);
+
+/** @brief Write a GNSS device message into the object currently open in the provided
+ * JSON writer, without heap usage. The output is identical to that of
+ * @ref nrf_cloud_gnss_msg_json_encode. On failure, nothing is added to the writer.
+ */
+int nrf_cloud_gnss_msg_json_write(const struct nrf_cloud_gnss_data *const gnss,
+				  struct nrf_cloud_json_writer *const wr);
+
 /** @brief Get the required information from the modem for a single-cell location request. */
 int nrf_cloud_get_single_cell_modem_info(struct lte_lc_cell *const cell_inf);
 
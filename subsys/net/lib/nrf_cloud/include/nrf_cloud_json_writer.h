@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_JSON_WRITER_H_
+#define NRF_CLOUD_JSON_WRITER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum nesting depth of objects and arrays supported by the writer. */
+#define NRF_CLOUD_JSON_WRITER_DEPTH_MAX 16
+
+/** @brief Streaming JSON writer.
+ *
+ * Serializes JSON directly into a caller-provided buffer without any heap usage.
+ * The output is byte-identical to what cJSON_PrintUnformatted() produces for an
+ * equivalent cJSON tree, so it can be used interchangeably with the cJSON based encoders.
+ *
+ * Errors are sticky: once a call fails, all subsequent calls are ignored and return
+ * the same error. If the buffer is too small, the writer keeps counting the required
+ * length and the overflow is reported by @ref nrf_cloud_json_writer_finish, so the writer
+ * can also be used to measure a message by providing a NULL buffer.
+ *
+ * To discard a partially written member, save a copy of the writer before writing it
+ * and restore the copy afterwards.
+ */
+struct nrf_cloud_json_writer {
+	/** Output buffer, may be NULL to only compute the length. */
+	char *buf;
+	/** Size of the output buffer, including space for the NULL terminator. */
+	size_t size;
+	/** Length of the output, including any data that did not fit into the buffer. */
+	size_t len;
+	/** Sticky error code. */
+	int err;
+	/** Current nesting depth. */
+	uint8_t depth;
+	/** Bitmask of nesting levels that already contain at least one item. */
+	uint16_t has_items;
+	/** Bitmask of nesting levels that are objects rather than arrays. */
+	uint16_t is_obj;
+};
+
+/** @brief Initialize the writer to serialize into the provided buffer.
+ *
+ * @param[out] wr Writer to initialize.
+ * @param[in] buf Output buffer, or NULL to only compute the length of the output.
+ * @param[in] size Size of the output buffer.
+ */
+void nrf_cloud_json_writer_init(struct nrf_cloud_json_writer *const wr,
+				char *const buf, const size_t size);
+
+/** @brief Finish writing and NULL-terminate the output.
+ *
+ * @retval >=0 Length of the output, excluding the NULL terminator.
+ * @retval -ENOMEM The output did not fit into the buffer.
+ * @retval -EINVAL Unbalanced objects or arrays, or invalid parameters were provided.
+ */
+int nrf_cloud_json_writer_finish(struct nrf_cloud_json_writer *const wr);
+
+/** @brief Start an object.
+ *
+ * @param[in] key Key of the object if the current container is an object, otherwise NULL.
+ *
+ * @return Sticky error code of the writer.
+ */
+int nrf_cloud_json_obj_start(struct nrf_cloud_json_writer *const wr, const char *const key);
+
+/** @brief End the current object. */
+int nrf_cloud_json_obj_end(struct nrf_cloud_json_writer *const wr);
+
+/** @brief Start an array.
+ *
+ * @param[in] key Key of the array if the current container is an object, otherwise NULL.
+ *
+ * @return Sticky error code of the writer.
+ */
+int nrf_cloud_json_arr_start(struct nrf_cloud_json_writer *const wr, const char *const key);
+
+/** @brief End the current array. */
+int nrf_cloud_json_arr_end(struct nrf_cloud_json_writer *const wr);
+
+/** @brief Add a string item, escaped the same way as cJSON.
+ *
+ * @param[in] key Key of the item if the current container is an object, otherwise NULL.
+ * @param[in] val NULL-terminated string value.
+ *
+ * @return Sticky error code of the writer.
+ */
+int nrf_cloud_json_str_add(struct nrf_cloud_json_writer *const wr, const char *const key,
+			   const char *const val);
+
+/** @brief Add a number item, formatted the same way as cJSON.
+ *
+ * @param[in] key Key of the item if the current container is an object, otherwise NULL.
+ * @param[in] val Number value.
+ *
+ * @return Sticky error code of the writer.
+ */
+int nrf_cloud_json_num_add(struct nrf_cloud_json_writer *const wr, const char *const key,
+			   const double val);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_JSON_WRITER_H_ */
@@ -413,47 +413,59 @@ static bool compare(const char *s1, const char *s2)
 	return !strncmp(s1, s2, strlen(s2));
 }
 
-int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *sensor,
-				 struct nrf_cloud_data *output)
+int nrf_cloud_sensor_data_json_write(const struct nrf_cloud_sensor_data *sensor,
+				     struct nrf_cloud_json_writer *const wr)
 {
-	int ret;
-
 	__ASSERT_NO_MSG(sensor != NULL);
 	__ASSERT_NO_MSG(sensor->data.ptr != NULL);
 	__ASSERT_NO_MSG(sensor->data.len != 0);
-	__ASSERT_NO_MSG(output != NULL);
+	__ASSERT_NO_MSG(wr != NULL);
 	__ASSERT_NO_MSG(sensor->type < SENSOR_TYPE_ARRAY_SIZE);
 
-	cJSON *root_obj = cJSON_CreateObject();
-
-	if (root_obj == NULL) {
-		return -ENOMEM;
-	}
-
-	ret = json_add_str_cs(root_obj, NRF_CLOUD_JSON_APPID_KEY, sensor_type_str[sensor->type]);
-	ret += json_add_str_cs(root_obj, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
-	ret += json_add_str_cs(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
-			       NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	(void)nrf_cloud_json_obj_start(wr, NULL);
+	(void)nrf_cloud_json_str_add(wr, NRF_CLOUD_JSON_APPID_KEY, sensor_type_str[sensor->type]);
+	(void)nrf_cloud_json_str_add(wr, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
+	(void)nrf_cloud_json_str_add(wr, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
 	if (sensor->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
-		ret += json_add_num_cs(root_obj, NRF_CLOUD_MSG_TIMESTAMP_KEY, sensor->ts_ms);
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_MSG_TIMESTAMP_KEY, sensor->ts_ms);
 	}
 
-	if (ret != 0) {
-		cJSON_Delete(root_obj);
-		return -ENOMEM;
-	}
+	return nrf_cloud_json_obj_end(wr);
+}
 
+int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *sensor,
+				 struct nrf_cloud_data *output)
+{
+	int ret;
 	char *buffer;
+	struct nrf_cloud_json_writer wr;
 
-	buffer = cJSON_PrintUnformatted(root_obj);
-	cJSON_Delete(root_obj);
+	__ASSERT_NO_MSG(output != NULL);
+
+	/* Measure the message first so it can be written with a single allocation */
+	nrf_cloud_json_writer_init(&wr, NULL, 0);
+	(void)nrf_cloud_sensor_data_json_write(sensor, &wr);
+	ret = nrf_cloud_json_writer_finish(&wr);
+	if (ret < 0) {
+		return ret;
+	}
 
+	buffer = nrf_cloud_malloc(ret + 1);
 	if (buffer == NULL) {
 		return -ENOMEM;
 	}
 
+	nrf_cloud_json_writer_init(&wr, buffer, ret + 1);
+	(void)nrf_cloud_sensor_data_json_write(sensor, &wr);
+	ret = nrf_cloud_json_writer_finish(&wr);
+	if (ret < 0) {
+		nrf_cloud_free(buffer);
+		return ret;
+	}
+
 	output->ptr = buffer;
-	output->len = strlen(buffer);
+	output->len = ret;
 
 	return 0;
 }
@@ -981,6 +993,25 @@ int nrf_cloud_pvt_data_encode(const struct nrf_cloud_gnss_pvt * const pvt,
 	return 0;
 }
 
+static int pvt_data_json_write(const struct nrf_cloud_gnss_pvt *const pvt,
+			       struct nrf_cloud_json_writer *const wr)
+{
+	(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_JSON_GNSS_PVT_KEY_LON, pvt->lon);
+	(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_JSON_GNSS_PVT_KEY_LAT, pvt->lat);
+	(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_JSON_GNSS_PVT_KEY_ACCURACY, pvt->accuracy);
+	if (pvt->has_alt) {
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_JSON_GNSS_PVT_KEY_ALTITUDE, pvt->alt);
+	}
+	if (pvt->has_speed) {
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_JSON_GNSS_PVT_KEY_SPEED, pvt->speed);
+	}
+	if (pvt->has_heading) {
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_JSON_GNSS_PVT_KEY_HEADING, pvt->heading);
+	}
+
+	return wr->err;
+}
+
 int nrf_cloud_encode_message(const char *app_id, double value, const char *str_val,
 			     const char *topic, int64_t ts, struct nrf_cloud_data *output)
 {
@@ -2569,6 +2600,127 @@ cleanup:
 	return err;
 }
 
+static void ncells_json_write(struct nrf_cloud_json_writer *const wr, const uint8_t ncells_count,
+			      const struct lte_lc_ncell *const neighbor_cells)
+{
+	if (!ncells_count || !neighbor_cells) {
+		return;
+	}
+
+	(void)nrf_cloud_json_arr_start(wr, NRF_CLOUD_CELL_POS_JSON_KEY_NBORS);
+
+	for (uint8_t i = 0; i < ncells_count; ++i) {
+		const struct lte_lc_ncell *ncell = neighbor_cells + i;
+
+		(void)nrf_cloud_json_obj_start(wr, NULL);
+
+		/* Required parameters for the API call */
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_EARFCN, ncell->earfcn);
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_PCI,
+					     ncell->phys_cell_id);
+
+		/* Optional parameters for the API call */
+		if (ncell->rsrp != NRF_CLOUD_LOCATION_CELL_OMIT_RSRP) {
+			(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_RSRP,
+						     RSRP_IDX_TO_DBM(ncell->rsrp));
+		}
+		if (ncell->rsrq != NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ) {
+			(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_RSRQ,
+						     RSRQ_IDX_TO_DB(ncell->rsrq));
+		}
+		if (ncell->time_diff != LTE_LC_CELL_TIME_DIFF_INVALID) {
+			(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_TDIFF,
+						     ncell->time_diff);
+		}
+
+		(void)nrf_cloud_json_obj_end(wr);
+	}
+
+	(void)nrf_cloud_json_arr_end(wr);
+}
+
+/* Write the members of an LTE cell object, see add_lte_inf() */
+static void lte_inf_json_write(struct nrf_cloud_json_writer *const wr,
+			       struct lte_lc_cell const *const inf)
+{
+	/* Required parameters for the API call */
+	(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_ECI, inf->id);
+	(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_MCC, inf->mcc);
+	(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_MNC, inf->mnc);
+	(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_TAC, inf->tac);
+
+	/* Optional parameters for the API call */
+	if (inf->earfcn != NRF_CLOUD_LOCATION_CELL_OMIT_EARFCN) {
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_EARFCN, inf->earfcn);
+	}
+
+	if (inf->rsrp != NRF_CLOUD_LOCATION_CELL_OMIT_RSRP) {
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_RSRP,
+					     RSRP_IDX_TO_DBM(inf->rsrp));
+	}
+
+	if (inf->rsrq != NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ) {
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_RSRQ,
+					     RSRQ_IDX_TO_DB(inf->rsrq));
+	}
+
+	if (inf->timing_advance != NRF_CLOUD_LOCATION_CELL_OMIT_TIME_ADV) {
+		uint16_t t_adv = inf->timing_advance;
+
+		if (t_adv > NRF_CLOUD_LOCATION_CELL_TIME_ADV_MAX) {
+			t_adv = NRF_CLOUD_LOCATION_CELL_TIME_ADV_MAX;
+		}
+
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_CELL_POS_JSON_KEY_T_ADV, t_adv);
+	}
+}
+
+int nrf_cloud_cell_pos_req_json_write(struct lte_lc_cells_info const *const inf,
+				      struct nrf_cloud_json_writer *const wr)
+{
+	if (!inf || !wr) {
+		return -EINVAL;
+	}
+
+	const bool has_cur_cell = (inf->current_cell.id != LTE_LC_CELL_EUTRAN_ID_INVALID);
+	const bool has_gci_cells = (inf->gci_cells_count && inf->gci_cells);
+	const struct nrf_cloud_json_writer mark = *wr;
+	int err;
+
+	/* If using a GCI search type, sometimes there is no current cell */
+	if (!has_cur_cell && !has_gci_cells) {
+		err = -ENODATA;
+		goto cleanup;
+	}
+
+	(void)nrf_cloud_json_arr_start(wr, NRF_CLOUD_CELL_POS_JSON_KEY_LTE);
+
+	/* Add the current cell and its neighbors */
+	if (has_cur_cell) {
+		(void)nrf_cloud_json_obj_start(wr, NULL);
+		lte_inf_json_write(wr, &inf->current_cell);
+		ncells_json_write(wr, inf->ncells_count, inf->neighbor_cells);
+		(void)nrf_cloud_json_obj_end(wr);
+	}
+
+	/* Add GCI cells */
+	for (uint8_t i = 0; has_gci_cells && (i < inf->gci_cells_count); ++i) {
+		(void)nrf_cloud_json_obj_start(wr, NULL);
+		lte_inf_json_write(wr, inf->gci_cells + i);
+		(void)nrf_cloud_json_obj_end(wr);
+	}
+
+	err = nrf_cloud_json_arr_end(wr);
+	if (err == 0) {
+		return 0;
+	}
+
+cleanup:
+	*wr = mark;
+	LOG_ERR("Failed to format location request: %d", err);
+	return err;
+}
+
 int nrf_cloud_obj_location_request_payload_add(struct nrf_cloud_obj *const obj,
 	struct lte_lc_cells_info const *const cells_inf,
 	struct wifi_scan_info const *const wifi_inf)
@@ -2621,6 +2773,109 @@ int nrf_cloud_obj_location_request_payload_add(struct nrf_cloud_obj *const obj,
 	return err;
 }
 
+/* Write the location request members into the open object of the writer, with the same
+ * fallbacks as nrf_cloud_obj_location_request_payload_add(). The included request types
+ * are returned so that the message can be written again without repeating the checks.
+ */
+static int location_request_json_write(struct lte_lc_cells_info const *const cells_inf,
+				       struct wifi_scan_info const *const wifi_inf,
+				       struct nrf_cloud_json_writer *const wr,
+				       bool *const cell_inf_added, bool *const wifi_inf_added)
+{
+	int err = 0;
+
+	*cell_inf_added = false;
+	*wifi_inf_added = false;
+
+	if (cells_inf) {
+		err = nrf_cloud_cell_pos_req_json_write(cells_inf, wr);
+		if ((err == -ENODATA) && (wifi_inf != NULL)) {
+			LOG_WRN("No GCI cells, excluding cellular data from request");
+		} else if (err) {
+			LOG_ERR("Failed to add cell info to location request, error: %d", err);
+			return err;
+		}
+
+		*cell_inf_added = (err == 0);
+	}
+
+	if (wifi_inf) {
+		err = nrf_cloud_wifi_req_json_write(wifi_inf, wr);
+		if (err == -ENODATA) {
+			LOG_WRN("At least %d APs (with a non-local MAC address) are required",
+				NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN);
+
+			if (*cell_inf_added) {
+				LOG_WRN("Excluding Wi-Fi data, request is cellular only");
+				err = 0;
+			} else {
+				LOG_ERR("Wi-Fi request not created");
+			}
+		} else if (err) {
+			LOG_ERR("Failed to add Wi-Fi info to location request, error: %d", err);
+		}
+
+		*wifi_inf_added = (err == 0);
+	}
+
+	return err;
+}
+
+int nrf_cloud_location_request_payload_encode(struct lte_lc_cells_info const *const cells_inf,
+					      struct wifi_scan_info const *const wifi_inf,
+					      struct nrf_cloud_data *const output)
+{
+	if (!output || (!cells_inf && !wifi_inf)) {
+		return -EINVAL;
+	}
+
+	int ret;
+	char *buffer;
+	bool cell_inf_added;
+	bool wifi_inf_added;
+	struct nrf_cloud_json_writer wr;
+
+	/* Measure the payload first so it can be written with a single allocation */
+	nrf_cloud_json_writer_init(&wr, NULL, 0);
+	(void)nrf_cloud_json_obj_start(&wr, NULL);
+	ret = location_request_json_write(cells_inf, wifi_inf, &wr,
+					  &cell_inf_added, &wifi_inf_added);
+	if (ret) {
+		return ret;
+	}
+	(void)nrf_cloud_json_obj_end(&wr);
+	ret = nrf_cloud_json_writer_finish(&wr);
+	if (ret < 0) {
+		return ret;
+	}
+
+	buffer = nrf_cloud_malloc(ret + 1);
+	if (buffer == NULL) {
+		return -ENOMEM;
+	}
+
+	/* Write only the request types that were included when measuring */
+	nrf_cloud_json_writer_init(&wr, buffer, ret + 1);
+	(void)nrf_cloud_json_obj_start(&wr, NULL);
+	if (cell_inf_added) {
+		(void)nrf_cloud_cell_pos_req_json_write(cells_inf, &wr);
+	}
+	if (wifi_inf_added) {
+		(void)nrf_cloud_wifi_req_json_write(wifi_inf, &wr);
+	}
+	(void)nrf_cloud_json_obj_end(&wr);
+	ret = nrf_cloud_json_writer_finish(&wr);
+	if (ret < 0) {
+		nrf_cloud_free(buffer);
+		return ret;
+	}
+
+	output->ptr = buffer;
+	output->len = ret;
+
+	return 0;
+}
+
 /* A local MAC is an address with:
  * - The U/L bit set (the second-least-significant bit of the first octet of the address).
  *  or
@@ -2730,6 +2985,102 @@ cleanup:
 	return err;
 }
 
+int nrf_cloud_wifi_req_json_write(struct wifi_scan_info const *const wifi,
+				  struct nrf_cloud_json_writer *const wr)
+{
+	if (!wifi || !wr || !wifi->ap_info || !wifi->cnt) {
+		return -EINVAL;
+	}
+
+	int err;
+	int encoded_cnt = 0;
+	const struct nrf_cloud_json_writer mark = *wr;
+	const bool add_all = IS_ENABLED(CONFIG_NRF_CLOUD_WIFI_LOCATION_ENCODE_OPT_ALL);
+	const bool add_rssi = (add_all ||
+			       IS_ENABLED(CONFIG_NRF_CLOUD_WIFI_LOCATION_ENCODE_OPT_MAC_RSSI));
+
+	LOG_DBG("Writing wifi_scan_info with count: %u", wifi->cnt);
+
+	(void)nrf_cloud_json_obj_start(wr, NRF_CLOUD_LOCATION_JSON_KEY_WIFI);
+	(void)nrf_cloud_json_arr_start(wr, NRF_CLOUD_LOCATION_JSON_KEY_APS);
+
+	for (uint8_t cnt = 0; cnt < wifi->cnt; ++cnt) {
+		char str_buf[MAX(WIFI_MAC_ADDR_STR_LEN, WIFI_SSID_MAX_LEN) + 1];
+		struct wifi_scan_result const *const ap = (wifi->ap_info + cnt);
+		int ret;
+
+		if (is_local_mac(ap->mac)) {
+			LOG_DBG("Skipping local MAC %02x:%02x:%02x:...",
+				ap->mac[0], ap->mac[1], ap->mac[2]);
+			continue;
+		}
+
+		(void)nrf_cloud_json_obj_start(wr, NULL);
+
+		/* MAC address is the only required parameter for the API call */
+		ret = snprintk(str_buf, sizeof(str_buf),
+			       WIFI_MAC_ADDR_TEMPLATE,
+			       ap->mac[0], ap->mac[1], ap->mac[2],
+			       ap->mac[3], ap->mac[4], ap->mac[5]);
+		if (ret != WIFI_MAC_ADDR_STR_LEN) {
+			err = -ENOMEM;
+			goto cleanup;
+		}
+		(void)nrf_cloud_json_str_add(wr, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_MAC, str_buf);
+
+		/* Optional parameters for the API call */
+		if (add_rssi && (ap->rssi != NRF_CLOUD_LOCATION_WIFI_OMIT_RSSI)) {
+			(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_RSSI,
+						     ap->rssi);
+		}
+
+		if (add_all) {
+			memset(str_buf, 0, sizeof(str_buf));
+			if ((ap->ssid_length > 0) && (ap->ssid_length <= WIFI_SSID_MAX_LEN)) {
+				memcpy(str_buf, ap->ssid, ap->ssid_length);
+			}
+
+			if (str_buf[0] != '\0') {
+				(void)nrf_cloud_json_str_add(wr,
+							     NRF_CLOUD_LOCATION_JSON_KEY_WIFI_SSID,
+							     str_buf);
+			}
+
+			if (ap->channel != NRF_CLOUD_LOCATION_WIFI_OMIT_CHAN) {
+				(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_CH,
+							     ap->channel);
+			}
+		}
+
+		(void)nrf_cloud_json_obj_end(wr);
+		++encoded_cnt;
+	}
+
+	(void)nrf_cloud_json_arr_end(wr);
+	err = nrf_cloud_json_obj_end(wr);
+	if (err) {
+		goto cleanup;
+	}
+
+	LOG_DBG("Wrote %d access points", encoded_cnt);
+
+	if (encoded_cnt < NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN) {
+		err = -ENODATA;
+		goto cleanup;
+	}
+
+	return 0;
+
+cleanup:
+	/* Discard the partially written Wi-Fi object */
+	*wr = mark;
+	if (err == -ENOMEM) {
+		LOG_ERR("Failed to format Wi-Fi location request, out of memory");
+	}
+
+	return err;
+}
+
 static bool json_item_string_exists(const cJSON *const obj, const char *const key,
 				    const char *const val)
 {
@@ -3316,14 +3667,10 @@ cleanup:
 }
 
 #if defined(CONFIG_NRF_MODEM)
-int nrf_cloud_modem_pvt_data_encode(const struct nrf_modem_gnss_pvt_data_frame	* const mdm_pvt,
-				    cJSON * const pvt_data_obj)
+static void modem_pvt_convert(const struct nrf_modem_gnss_pvt_data_frame *const mdm_pvt,
+			      struct nrf_cloud_gnss_pvt *const pvt)
 {
-	if (!mdm_pvt || !pvt_data_obj) {
-		return -EINVAL;
-	}
-
-	struct nrf_cloud_gnss_pvt pvt = {
+	*pvt = (struct nrf_cloud_gnss_pvt) {
 		.lon =		mdm_pvt->longitude,
 		.lat =		mdm_pvt->latitude,
 		.accuracy =	mdm_pvt->accuracy,
@@ -3334,11 +3681,111 @@ int nrf_cloud_modem_pvt_data_encode(const struct nrf_modem_gnss_pvt_data_frame	*
 		.heading =	mdm_pvt->heading,
 		.has_heading =	1
 	};
+}
+
+int nrf_cloud_modem_pvt_data_encode(const struct nrf_modem_gnss_pvt_data_frame	* const mdm_pvt,
+				    cJSON * const pvt_data_obj)
+{
+	if (!mdm_pvt || !pvt_data_obj) {
+		return -EINVAL;
+	}
+
+	struct nrf_cloud_gnss_pvt pvt;
+
+	modem_pvt_convert(mdm_pvt, &pvt);
 
 	return nrf_cloud_pvt_data_encode(&pvt, pvt_data_obj);
 }
 #endif /* CONFIG_NRF_MODEM */
 
+int nrf_cloud_gnss_msg_json_write(const struct nrf_cloud_gnss_data *const gnss,
+				  struct nrf_cloud_json_writer *const wr)
+{
+	if (!gnss || !wr) {
+		return -EINVAL;
+	}
+
+	int ret;
+	const struct nrf_cloud_json_writer mark = *wr;
+
+	/* Add the app ID, message type, and timestamp */
+	(void)nrf_cloud_json_str_add(wr, NRF_CLOUD_JSON_APPID_KEY, NRF_CLOUD_JSON_APPID_VAL_GNSS);
+	(void)nrf_cloud_json_str_add(wr, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (gnss->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
+		(void)nrf_cloud_json_num_add(wr, NRF_CLOUD_MSG_TIMESTAMP_KEY, gnss->ts_ms);
+	}
+
+	/* Add the specified GNSS data type */
+	switch (gnss->type) {
+	case NRF_CLOUD_GNSS_TYPE_MODEM_PVT:
+	case NRF_CLOUD_GNSS_TYPE_PVT:
+	{
+		struct nrf_cloud_gnss_pvt pvt = gnss->pvt;
+
+		if (gnss->type == NRF_CLOUD_GNSS_TYPE_MODEM_PVT) {
+#if defined(CONFIG_NRF_MODEM)
+			if (!gnss->mdm_pvt) {
+				ret = -EINVAL;
+				goto cleanup;
+			}
+			modem_pvt_convert(gnss->mdm_pvt, &pvt);
+#else
+			ret = -ENOSYS;
+			goto cleanup;
+#endif
+		}
+
+		(void)nrf_cloud_json_obj_start(wr, NRF_CLOUD_JSON_DATA_KEY);
+		(void)pvt_data_json_write(&pvt, wr);
+		(void)nrf_cloud_json_obj_end(wr);
+		break;
+	}
+	case NRF_CLOUD_GNSS_TYPE_MODEM_NMEA:
+	case NRF_CLOUD_GNSS_TYPE_NMEA:
+	{
+		const char *nmea = NULL;
+
+		if (gnss->type == NRF_CLOUD_GNSS_TYPE_MODEM_NMEA) {
+#if defined(CONFIG_NRF_MODEM)
+			if (gnss->mdm_nmea) {
+				nmea = gnss->mdm_nmea->nmea_str;
+			}
+#endif
+		} else {
+			nmea = gnss->nmea.sentence;
+		}
+
+		if (nmea == NULL) {
+			ret = -EINVAL;
+			goto cleanup;
+		}
+
+		if (memchr(nmea, '\0', NRF_MODEM_GNSS_NMEA_MAX_LEN) == NULL) {
+			ret = -EFBIG;
+			goto cleanup;
+		}
+
+		(void)nrf_cloud_json_str_add(wr, NRF_CLOUD_JSON_DATA_KEY, nmea);
+		break;
+	}
+	default:
+		ret = -EPROTO;
+		goto cleanup;
+	}
+
+	ret = wr->err;
+	if (ret == 0) {
+		return 0;
+	}
+
+cleanup:
+	/* On failure, discard anything written for this message */
+	*wr = mark;
+
+	return ret;
+}
+
 #if defined(CONFIG_NRF_CLOUD_AGNSS) || defined(CONFIG_NRF_CLOUD_PGPS)
 int nrf_cloud_agnss_req_json_encode(const struct nrf_modem_gnss_agnss_data_frame * const request,
 				   cJSON * const agnss_req_obj_out)
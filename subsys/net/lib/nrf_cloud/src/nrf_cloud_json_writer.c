@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+
+#include "nrf_cloud_json_writer.h"
+
+/* Large enough for any number printed with "%1.17g", same as in cJSON */
+#define NUM_STR_SIZE 26
+
+BUILD_ASSERT(NRF_CLOUD_JSON_WRITER_DEPTH_MAX <=
+	     (sizeof(((struct nrf_cloud_json_writer *)0)->has_items) * 8));
+
+static void raw_write(struct nrf_cloud_json_writer *const wr, const char *const data,
+		      const size_t len)
+{
+	if (wr->buf && (wr->len < wr->size)) {
+		/* Always leave room for the NULL terminator */
+		size_t avail = wr->size - wr->len - 1;
+
+		memcpy(wr->buf + wr->len, data, MIN(len, avail));
+	}
+
+	wr->len += len;
+}
+
+static void char_write(struct nrf_cloud_json_writer *const wr, const char c)
+{
+	raw_write(wr, &c, 1);
+}
+
+/* Escape the string the same way as cJSON's print_string_ptr() */
+static void escaped_write(struct nrf_cloud_json_writer *const wr, const char *const str)
+{
+	const char *run = str;
+	const char *p;
+
+	char_write(wr, '"');
+
+	for (p = str; *p != '\0'; ++p) {
+		const unsigned char c = (unsigned char)*p;
+		char esc[7];
+		size_t esc_len = 2;
+
+		if ((c >= 32) && (c != '"') && (c != '\\')) {
+			continue;
+		}
+
+		/* Flush the run of characters that do not need escaping */
+		raw_write(wr, run, p - run);
+		run = p + 1;
+
+		esc[0] = '\\';
+		switch (c) {
+		case '"':
+		case '\\':
+			esc[1] = c;
+			break;
+		case '\b':
+			esc[1] = 'b';
+			break;
+		case '\f':
+			esc[1] = 'f';
+			break;
+		case '\n':
+			esc[1] = 'n';
+			break;
+		case '\r':
+			esc[1] = 'r';
+			break;
+		case '\t':
+			esc[1] = 't';
+			break;
+		default:
+			esc_len = snprintf(esc + 1, sizeof(esc) - 1, "u%04x", c) + 1;
+			break;
+		}
+
+		raw_write(wr, esc, esc_len);
+	}
+
+	raw_write(wr, run, p - run);
+	char_write(wr, '"');
+}
+
+static bool double_equal(const double a, const double b)
+{
+	const double max_val = MAX(fabs(a), fabs(b));
+
+	return (fabs(a - b) <= (max_val * DBL_EPSILON));
+}
+
+/* Format the number the same way as cJSON's print_number() */
+static int num_format(char *const out, const double val)
+{
+	int int_val;
+
+	if (isnan(val) || isinf(val)) {
+		return snprintf(out, NUM_STR_SIZE, "null");
+	}
+
+	/* cJSON stores a saturated integer copy of every number */
+	if (val >= INT_MAX) {
+		int_val = INT_MAX;
+	} else if (val <= (double)INT_MIN) {
+		int_val = INT_MIN;
+	} else {
+		int_val = (int)val;
+	}
+
+	if (val == (double)int_val) {
+		return snprintf(out, NUM_STR_SIZE, "%d", int_val);
+	}
+
+	/* Use 15 digits if that is enough to represent the value, otherwise 17 */
+	int len = snprintf(out, NUM_STR_SIZE, "%1.15g", val);
+
+	if (!double_equal(strtod(out, NULL), val)) {
+		len = snprintf(out, NUM_STR_SIZE, "%1.17g", val);
+	}
+
+	return len;
+}
+
+/* Write the separator and key that precede every item */
+static bool item_begin(struct nrf_cloud_json_writer *const wr, const char *const key)
+{
+	if (wr->err) {
+		return false;
+	}
+
+	if (wr->depth == 0) {
+		/* Only a single top level item is allowed */
+		if (wr->len || key) {
+			wr->err = -EINVAL;
+			return false;
+		}
+		return true;
+	}
+
+	/* Object members must have a key, array elements must not */
+	if (!(wr->is_obj & BIT(wr->depth - 1)) != !key) {
+		wr->err = -EINVAL;
+		return false;
+	}
+
+	if (wr->has_items & BIT(wr->depth - 1)) {
+		char_write(wr, ',');
+	} else {
+		wr->has_items |= BIT(wr->depth - 1);
+	}
+
+	if (key) {
+		escaped_write(wr, key);
+		char_write(wr, ':');
+	}
+
+	return true;
+}
+
+static int container_start(struct nrf_cloud_json_writer *const wr, const char *const key,
+			   const char open)
+{
+	if (!item_begin(wr, key)) {
+		return wr->err;
+	}
+
+	if (wr->depth >= NRF_CLOUD_JSON_WRITER_DEPTH_MAX) {
+		wr->err = -EINVAL;
+		return wr->err;
+	}
+
+	char_write(wr, open);
+	wr->has_items &= ~BIT(wr->depth);
+	WRITE_BIT(wr->is_obj, wr->depth, (open == '{'));
+	++wr->depth;
+
+	return 0;
+}
+
+static int container_end(struct nrf_cloud_json_writer *const wr, const char close)
+{
+	if (wr->err) {
+		return wr->err;
+	}
+
+	if ((wr->depth == 0) ||
+	    (!(wr->is_obj & BIT(wr->depth - 1)) != (close == ']'))) {
+		wr->err = -EINVAL;
+		return wr->err;
+	}
+
+	char_write(wr, close);
+	--wr->depth;
+
+	return 0;
+}
+
+void nrf_cloud_json_writer_init(struct nrf_cloud_json_writer *const wr,
+				char *const buf, const size_t size)
+{
+	__ASSERT_NO_MSG(wr != NULL);
+
+	*wr = (struct nrf_cloud_json_writer) {
+		.buf = buf,
+		.size = buf ? size : 0,
+	};
+}
+
+int nrf_cloud_json_writer_finish(struct nrf_cloud_json_writer *const wr)
+{
+	if (!wr) {
+		return -EINVAL;
+	}
+
+	if (!wr->err && (wr->depth != 0)) {
+		wr->err = -EINVAL;
+	}
+
+	if (wr->buf && wr->size) {
+		wr->buf[MIN(wr->len, wr->size - 1)] = '\0';
+	}
+
+	if (wr->err) {
+		return wr->err;
+	}
+
+	if (wr->buf && (wr->len >= wr->size)) {
+		return -ENOMEM;
+	}
+
+	return (int)wr->len;
+}
+
+int nrf_cloud_json_obj_start(struct nrf_cloud_json_writer *const wr, const char *const key)
+{
+	return container_start(wr, key, '{');
+}
+
+int nrf_cloud_json_obj_end(struct nrf_cloud_json_writer *const wr)
+{
+	return container_end(wr, '}');
+}
+
+int nrf_cloud_json_arr_start(struct nrf_cloud_json_writer *const wr, const char *const key)
+{
+	return container_start(wr, key, '[');
+}
+
+int nrf_cloud_json_arr_end(struct nrf_cloud_json_writer *const wr)
+{
+	return container_end(wr, ']');
+}
+
+int nrf_cloud_json_str_add(struct nrf_cloud_json_writer *const wr, const char *const key,
+			   const char *const val)
+{
+	if (!wr->err && !val) {
+		wr->err = -EINVAL;
+	}
+
+	if (item_begin(wr, key)) {
+		escaped_write(wr, val);
+	}
+
+	return wr->err;
+}
+
+int nrf_cloud_json_num_add(struct nrf_cloud_json_writer *const wr, const char *const key,
+			   const double val)
+{
+	if (item_begin(wr, key)) {
+		char num[NUM_STR_SIZE];
+		int len = num_format(num, val);
+
+		raw_write(wr, num, len);
+	}
+
+	return wr->err;
+}
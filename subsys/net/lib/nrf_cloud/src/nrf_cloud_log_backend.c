@@ -27,6 +27,7 @@
 LOG_MODULE_REGISTER(nrf_cloud_log_backend, CONFIG_NRF_CLOUD_LOG_LOG_LEVEL);
 
 #define RING_BUF_SIZE CONFIG_NRF_CLOUD_LOG_RING_BUF_SIZE
+#define BATCH_WINDOW_MS CONFIG_NRF_CLOUD_LOG_BATCH_WINDOW_MS
 
 #define LOG_OUTPUT_RETRIES 5
 #define LOG_OUTPUT_RETRY_DELAY_MS 50
@@ -79,6 +80,7 @@ static uint8_t log_buf[CONFIG_NRF_CLOUD_LOG_BUF_SIZE + 1];
 static uint32_t log_format_current = CONFIG_LOG_BACKEND_NRF_CLOUD_OUTPUT_DEFAULT;
 static uint32_t log_output_flags = LOG_OUTPUT_FLAG_CRLF_NONE;
 static int num_msgs;
+static int64_t batch_start_ms;
 static struct nrf_cloud_rest_context *rest_ctx;
 static char device_id[NRF_CLOUD_CLIENT_ID_MAX_LEN];
 
@@ -122,6 +124,28 @@ static int filtered_ids[ARRAY_SIZE(filtered_modules)];
 
 static K_SEM_DEFINE(ncl_active, 1, 1);
 
+/* Protects the ring buffer. With a batch window, it is only held while log output is
+ * buffered or a batch is copied out of the buffer, never while a batch is sent.
+ */
+static K_MUTEX_DEFINE(ring_buf_lock);
+
+/* Serializes sending, so that batches are sent in the order they are taken.
+ * Must not be taken while holding ring_buf_lock.
+ */
+static K_MUTEX_DEFINE(send_lock);
+
+#if BATCH_WINDOW_MS > 0
+#define BATCH_FLUSH_STACK_SIZE CONFIG_NRF_CLOUD_LOG_BATCH_WORKQUEUE_STACK_SIZE
+#define BATCH_FLUSH_PRIORITY K_LOWEST_APPLICATION_THREAD_PRIO
+K_THREAD_STACK_DEFINE(batch_flush_stack, BATCH_FLUSH_STACK_SIZE);
+
+/** Work queue for sending batches, so that sending does not block the system work queue. */
+static struct k_work_q batch_flush_work_q;
+
+static void batch_flush_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(batch_flush_work, batch_flush_work_fn);
+#endif
+
 BUILD_ASSERT(CONFIG_NRF_CLOUD_LOG_BUF_SIZE < CONFIG_NRF_CLOUD_LOG_RING_BUF_SIZE,
 	     "Ring buffer size must be larger than log buffer size");
 
@@ -156,6 +180,12 @@ static void logger_init(const struct log_backend *const backend)
 	}
 	initialized = true;
 
+#if BATCH_WINDOW_MS > 0
+	k_work_queue_start(&batch_flush_work_q, batch_flush_stack,
+			   K_THREAD_STACK_SIZEOF(batch_flush_stack), BATCH_FLUSH_PRIORITY,
+			   &(struct k_work_queue_config){ .name = "nrf_cloud_log" });
+#endif
+
 	nrf_cloud_log_init();
 	LOG_INF("nRF Cloud logging mode:%s, level:%d",
 		IS_ENABLED(CONFIG_NRF_CLOUD_LOG_DICTIONARY_LOGGING_ENABLED) ? "dictionary" : "text",
@@ -340,6 +370,38 @@ static int logger_format_set(const struct log_backend *const backend, uint32_t l
 	return -ENOTSUP;
 }
 
+static bool batch_window_elapsed(void)
+{
+	if ((BATCH_WINDOW_MS == 0) || (num_msgs == 0)) {
+		return true;
+	}
+
+	return (k_uptime_get() - batch_start_ms) >= BATCH_WINDOW_MS;
+}
+
+static void batch_flush_schedule(void)
+{
+#if BATCH_WINDOW_MS > 0
+	(void)k_work_reschedule_for_queue(&batch_flush_work_q, &batch_flush_work,
+					  K_MSEC(BATCH_WINDOW_MS));
+#endif
+}
+
+#if BATCH_WINDOW_MS > 0
+static void batch_flush_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	if (logger_is_ready(&log_nrf_cloud_backend) != 0) {
+		/* Keep the batch until the connection is available again */
+		batch_flush_schedule();
+		return;
+	}
+
+	(void)send_ring_buffer();
+}
+#endif
+
 static void logger_notify(const struct log_backend *const backend, enum log_backend_evt event,
 		       union log_backend_evt_arg *arg)
 {
@@ -349,6 +411,11 @@ static void logger_notify(const struct log_backend *const backend, enum log_back
 		return;
 	}
 
+	/* Leave the batch for the flush work if its window is still open */
+	if (!batch_window_elapsed()) {
+		return;
+	}
+
 	/* Flush our transmission buffer */
 	send_ring_buffer();
 	if (CONFIG_NRF_CLOUD_LOG_LOG_LEVEL >= LOG_LEVEL_DBG) {
@@ -422,17 +489,38 @@ static char *get_dict_topic(void)
 	return topic;
 }
 
-static int send_ring_buffer(void)
+/* Release the ring buffer contents claimed by batch_take(). Must be called with
+ * ring_buf_lock held.
+ */
+static void ring_buf_release(uint32_t claimed)
+{
+	int ret = ring_buf_get_finish(&log_nrf_cloud_rb, claimed);
+
+	ring_buf_reset(&log_nrf_cloud_rb);
+	num_msgs = 0;
+
+	if (ret) {
+		LOG_ERR("Error finishing ring buffer: %d", ret);
+	}
+}
+
+/* Take the buffered batch out of the ring buffer. On success, batch->ptr is NULL if nothing
+ * was buffered, otherwise the batch must be released with batch_release() once it is sent.
+ *
+ * Without a batch window, JSON and raw binary batches are sent directly from the ring buffer,
+ * so ring_buf_lock stays held until the batch is released. Otherwise the batch is copied out,
+ * so that new output can be buffered while it is sent.
+ */
+static int batch_take(struct nrf_cloud_data *const batch, int *const lines)
 {
 	int err = 0;
-	int ret = 0;
 	uint32_t stored;
-	char *topic = NULL;
 	uint8_t *log_rb_ptr;
 	uint32_t log_rb_len;
-	uint8_t *log_b64_ptr = NULL;
-	uint32_t log_b64_len;
-	struct nrf_cloud_data output_data;
+	uint8_t *batch_ptr = NULL;
+	size_t batch_len = 0;
+
+	(void)k_mutex_lock(&ring_buf_lock, K_FOREVER);
 
 	/* The bulk topic requires the multiple JSON messages to be placed in
 	 * a JSON array. Close the array then send it.
@@ -441,6 +529,8 @@ static int send_ring_buffer(void)
 		ring_buf_put(&log_nrf_cloud_rb, "]", 1);
 	}
 
+	*lines = num_msgs;
+
 	stored = ring_buf_size_get(&log_nrf_cloud_rb);
 	log_rb_len = ring_buf_get_claim(&log_nrf_cloud_rb, &log_rb_ptr, stored);
 	if (log_rb_len != stored) {
@@ -451,6 +541,80 @@ static int send_ring_buffer(void)
 		stored = log_rb_len;
 	}
 	if (!log_rb_len) {
+		goto release;
+	}
+	if ((log_format_current == LOG_OUTPUT_DICT) &&
+	    IS_ENABLED(CONFIG_NRF_CLOUD_REST)) {
+		/* Encoding also copies the batch out of the ring buffer */
+		err = convert_to_quoted_base64(log_rb_ptr, log_rb_len, &batch_ptr, &batch_len);
+	} else if (BATCH_WINDOW_MS == 0) {
+		/* Send ring buffer contents as is -- JSON or raw binary. */
+		log_rb_ptr[log_rb_len] = '\0';
+		batch->ptr = log_rb_ptr;
+		batch->len = log_rb_len;
+
+		return 0;
+	} else {
+		/* Copy the ring buffer contents as is -- JSON or raw binary. */
+		batch_ptr = nrf_cloud_malloc(log_rb_len + 1);
+		if (batch_ptr) {
+			memcpy(batch_ptr, log_rb_ptr, log_rb_len);
+			batch_ptr[log_rb_len] = '\0';
+			batch_len = log_rb_len;
+		} else {
+			err = -ENOMEM;
+		}
+	}
+
+	if (err) {
+		LOG_WRN("Dropped lines:%d, bytes:%u", *lines, log_rb_len);
+		stats.lines_dropped += *lines;
+	}
+
+release:
+	ring_buf_release(stored);
+
+	k_mutex_unlock(&ring_buf_lock);
+
+	batch->ptr = batch_ptr;
+	batch->len = batch_len;
+
+	return err;
+}
+
+/* Release a batch taken by batch_take() after it has been sent. */
+static void batch_release(const struct nrf_cloud_data *const batch)
+{
+	const uint8_t *log_rb_start = log_nrf_cloud_rb.buffer;
+
+	if (!batch->ptr) {
+		return;
+	}
+
+	if (((const uint8_t *)batch->ptr >= log_rb_start) &&
+	    ((const uint8_t *)batch->ptr < &log_rb_start[RING_BUF_SIZE])) {
+		/* Sent directly from the ring buffer */
+		ring_buf_release(batch->len);
+		k_mutex_unlock(&ring_buf_lock);
+	} else {
+		nrf_cloud_free((void *)batch->ptr);
+	}
+}
+
+static int send_ring_buffer(void)
+{
+	int err;
+	int lines = 0;
+	char *topic = NULL;
+	struct nrf_cloud_data output_data = {0};
+
+	(void)k_mutex_lock(&send_lock, K_FOREVER);
+
+	/* With a batch window, the logging thread can buffer new output while this batch
+	 * is sent.
+	 */
+	err = batch_take(&output_data, &lines);
+	if (err || !output_data.ptr) {
 		goto cleanup;
 	}
 	if ((log_format_current == LOG_OUTPUT_DICT) &&
@@ -459,20 +623,8 @@ static int send_ring_buffer(void)
 		if (!topic) {
 			goto cleanup;
 		}
-		err = convert_to_quoted_base64(log_rb_ptr, log_rb_len,
-					       &log_b64_ptr, &log_b64_len);
-		if (err) {
-			goto cleanup;
-		}
 		LOG_DBG("topic:   %s", topic);
-		LOG_DBG("payload: %s", (const char *)log_b64_ptr);
-		output_data.ptr = log_b64_ptr;
-		output_data.len = log_b64_len;
-	} else {
-		/* Send ring buffer contents as is -- JSON or raw binary. */
-		log_rb_ptr[log_rb_len] = '\0';
-		output_data.ptr = log_rb_ptr;
-		output_data.len = log_rb_len;
+		LOG_DBG("payload: %s", (const char *)output_data.ptr);
 	}
 
 	LOG_DBG("Ready to transmit %zd bytes...", output_data.len);
@@ -512,30 +664,21 @@ static int send_ring_buffer(void)
 		err = -ENODEV;
 	}
 	if (!err) {
-		stats.lines_sent += num_msgs;
+		stats.lines_sent += lines;
 		stats.bytes_sent += output_data.len;
 	}
 
 cleanup:
 	if (err) {
-		LOG_ERR("Error %d ret %d processing ring buffer", err, ret);
-	}
-
-	ret = ring_buf_get_finish(&log_nrf_cloud_rb, stored);
-	ring_buf_reset(&log_nrf_cloud_rb);
-	num_msgs = 0;
-
-	if (ret) {
-		LOG_ERR("Error finishing ring buffer: %d", ret);
-		err = ret;
-	}
-	if (log_b64_ptr) {
-		nrf_cloud_free(log_b64_ptr);
+		LOG_ERR("Error %d processing ring buffer", err);
 	}
+	batch_release(&output_data);
 	if (topic) {
 		nrf_cloud_free(topic);
 	}
 
+	k_mutex_unlock(&send_lock);
+
 	return err;
 }
 
@@ -596,6 +739,8 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 		data.len = size;
 	}
 
+	(void)k_mutex_lock(&ring_buf_lock, K_FOREVER);
+
 	stats.lines_rendered++;
 	stats.bytes_rendered += data.len;
 
@@ -608,6 +753,12 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 		if (ring_buf_space_get(&log_nrf_cloud_rb) > (data.len + extra)) {
 
 			if (num_msgs == 0) {
+				if (BATCH_WINDOW_MS) {
+					/* Start a new batch, to be sent when the window closes */
+					batch_start_ms = k_uptime_get();
+					batch_flush_schedule();
+				}
+
 				/* Insert start of buffer marker */
 				if (log_format_current == LOG_OUTPUT_TEXT) {
 					/* Open JSON array */
@@ -637,7 +788,11 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 			break;
 		}
 
-		/* Low on space, so send everything. */
+		/* Low on space, so send everything. The ring buffer lock is not held
+		 * while sending or waiting.
+		 */
+		k_mutex_unlock(&ring_buf_lock);
+
 		if (logger_is_ready(&log_nrf_cloud_backend) == 0) {
 			err = send_ring_buffer();
 			if (!err) {
@@ -647,13 +802,19 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 			k_sleep(K_MSEC(LOG_OUTPUT_RETRY_DELAY_MS));
 			retry_count++;
 		} else {
-			if (log_format_current == LOG_OUTPUT_TEXT) {
-				cJSON_free((void *)data.ptr);
-			}
 			err = -ETIMEDOUT;
 		}
+
+		(void)k_mutex_lock(&ring_buf_lock, K_FOREVER);
 	} while (!err);
 
+	k_mutex_unlock(&ring_buf_lock);
+
+	if (err && (log_format_current == LOG_OUTPUT_TEXT)) {
+		/* The rendering was not stored */
+		cJSON_free((void *)data.ptr);
+	}
+
 	if (err) {
 		LOG_ERR("Error sending log: %d", err);
 	}
@@ -80,6 +80,11 @@ LOG_MODULE_REGISTER(nrf_cloud_rest, CONFIG_NRF_CLOUD_REST_LOG_LEVEL);
 #define API_DEVICES_MSGS_D2C_TPC_TMPLT	"d/%s/d2c%s"
 #define API_DEVICES_MSGS_BULK		NRF_CLOUD_BULK_MSG_TOPIC
 
+/* Longest GNSS device message: a PVT object with six numbers of up to 24 characters each,
+ * or an NMEA sentence of NRF_MODEM_GNSS_NMEA_MAX_LEN characters, plus the keys and timestamp.
+ */
+#define GNSS_MSG_JSON_SIZE_MAX		384
+
 #define JITP_HOSTNAME_TLS	CONFIG_NRF_CLOUD_HOST_NAME
 #define JITP_PORT		8443
 #define JITP_URL		"/topics/jitp?qos=1"
@@ -520,7 +525,7 @@ int nrf_cloud_rest_location_get(struct nrf_cloud_rest_context *const rest_ctx,
 	char *auth_hdr = NULL;
 	struct rest_client_req_context req;
 	struct rest_client_resp_context resp;
-	NRF_CLOUD_OBJ_JSON_DEFINE(payload_obj);
+	struct nrf_cloud_data payload = {0};
 
 	memset(&resp, 0, sizeof(resp));
 	init_rest_client_request(rest_ctx, &req, HTTP_POST);
@@ -553,30 +558,17 @@ int nrf_cloud_rest_location_get(struct nrf_cloud_rest_context *const rest_ctx,
 
 	req.header_fields = (const char **)headers;
 
-	/* Init the payload object */
-	ret = nrf_cloud_obj_init(&payload_obj);
-	if (ret) {
-		goto clean_up;
-	}
-
-	/* Add the location request payload */
-	ret = nrf_cloud_obj_location_request_payload_add(&payload_obj,
-							 request->cell_info,
-							 request->wifi_info);
+	/* Encode the location request payload */
+	ret = nrf_cloud_location_request_payload_encode(request->cell_info,
+							request->wifi_info,
+							&payload);
 	if (ret) {
 		LOG_ERR("Failed to create location request payload, err: %d", ret);
 		goto clean_up;
 	}
 
-	/* Encode the payload to be sent to the cloud */
-	ret = nrf_cloud_obj_cloud_encode(&payload_obj);
-	if (ret) {
-		LOG_ERR("Failed to encode location request, err: %d", ret);
-		goto clean_up;
-	}
-
 	/* Add the encoded payload to the REST request */
-	req.body = payload_obj.encoded_data.ptr;
+	req.body = payload.ptr;
 
 	/* Make REST call */
 	ret = do_rest_client_request(rest_ctx, &req, &resp, true, do_reply);
@@ -600,9 +592,8 @@ int nrf_cloud_rest_location_get(struct nrf_cloud_rest_context *const rest_ctx,
 
 clean_up:
 	nrf_cloud_free(auth_hdr);
-	/* Free the object and the encoded data */
-	(void)nrf_cloud_obj_free(&payload_obj);
-	(void)nrf_cloud_obj_cloud_encoded_free(&payload_obj);
+	/* Free the encoded payload */
+	nrf_cloud_free((void *)payload.ptr);
 
 	if (result) {
 		/* Add the nRF Cloud error to the response */
@@ -1066,35 +1057,26 @@ int nrf_cloud_rest_send_location(struct nrf_cloud_rest_context *const rest_ctx,
 	__ASSERT_NO_MSG(device_id != NULL);
 	__ASSERT_NO_MSG(gnss != NULL);
 
-	int err = -ENOMEM;
-	char *json_msg = NULL;
-	cJSON *msg_obj = NULL;
+	int len;
+	char json_msg[GNSS_MSG_JSON_SIZE_MAX];
+	struct nrf_cloud_json_writer wr;
 
 	(void)nrf_cloud_codec_init(NULL);
 
-	msg_obj = cJSON_CreateObject();
-	err = nrf_cloud_gnss_msg_json_encode(gnss, msg_obj);
-	if (err) {
-		goto clean_up;
+	nrf_cloud_json_writer_init(&wr, json_msg, sizeof(json_msg));
+	(void)nrf_cloud_json_obj_start(&wr, NULL);
+	(void)nrf_cloud_gnss_msg_json_write(gnss, &wr);
+	(void)nrf_cloud_json_obj_end(&wr);
+	len = nrf_cloud_json_writer_finish(&wr);
+	if (len == -ENOMEM) {
+		LOG_ERR("GNSS message does not fit in %d bytes", GNSS_MSG_JSON_SIZE_MAX);
+		return len;
+	} else if (len < 0) {
+		LOG_ERR("Failed to write JSON");
+		return len;
 	}
 
-	json_msg = cJSON_PrintUnformatted(msg_obj);
-	if (!json_msg) {
-		LOG_ERR("Failed to print JSON");
-		goto clean_up;
-	}
-	cJSON_Delete(msg_obj);
-	msg_obj = NULL;
-
-	err = nrf_cloud_rest_send_device_message(rest_ctx, device_id, json_msg, false, NULL);
-
-clean_up:
-	cJSON_Delete(msg_obj);
-	if (json_msg) {
-		cJSON_free((void *)json_msg);
-	}
-
-	return err;
+	return nrf_cloud_rest_send_device_message(rest_ctx, device_id, json_msg, false, NULL);
 }
 
 int nrf_cloud_rest_send_device_message(struct nrf_cloud_rest_context *const rest_ctx,
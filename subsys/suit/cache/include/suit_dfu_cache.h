@@ -131,6 +131,14 @@ void suit_dfu_cache_clear(struct dfu_cache *cache);
 suit_plat_err_t suit_dfu_cache_search(const uint8_t *uri, size_t uri_size, const uint8_t **payload,
 				      size_t *payload_size);
 
+/**
+ * @brief Invalidate the index of the cache slots.
+ *
+ * To be called whenever the content of a cache pool is modified without the use of the cache
+ * slot API, i.e. when a raw image is written to the cache partition.
+ */
+void suit_dfu_cache_index_invalidate(void);
+
 #ifdef __cplusplus
 }
 #endif
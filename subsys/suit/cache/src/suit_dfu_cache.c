@@ -12,6 +12,7 @@
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/devicetree.h>
 #include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/sys/util_macro.h>
 
 #include "suit_dfu_cache_internal.h"
@@ -21,6 +22,39 @@ LOG_MODULE_REGISTER(dfu_cache, CONFIG_SUIT_LOG_LEVEL);
 static bool init_done;
 static struct dfu_cache dfu_cache;
 
+#ifdef CONFIG_SUIT_CACHE_INDEX
+/* Location of a cache slot, looked up by the digest of its URI */
+struct cache_index_entry {
+	uint32_t uri_digest;
+	size_t uri_size;
+	uintptr_t uri_address;
+	uintptr_t payload_offset;
+	size_t payload_size;
+};
+
+static struct {
+	/* Entries are kept in the order of the slots in the cache pools */
+	struct cache_index_entry entries[CONFIG_SUIT_CACHE_INDEX_SIZE];
+	size_t count;
+	/* The index is built on the first search after initialization */
+	bool built;
+	/* All the slots of the cache pools are in the index */
+	bool complete;
+} cache_index;
+#endif /* CONFIG_SUIT_CACHE_INDEX */
+
+/**
+ * @brief Get the length of the uri, without the null terminator if present.
+ */
+static size_t uri_len_get(const struct zcbor_string *uri)
+{
+	if (uri->value[uri->len - 1] == '\0') {
+		return uri->len - 1;
+	}
+
+	return uri->len;
+}
+
 /**
  * @brief Check if current_key is same as uri
  *
@@ -31,17 +65,8 @@ static struct dfu_cache dfu_cache;
  */
 static bool uricmp(const struct zcbor_string *current_key, const struct zcbor_string *uri)
 {
-	/* Check what type of string is uri */
-	if (uri->value[uri->len - 1] == '\0') {
-		/* uri is null terminated string */
-		if ((uri->len - 1) != current_key->len) {
-			return false;
-		}
-	} else {
-		/* uri is zcbor tstr */
-		if (uri->len != current_key->len) {
-			return false;
-		}
+	if (uri_len_get(uri) != current_key->len) {
+		return false;
 	}
 
 	return !strncmp(current_key->value, uri->value, current_key->len);
@@ -59,8 +84,8 @@ struct match_uri_ctx {
  * @brief Foreach callback for matching.
  */
 static bool match_uri(struct dfu_cache_pool *cache_pool, zcbor_state_t *state,
-		      const struct zcbor_string *uri, uintptr_t payload_offset, size_t payload_size,
-		      void *ctx)
+		      const struct zcbor_string *uri, uintptr_t uri_address, uintptr_t payload_offset,
+		      size_t payload_size, void *ctx)
 {
 	struct match_uri_ctx *cb_ctx = ctx;
 
@@ -112,6 +137,182 @@ static suit_plat_err_t search_cache_pool(struct dfu_cache_pool *cache_pool,
 	return SUIT_PLAT_ERR_INVAL;
 }
 
+#ifdef CONFIG_SUIT_CACHE_INDEX
+/**
+ * @brief Calculate the 32-bit FNV-1a digest of an URI.
+ */
+static uint32_t uri_digest(const uint8_t *uri, size_t uri_len)
+{
+	uint32_t digest = 2166136261U;
+
+	for (size_t i = 0; i < uri_len; i++) {
+		digest ^= uri[i];
+		digest *= 16777619U;
+	}
+
+	return digest;
+}
+
+static void index_entry_add(const uint8_t *uri, size_t uri_len, uintptr_t uri_address,
+			    uintptr_t payload_offset, size_t payload_size)
+{
+	if (cache_index.count == ARRAY_SIZE(cache_index.entries)) {
+		if (cache_index.complete) {
+			LOG_WRN("Cache index full, CONFIG_SUIT_CACHE_INDEX_SIZE is %d",
+				CONFIG_SUIT_CACHE_INDEX_SIZE);
+		}
+
+		cache_index.complete = false;
+		return;
+	}
+
+	cache_index.entries[cache_index.count++] = (struct cache_index_entry){
+		.uri_digest = uri_digest(uri, uri_len),
+		.uri_size = uri_len,
+		.uri_address = uri_address,
+		.payload_offset = payload_offset,
+		.payload_size = payload_size,
+	};
+}
+
+/**
+ * @brief Foreach callback for building the index.
+ */
+static bool index_slot_add(struct dfu_cache_pool *cache_pool, zcbor_state_t *state,
+			   const struct zcbor_string *uri, uintptr_t uri_address,
+			   uintptr_t payload_offset, size_t payload_size, void *ctx)
+{
+	index_entry_add(uri->value, uri->len, uri_address, payload_offset, payload_size);
+
+	return true;
+}
+
+static void index_build(void)
+{
+	cache_index.count = 0;
+	cache_index.complete = true;
+
+	for (size_t i = 0; i < dfu_cache.pools_count; i++) {
+		if (dfu_cache.pools[i].address == NULL) {
+			continue;
+		}
+
+		/* A corrupted pool is indexed up to the corrupted slot, same as it is searched */
+		(void)suit_dfu_cache_partition_slot_foreach(&dfu_cache.pools[i], index_slot_add,
+							    NULL);
+	}
+
+	cache_index.built = true;
+
+	LOG_DBG("Cache index built: %zu slots, complete: %d", cache_index.count,
+		cache_index.complete);
+}
+
+/**
+ * @brief Search the index for a slot with key equal to uri
+ *
+ * @param uri Desired URI
+ * @param payload Output pointer to data in slot
+ * @return suit_plat_err_t SUIT_PLAT_SUCCESS in case of success, otherwise error code
+ */
+static suit_plat_err_t index_search(const struct zcbor_string *uri, struct zcbor_string *payload)
+{
+	uint8_t current_key[CONFIG_SUIT_MAX_URI_LENGTH];
+	size_t uri_len = uri_len_get(uri);
+	uint32_t digest;
+
+	if (!cache_index.built) {
+		index_build();
+	}
+
+	if (uri_len > sizeof(current_key)) {
+		return SUIT_PLAT_ERR_NOT_FOUND;
+	}
+
+	digest = uri_digest(uri->value, uri_len);
+
+	for (size_t i = 0; i < cache_index.count; i++) {
+		const struct cache_index_entry *entry = &cache_index.entries[i];
+
+		if ((entry->uri_digest != digest) || (entry->uri_size != uri_len)) {
+			continue;
+		}
+
+		/* Rule out digest collisions */
+		if ((suit_dfu_cache_memcpy(current_key, entry->uri_address, entry->uri_size) !=
+		     SUIT_PLAT_SUCCESS) ||
+		    memcmp(current_key, uri->value, uri_len)) {
+			continue;
+		}
+
+		payload->value = (uint8_t *)entry->payload_offset;
+		payload->len = entry->payload_size;
+
+		return SUIT_PLAT_SUCCESS;
+	}
+
+	return SUIT_PLAT_ERR_NOT_FOUND;
+}
+#endif /* CONFIG_SUIT_CACHE_INDEX */
+
+void suit_dfu_cache_index_slot_add(uintptr_t slot_address, uintptr_t payload_offset,
+				   size_t payload_size)
+{
+#ifdef CONFIG_SUIT_CACHE_INDEX
+	uint8_t slot_header[CACHE_METADATA_MAX_LENGTH];
+	size_t header_size = MIN(sizeof(slot_header), payload_offset - slot_address);
+	zcbor_state_t states[2];
+	struct zcbor_string uri;
+	uint8_t *header_start = slot_header;
+
+	if (!cache_index.built) {
+		/* The slot is indexed along with the others on the next search */
+		return;
+	}
+
+	if (suit_dfu_cache_memcpy(slot_header, slot_address, header_size) != SUIT_PLAT_SUCCESS) {
+		cache_index.complete = false;
+		return;
+	}
+
+	if ((header_size > 0) && (slot_header[0] == 0xBF)) {
+		/* Skip the indefinite map header of the first slot of a pool */
+		header_start++;
+		header_size--;
+	}
+
+	zcbor_new_decode_state(states, ZCBOR_ARRAY_SIZE(states), header_start, header_size, 1, NULL,
+			       0);
+
+	if (!zcbor_tstr_decode(states, &uri)) {
+		cache_index.complete = false;
+		return;
+	}
+
+	index_entry_add(uri.value, uri.len, slot_address + (uri.value - slot_header),
+			payload_offset, payload_size);
+#endif /* CONFIG_SUIT_CACHE_INDEX */
+}
+
+void suit_dfu_cache_index_drop(uintptr_t address, size_t size)
+{
+#ifdef CONFIG_SUIT_CACHE_INDEX
+	size_t kept = 0;
+
+	for (size_t i = 0; i < cache_index.count; i++) {
+		const struct cache_index_entry *entry = &cache_index.entries[i];
+
+		if ((entry->uri_address >= address) && (entry->uri_address - address < size)) {
+			continue;
+		}
+
+		cache_index.entries[kept++] = *entry;
+	}
+
+	cache_index.count = kept;
+#endif /* CONFIG_SUIT_CACHE_INDEX */
+}
+
 suit_plat_err_t suit_dfu_cache_search(const uint8_t *uri, size_t uri_size, const uint8_t **payload,
 				      size_t *payload_size)
 {
@@ -119,6 +320,20 @@ suit_plat_err_t suit_dfu_cache_search(const uint8_t *uri, size_t uri_size, const
 		struct zcbor_string tmp_payload = {.len = 0, .value = NULL};
 		struct zcbor_string tmp_uri = {.len = uri_size, .value = uri};
 
+#ifdef CONFIG_SUIT_CACHE_INDEX
+		if (index_search(&tmp_uri, &tmp_payload) == SUIT_PLAT_SUCCESS) {
+			*payload = tmp_payload.value;
+			*payload_size = tmp_payload.len;
+
+			return SUIT_PLAT_SUCCESS;
+		}
+
+		if (cache_index.complete) {
+			/* No need to iterate over the cache pools */
+			return SUIT_PLAT_ERR_NOT_FOUND;
+		}
+#endif /* CONFIG_SUIT_CACHE_INDEX */
+
 		for (size_t i = 0; i < dfu_cache.pools_count; i++) {
 			suit_plat_err_t ret =
 				search_cache_pool(&dfu_cache.pools[i], &tmp_uri, &tmp_payload);
@@ -175,6 +390,21 @@ static suit_plat_err_t suit_dfu_cache_copy(struct dfu_cache *dst_cache,
 	return SUIT_PLAT_SUCCESS;
 }
 
+static void index_clear(void)
+{
+#ifdef CONFIG_SUIT_CACHE_INDEX
+	cache_index.count = 0;
+	cache_index.built = false;
+	cache_index.complete = false;
+#endif /* CONFIG_SUIT_CACHE_INDEX */
+}
+
+void suit_dfu_cache_index_invalidate(void)
+{
+	/* The index is rebuilt from the current content of the cache pools on the next search */
+	index_clear();
+}
+
 suit_plat_err_t suit_dfu_cache_initialize(struct dfu_cache *cache)
 {
 	if (init_done) {
@@ -188,6 +418,8 @@ suit_plat_err_t suit_dfu_cache_initialize(struct dfu_cache *cache)
 		return ret;
 	}
 
+	/* The index is built on the first search, when the cache pools can be read */
+	index_clear();
 	init_done = true;
 
 	return SUIT_PLAT_SUCCESS;
@@ -196,5 +428,6 @@ suit_plat_err_t suit_dfu_cache_initialize(struct dfu_cache *cache)
 void suit_dfu_cache_deinitialize(void)
 {
 	suit_dfu_cache_clear(&dfu_cache);
+	index_clear();
 	init_done = false;
 }
@@ -170,6 +170,8 @@ static suit_plat_err_t erase_on_sink(uint8_t *address, size_t size)
 
 	LOG_DBG("Erasing memory: %p(size:%u)", (void *)address, size);
 
+	suit_dfu_cache_index_drop((uintptr_t)address, size);
+
 	suit_plat_err_t ret = suit_flash_sink_get(&sink, address, size);
 
 	if (ret != SUIT_PLAT_SUCCESS) {
@@ -646,6 +648,10 @@ suit_plat_err_t suit_dfu_cache_rw_slot_close(struct suit_cache_slot *slot, size_
 			return SUIT_PLAT_ERR_IO;
 		}
 
+		suit_dfu_cache_index_slot_add((uintptr_t)slot->slot_address,
+					      (uintptr_t)slot->slot_address + slot->data_offset,
+					      size_used);
+
 		return SUIT_PLAT_SUCCESS;
 	}
 
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <mbedtls/platform_util.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include "aead_key.h"
+
+/*
+ * Cache of derived AEAD keys.
+ *
+ * Deriving a key can be expensive (for example when using the HUK), and the
+ * same UID is often accessed repeatedly. The least recently used key is
+ * evicted when the cache is full. Evicted keys are zeroized.
+ */
+
+struct key_cache_entry {
+	psa_storage_uid_t uid;
+	uint32_t last_used;
+	bool valid;
+	uint8_t key[AEAD_KEY_SIZE];
+};
+
+static struct key_cache_entry key_cache[CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE_SIZE];
+static uint32_t key_cache_clock;
+static K_MUTEX_DEFINE(key_cache_mutex);
+
+static void entry_evict(struct key_cache_entry *entry)
+{
+	mbedtls_platform_zeroize(entry, sizeof(*entry));
+}
+
+/* Returns the entry for the UID, or the entry to be replaced if the UID is not cached. */
+static struct key_cache_entry *entry_find(psa_storage_uid_t uid, bool *hit)
+{
+	struct key_cache_entry *victim = &key_cache[0];
+
+	for (size_t i = 0; i < ARRAY_SIZE(key_cache); i++) {
+		struct key_cache_entry *entry = &key_cache[i];
+
+		if (entry->valid && entry->uid == uid) {
+			*hit = true;
+			return entry;
+		}
+
+		if (!victim->valid) {
+			continue;
+		}
+
+		if (!entry->valid || (entry->last_used < victim->last_used)) {
+			victim = entry;
+		}
+	}
+
+	*hit = false;
+	return victim;
+}
+
+psa_status_t trusted_storage_get_key_cached(psa_storage_uid_t uid, uint8_t *key_buf,
+					    size_t key_length)
+{
+	psa_status_t status = PSA_SUCCESS;
+	struct key_cache_entry *entry;
+	bool hit;
+
+	if (key_length < AEAD_KEY_SIZE) {
+		return PSA_ERROR_BUFFER_TOO_SMALL;
+	}
+
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+
+	entry = entry_find(uid, &hit);
+	if (!hit) {
+		entry_evict(entry);
+
+		status = trusted_storage_get_key(uid, entry->key, sizeof(entry->key));
+		if (status != PSA_SUCCESS) {
+			entry_evict(entry);
+			goto unlock;
+		}
+
+		entry->uid = uid;
+		entry->valid = true;
+	}
+
+	/* On wrap-around, the recency order is briefly wrong, which only affects performance. */
+	entry->last_used = ++key_cache_clock;
+	memcpy(key_buf, entry->key, AEAD_KEY_SIZE);
+
+unlock:
+	k_mutex_unlock(&key_cache_mutex);
+
+	return status;
+}
+
+void trusted_storage_key_cache_evict(psa_storage_uid_t uid)
+{
+	bool hit;
+	struct key_cache_entry *entry;
+
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+
+	entry = entry_find(uid, &hit);
+	if (hit) {
+		entry_evict(entry);
+	}
+
+	k_mutex_unlock(&key_cache_mutex);
+}
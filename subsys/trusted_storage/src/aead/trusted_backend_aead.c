@@ -93,7 +93,7 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 	}
 
 	/* Get AEAD key */
-	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
+	status = trusted_storage_get_key_cached(uid, key_buf, AEAD_KEY_SIZE);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
@@ -173,7 +173,7 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 	}
 
 	/* Get AEAD key */
-	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
+	status = trusted_storage_get_key_cached(uid, key_buf, AEAD_KEY_SIZE);
 	if (status != PSA_SUCCESS) {
 		goto cleanup_objects;
 	}
@@ -238,6 +238,8 @@ psa_status_t trusted_remove(const psa_storage_uid_t uid, const char *prefix)
 		return PSA_ERROR_NOT_PERMITTED;
 	}
 
+	trusted_storage_key_cache_evict(uid);
+
 	return storage_remove_object(uid, prefix);
 }
 
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+#include <modem/at_monitor.h>
+#include <nrf_modem_at.h>
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(int, nrf_modem_at_notif_handler_set, nrf_modem_at_notif_handler_t);
+
+/* at_monitor_dispatch() is implemented in the AT monitor library and
+ * is called directly to fake received notifications.
+ */
+extern void at_monitor_dispatch(const char *notif);
+
+/* Time for the system workqueue to dispatch the notifications */
+#define WORKQUEUE_WAIT K_MSEC(10)
+
+#define TEST_MONITOR(name, filter, ...)                                                            \
+	static int name##_calls;                                                                   \
+	AT_MONITOR(name, filter, name##_handler, __VA_ARGS__);                                     \
+	static void name##_handler(const char *notif)                                              \
+	{                                                                                          \
+		name##_calls++;                                                                    \
+	}
+
+#define TEST_MONITOR_ISR(name, filter, ...)                                                        \
+	static int name##_calls;                                                                   \
+	AT_MONITOR_ISR(name, filter, name##_handler, __VA_ARGS__);                                 \
+	static void name##_handler(const char *notif)                                              \
+	{                                                                                          \
+		name##_calls++;                                                                    \
+	}
+
+TEST_MONITOR(cereg_1, "+CEREG")
+TEST_MONITOR(cereg_2, "+CEREG")
+TEST_MONITOR(ce, "+CE")
+TEST_MONITOR(reg, "REG: 5")
+TEST_MONITOR(eg, "EG")
+TEST_MONITOR(any, ANY)
+TEST_MONITOR(empty, "")
+TEST_MONITOR(cscon, "+CSCON")
+TEST_MONITOR(xmodemsleep, "%XMODEMSLEEP")
+TEST_MONITOR(paused, "+CE", PAUSED)
+TEST_MONITOR_ISR(direct_cereg, "CEREG")
+
+#define RETAINED_MAX 16
+
+static const char *retained[RETAINED_MAX];
+static int retained_count;
+
+AT_MONITOR(retain, "%RETAIN", retain_handler, PAUSED);
+
+static void retain_handler(const char *notif)
+{
+	if (retained_count < RETAINED_MAX) {
+		at_monitor_notif_retain(notif);
+		retained[retained_count++] = notif;
+	}
+}
+
+struct test_monitor {
+	struct at_monitor_entry *entry;
+	int *calls;
+};
+
+static const struct test_monitor test_monitors[] = {
+	{&cereg_1, &cereg_1_calls},	    {&cereg_2, &cereg_2_calls},
+	{&ce, &ce_calls},		    {&reg, &reg_calls},
+	{&eg, &eg_calls},		    {&any, &any_calls},
+	{&empty, &empty_calls},		    {&cscon, &cscon_calls},
+	{&xmodemsleep, &xmodemsleep_calls}, {&paused, &paused_calls},
+	{&direct_cereg, &direct_cereg_calls},
+};
+
+static const char *const test_notifs[] = {
+	"+CEREG: 5,\"4321\",\"87654321\",9,,,\"11100000\",\"11100000\"\r\n",
+	"+CEREG: 1\r\n",
+	"+CSCON: 1\r\n",
+	"%XMODEMSLEEP: 1,36000\r\n",
+	"+CESQ: 99,99,255,255,255,255\r\n",
+	"%CESQ: 54,2,16,2\r\n",
+	"+CREG: 5\r\n",
+	"+CE\r\n",
+	"+C\r\n",
+	"\r\n",
+	"",
+};
+
+static void calls_reset(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(test_monitors); i++) {
+		*test_monitors[i].calls = 0;
+	}
+}
+
+static bool strstr_match(const struct at_monitor_entry *mon, const char *notif)
+{
+	return (mon->filter == ANY || strstr(notif, mon->filter));
+}
+
+static void at_monitor_test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	calls_reset();
+	at_monitor_pause(&paused);
+}
+
+static void at_monitor_test_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	at_monitor_pause(&retain);
+
+	for (int i = 0; i < retained_count; i++) {
+		at_monitor_notif_release(retained[i]);
+	}
+	retained_count = 0;
+}
+
+ZTEST(at_monitor, test_dispatch_matches_strstr)
+{
+	for (size_t n = 0; n < ARRAY_SIZE(test_notifs); n++) {
+		calls_reset();
+
+		at_monitor_dispatch(test_notifs[n]);
+		k_sleep(WORKQUEUE_WAIT);
+
+		for (size_t i = 0; i < ARRAY_SIZE(test_monitors); i++) {
+			const struct test_monitor *mon = &test_monitors[i];
+			int expected = (!mon->entry->flags.paused &&
+					strstr_match(mon->entry, test_notifs[n])) ? 1 : 0;
+
+			zassert_equal(*mon->calls, expected,
+				      "Monitor \"%s\" called %d times for notification \"%s\"",
+				      mon->entry->filter ? mon->entry->filter : "ANY", *mon->calls,
+				      test_notifs[n]);
+		}
+	}
+}
+
+ZTEST(at_monitor, test_direct_dispatch)
+{
+	at_monitor_dispatch("+CEREG: 1\r\n");
+
+	/* Monitors in ISR are dispatched immediately */
+	zassert_equal(direct_cereg_calls, 1);
+	zassert_equal(cereg_1_calls, 0);
+
+	k_sleep(WORKQUEUE_WAIT);
+
+	zassert_equal(direct_cereg_calls, 1);
+	zassert_equal(cereg_1_calls, 1);
+	zassert_equal(cereg_2_calls, 1);
+}
+
+ZTEST(at_monitor, test_pause_resume)
+{
+	at_monitor_dispatch("+CESQ: 99,99,255,255,255,255\r\n");
+	k_sleep(WORKQUEUE_WAIT);
+
+	zassert_equal(ce_calls, 1);
+	zassert_equal(paused_calls, 0);
+
+	at_monitor_resume(&paused);
+
+	at_monitor_dispatch("+CESQ: 99,99,255,255,255,255\r\n");
+	k_sleep(WORKQUEUE_WAIT);
+
+	zassert_equal(ce_calls, 2);
+	zassert_equal(paused_calls, 1);
+}
+
+ZTEST(at_monitor, test_pause_after_dispatch)
+{
+	/* A monitor that is paused before the workqueue runs is not dispatched to */
+	at_monitor_dispatch("+CSCON: 0\r\n");
+	at_monitor_pause(&cscon);
+	k_sleep(WORKQUEUE_WAIT);
+
+	zassert_equal(cscon_calls, 0);
+	zassert_equal(any_calls, 1);
+
+	at_monitor_resume(&cscon);
+}
+
+ZTEST(at_monitor, test_queued_notifications)
+{
+	at_monitor_dispatch("+CEREG: 2\r\n");
+	at_monitor_dispatch("+CSCON: 1\r\n");
+	at_monitor_dispatch("+CEREG: 1\r\n");
+	k_sleep(WORKQUEUE_WAIT);
+
+	zassert_equal(cereg_1_calls, 2);
+	zassert_equal(cscon_calls, 1);
+	zassert_equal(ce_calls, 3);
+	zassert_equal(any_calls, 3);
+}
+
+ZTEST(at_monitor, test_retain)
+{
+	struct at_monitor_stats stats;
+
+	at_monitor_resume(&retain);
+
+	at_monitor_dispatch("%RETAIN: 1\r\n");
+	k_sleep(WORKQUEUE_WAIT);
+
+	zassert_equal(retained_count, 1);
+	zassert_str_equal(retained[0], "%RETAIN: 1\r\n");
+
+	/* Notifications received after the retained one do not overwrite it */
+	at_monitor_dispatch("+CSCON: 1\r\n");
+	at_monitor_dispatch("+CEREG: 1\r\n");
+	k_sleep(WORKQUEUE_WAIT);
+
+	zassert_equal(cscon_calls, 1);
+	zassert_equal(cereg_1_calls, 1);
+	zassert_str_equal(retained[0], "%RETAIN: 1\r\n");
+
+	at_monitor_stats_get(&stats);
+	zassert_true(stats.used > 0);
+	zassert_true(stats.peak >= stats.used);
+
+	at_monitor_notif_release(retained[0]);
+	retained_count = 0;
+
+	at_monitor_stats_get(&stats);
+	zassert_equal(stats.used, 0, "%zu bytes still in use", stats.used);
+}
+
+ZTEST(at_monitor, test_store_full)
+{
+	struct at_monitor_stats stats_before;
+	struct at_monitor_stats stats;
+
+	at_monitor_stats_get(&stats_before);
+	at_monitor_resume(&retain);
+
+	/* Retained notifications fill up the store */
+	for (int i = 0; i < RETAINED_MAX; i++) {
+		at_monitor_dispatch("%RETAIN: 0123456789\r\n");
+		k_sleep(WORKQUEUE_WAIT);
+	}
+
+	at_monitor_stats_get(&stats);
+	zassert_true(retained_count < RETAINED_MAX);
+	zassert_equal(stats.drops, stats_before.drops + (RETAINED_MAX - retained_count));
+	zassert_true(stats.peak <= stats.size);
+
+	for (int i = 0; i < retained_count; i++) {
+		zassert_str_equal(retained[i], "%RETAIN: 0123456789\r\n");
+		at_monitor_notif_release(retained[i]);
+	}
+	retained_count = 0;
+
+	at_monitor_stats_get(&stats);
+	zassert_equal(stats.used, 0, "%zu bytes still in use", stats.used);
+
+	/* The store is usable again */
+	at_monitor_dispatch("+CSCON: 1\r\n");
+	k_sleep(WORKQUEUE_WAIT);
+
+	zassert_equal(cscon_calls, 1);
+}
+
+ZTEST(at_monitor, test_release_out_of_order)
+{
+	struct at_monitor_stats stats;
+
+	at_monitor_resume(&retain);
+
+	for (int i = 0; i < 3; i++) {
+		at_monitor_dispatch("%RETAIN: 1\r\n");
+		k_sleep(WORKQUEUE_WAIT);
+	}
+
+	zassert_equal(retained_count, 3);
+
+	/* Space is only reused when the oldest notification is released */
+	at_monitor_notif_release(retained[1]);
+	at_monitor_notif_release(retained[2]);
+
+	at_monitor_stats_get(&stats);
+	zassert_true(stats.used > 0);
+
+	at_monitor_notif_release(retained[0]);
+	retained_count = 0;
+
+	at_monitor_stats_get(&stats);
+	zassert_equal(stats.used, 0, "%zu bytes still in use", stats.used);
+}
+
+ZTEST_SUITE(at_monitor, NULL, NULL, at_monitor_test_before, at_monitor_test_after, NULL);
@@ -2033,4 +2033,260 @@ ZTEST(at_parser, test_at_parser_cmd_next)
 	zassert_equal(num, 6);
 }
 
+static const char * const ncellmeas =
+	"%NCELLMEAS: 0,"
+	"\"00112233\",\"98712\",\"0AB9\",4800,7,63,31,456,4800,"
+	"333333,100,101,102,0,333333,103,104,105,0,"
+	"333333,106,107,108,0,333333,109,110,111,0,"
+	"444444,112,113,114,0,444444,115,116,117,0,"
+	"444444,118,119,120,0,444444,121,122,123,0,"
+	"555555,124,125,126,0,555555,127,128,129,0,"
+	"555555,130,131,132,0,555555,133,134,135,0,"
+	"666666,136,137,138,0,666666,139,140,141,0,"
+	"666666,142,143,144,0,666666,145,146,147,0,"
+	"777777,148,149,150,0,777777,151,152,153,0,"
+	"888888,154,155,156,0,888888,157,158,159,0,"
+	"11\r\n";
+
+static const char * const xmonitor =
+	"%XMONITOR: 5,\"Operator\",\"OP\",\"20065\",\"4321\",9,20,\"12345678\","
+	"334,6200,66,44,\"\","
+	"\"11100000\",\"11100000\",\"01001001\"\r\nOK\r\n";
+
+#define TOKENS_MAX 128
+
+/* Read all values of the current line of both parsers in reverse order and compare them. */
+static void tokenized_line_compare(struct at_parser *parser, struct at_parser *tokenized)
+{
+	int ret;
+	int ret_tokenized;
+	size_t count = 0;
+	size_t count_tokenized = 0;
+
+	ret = at_parser_cmd_count_get(parser, &count);
+	ret_tokenized = at_parser_cmd_count_get(tokenized, &count_tokenized);
+	zassert_equal(ret, ret_tokenized);
+	zassert_equal(count, count_tokenized);
+
+	for (size_t i = count + 2; i-- > 0;) {
+		const char *str = NULL;
+		const char *str_tokenized = NULL;
+		size_t len = 0;
+		size_t len_tokenized = 0;
+		int64_t num = 0;
+		int64_t num_tokenized = 0;
+
+		ret = at_parser_string_ptr_get(parser, i, &str, &len);
+		ret_tokenized = at_parser_string_ptr_get(tokenized, i, &str_tokenized,
+							 &len_tokenized);
+		zassert_equal(ret, ret_tokenized, "Index %d: %d != %d", i, ret, ret_tokenized);
+		zassert_equal(str, str_tokenized);
+		zassert_equal(len, len_tokenized);
+
+		ret = at_parser_num_get(parser, i, &num);
+		ret_tokenized = at_parser_num_get(tokenized, i, &num_tokenized);
+		zassert_equal(ret, ret_tokenized, "Index %d: %d != %d", i, ret, ret_tokenized);
+		zassert_equal(num, num_tokenized);
+	}
+}
+
+static void tokenized_compare(const char *at, size_t tokens_size)
+{
+	int ret;
+	int ret_tokenized;
+	struct at_parser parser;
+	struct at_parser tokenized;
+	struct at_parser_token tokens[TOKENS_MAX];
+
+	ret = at_parser_init(&parser, at);
+	zassert_ok(ret);
+
+	ret = at_parser_init(&tokenized, at);
+	zassert_ok(ret);
+
+	ret = at_parser_tokenize(&tokenized, tokens, tokens_size);
+	zassert_ok(ret);
+
+	do {
+		tokenized_line_compare(&parser, &tokenized);
+
+		ret = at_parser_cmd_next(&parser);
+		ret_tokenized = at_parser_cmd_next(&tokenized);
+		zassert_equal(ret, ret_tokenized);
+	} while (ret == 0);
+}
+
+ZTEST(at_parser, test_at_parser_tokenize_einval)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[4];
+
+	ret = at_parser_init(&parser, "+NOTIF: 1,2,3\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_tokenize(NULL, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_tokenize(&parser, NULL, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_tokenize(&parser, tokens, 0);
+	zassert_equal(ret, -EINVAL);
+}
+
+ZTEST(at_parser, test_at_parser_tokenize_eperm)
+{
+	int ret;
+	struct at_parser parser = { 0 };
+	struct at_parser_token tokens[4];
+
+	ret = at_parser_tokenize(&parser, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EPERM);
+}
+
+ZTEST(at_parser, test_at_parser_tokenize)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[8];
+	int32_t num = 0;
+	char buffer[32];
+	size_t len = sizeof(buffer);
+	size_t count = 0;
+
+	ret = at_parser_init(&parser, "+NOTIF: 1,\"two\",3,,\r\n+NOTIF2: 4,5\r\nOK\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_tokenize(&parser, tokens, ARRAY_SIZE(tokens));
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 3);
+
+	ret = at_parser_string_get(&parser, 2, buffer, &len);
+	zassert_ok(ret);
+	zassert_mem_equal("two", buffer, len);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 1);
+
+	ret = at_parser_num_get(&parser, 5, &num);
+	zassert_equal(ret, -EOPNOTSUPP);
+
+	ret = at_parser_num_get(&parser, 6, &num);
+	zassert_equal(ret, -EAGAIN);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_ok(ret);
+	zassert_equal(count, 6);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_ok(ret);
+
+	/* The next line is tokenized too */
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 5);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 4);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_equal(ret, -EIO);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_ok(ret);
+	zassert_equal(count, 3);
+}
+
+ZTEST(at_parser, test_at_parser_tokenize_compare)
+{
+	static const char * const *const strings[] = {
+		singleline, multiline, pduline, singleparamline, emptyparamline,
+	};
+	static const size_t counts[] = {
+		ARRAY_SIZE(singleline), ARRAY_SIZE(multiline), ARRAY_SIZE(pduline),
+		ARRAY_SIZE(singleparamline), ARRAY_SIZE(emptyparamline),
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(strings); i++) {
+		for (size_t j = 0; j < counts[i]; j++) {
+			tokenized_compare(strings[i][j], TOKENS_MAX);
+		}
+	}
+
+	tokenized_compare(certificate, TOKENS_MAX);
+	tokenized_compare(ncellmeas, TOKENS_MAX);
+	tokenized_compare(xmonitor, TOKENS_MAX);
+	tokenized_compare("+NOTIF: 1,\"unterminated\r\n", TOKENS_MAX);
+}
+
+ZTEST(at_parser, test_at_parser_tokenize_small_array)
+{
+	/* Values that do not fit in the tokens array are parsed from the string */
+	for (size_t size = 1; size < 8; size++) {
+		tokenized_compare(multiline[0], size);
+		tokenized_compare(emptyparamline[0], size);
+		tokenized_compare(xmonitor, size);
+	}
+
+	tokenized_compare(ncellmeas, 16);
+}
+
+static uint32_t values_reverse_read(struct at_parser *parser, size_t count)
+{
+	uint32_t start = k_cycle_get_32();
+
+	for (size_t i = count; i-- > 1;) {
+		const char *str;
+		size_t len;
+
+		(void)at_parser_string_ptr_get(parser, i, &str, &len);
+	}
+
+	return k_cycle_get_32() - start;
+}
+
+static void benchmark(const char *name, const char *at)
+{
+	int ret;
+	uint32_t cycles;
+	uint32_t cycles_tokenized;
+	size_t count = 0;
+	struct at_parser parser;
+	struct at_parser_token tokens[TOKENS_MAX];
+
+	ret = at_parser_init(&parser, at);
+	zassert_ok(ret);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_ok(ret);
+	zassert_true(count <= TOKENS_MAX);
+
+	cycles = values_reverse_read(&parser, count);
+
+	uint32_t start = k_cycle_get_32();
+
+	ret = at_parser_init(&parser, at);
+	zassert_ok(ret);
+
+	ret = at_parser_tokenize(&parser, tokens, ARRAY_SIZE(tokens));
+	zassert_ok(ret);
+
+	cycles_tokenized = (k_cycle_get_32() - start) + values_reverse_read(&parser, count);
+
+	printk("%s, %d values read in reverse order: %u cycles, %u cycles when tokenized\n",
+	       name, count, cycles, cycles_tokenized);
+}
+
+ZTEST(at_parser, test_at_parser_tokenize_benchmark)
+{
+	benchmark("%NCELLMEAS", ncellmeas);
+	benchmark("%XMONITOR", xmonitor);
+}
+
 ZTEST_SUITE(at_parser, NULL, NULL, NULL, NULL, NULL);
@@ -115,4 +115,135 @@ ZTEST(suite_contin_array, test_simp_arr_loop_short)
 	}
 }
 
+/* Byte by byte reference implementation, as contin_array_create used to be implemented */
+static void contin_array_create_bytewise(void *pcm_cont, uint32_t pcm_cont_size,
+					 void const *const pcm_finite, uint32_t pcm_finite_size,
+					 uint32_t *const finite_pos)
+{
+	for (uint32_t i = 0; i < pcm_cont_size; i++) {
+		if (*finite_pos > (pcm_finite_size - 1)) {
+			*finite_pos = 0;
+		}
+		((char *)pcm_cont)[i] = ((char *)pcm_finite)[*finite_pos];
+		(*finite_pos)++;
+	}
+}
+
+ZTEST(suite_contin_array, test_arr_matches_bytewise)
+{
+	const uint32_t cont_sizes[] = {1, 7, 97, 256, 300, 1000};
+	const uint32_t finite_sizes[] = {1, 44, 255, 256};
+	uint8_t contin_arr[1000];
+	uint8_t contin_arr_ref[1000];
+	int ret;
+
+	for (size_t i = 0; i < ARRAY_SIZE(cont_sizes); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(finite_sizes); j++) {
+			uint32_t finite_pos = 0;
+			uint32_t finite_pos_ref = 0;
+
+			for (int k = 0; k < 20; k++) {
+				ret = contin_array_create(contin_arr, cont_sizes[i], test_arr,
+							  finite_sizes[j], &finite_pos);
+				zassert_equal(ret, 0, "contin_array_create did not return zero");
+
+				contin_array_create_bytewise(contin_arr_ref, cont_sizes[i],
+							     test_arr, finite_sizes[j],
+							     &finite_pos_ref);
+
+				zassert_mem_equal(contin_arr, contin_arr_ref, cont_sizes[i],
+						  "Array differs for size %d and finite size %d",
+						  cont_sizes[i], finite_sizes[j]);
+				zassert_equal(finite_pos, finite_pos_ref,
+					      "Position differs for size %d and finite size %d",
+					      cont_sizes[i], finite_sizes[j]);
+			}
+		}
+	}
+}
+
+ZTEST(suite_contin_array, test_pcm_arr_24_bit)
+{
+	/* Five 24-bit samples, repeated into seven samples per run */
+	const uint32_t finite_size = 5 * 3;
+	uint8_t contin_arr[7 * 3];
+	uint32_t finite_pos = 0;
+	int ret;
+
+	for (int i = 0; i < 10; i++) {
+		ret = contin_array_pcm_create(contin_arr, sizeof(contin_arr), test_arr,
+					      finite_size, &finite_pos, 24);
+		zassert_equal(ret, 0, "contin_array_pcm_create did not return zero");
+
+		for (int j = 0; j < sizeof(contin_arr); j++) {
+			zassert_equal(contin_arr[j], test_arr[((i * sizeof(contin_arr)) + j) %
+							      finite_size],
+				      "Value %d of run %d is not as expected", j, i);
+		}
+	}
+}
+
+ZTEST(suite_contin_array, test_pcm_arr_invalid)
+{
+	uint8_t contin_arr[96];
+	uint32_t finite_pos = 0;
+	int ret;
+
+	ret = contin_array_pcm_create(contin_arr, sizeof(contin_arr), test_arr, 64, &finite_pos,
+				      8);
+	zassert_equal(ret, -EINVAL, "Invalid bit depth did not fail");
+
+	ret = contin_array_pcm_create(contin_arr, 95, test_arr, 64, &finite_pos, 16);
+	zassert_equal(ret, -EINVAL, "Continuous size not a multiple of the sample size did not fail");
+
+	ret = contin_array_pcm_create(contin_arr, sizeof(contin_arr), test_arr, 64, &finite_pos,
+				      24);
+	zassert_equal(ret, -EINVAL, "Finite size not a multiple of the sample size did not fail");
+
+	finite_pos = 2;
+	ret = contin_array_pcm_create(contin_arr, sizeof(contin_arr), test_arr, 64, &finite_pos,
+				      32);
+	zassert_equal(ret, -EINVAL, "Position not a multiple of the sample size did not fail");
+
+	ret = contin_array_pcm_create(contin_arr, sizeof(contin_arr), test_arr, 64, NULL, 16);
+	zassert_equal(ret, -ENXIO, "NULL position did not fail");
+}
+
+#define PERF_ITERATIONS 100
+/* 10 ms of 16-bit mono samples at 48 kHz */
+#define PERF_BLOCK_SIZE 960
+
+ZTEST(suite_contin_array, test_arr_benchmark)
+{
+	static uint8_t contin_arr[PERF_BLOCK_SIZE];
+	/* One period of a 1 kHz tone, and the full test array */
+	const uint32_t finite_sizes[] = {96, sizeof(test_arr)};
+
+	for (size_t i = 0; i < ARRAY_SIZE(finite_sizes); i++) {
+		uint32_t finite_pos = 0;
+		uint32_t start;
+		uint32_t cycles_bytewise;
+		uint32_t cycles;
+
+		start = k_cycle_get_32();
+		for (int j = 0; j < PERF_ITERATIONS; j++) {
+			contin_array_create_bytewise(contin_arr, sizeof(contin_arr), test_arr,
+						     finite_sizes[i], &finite_pos);
+		}
+		cycles_bytewise = k_cycle_get_32() - start;
+
+		finite_pos = 0;
+		start = k_cycle_get_32();
+		for (int j = 0; j < PERF_ITERATIONS; j++) {
+			contin_array_create(contin_arr, sizeof(contin_arr), test_arr,
+					    finite_sizes[i], &finite_pos);
+		}
+		cycles = k_cycle_get_32() - start;
+
+		printk("contin_array %d byte block from %d byte array: %u cycles (byte loop: %u)\n",
+		       PERF_BLOCK_SIZE, finite_sizes[i], cycles / PERF_ITERATIONS,
+		       cycles_bytewise / PERF_ITERATIONS);
+	}
+}
+
 ZTEST_SUITE(suite_contin_array, NULL, NULL, NULL, NULL, NULL);
@@ -5,6 +5,7 @@
  */
 
 #include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
 #include <errno.h>
 #include <data_fifo.h>
 
@@ -231,4 +232,217 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
 }
 
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_get_ok)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "_last_filled_get did not return -ENOMSG");
+
+	/* Wrap around the ring a few times */
+	for (uint32_t i = 0; i < 10; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		data_ptr[0] = i;
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, i + 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		internal_test_remaining_elements(&data_fifo, 1, 1, __LINE__);
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal(((uint8_t *)data_ptr_read)[0], i, "data contents are not identical");
+		zassert_equal(data_size, i + 1, "data size incorrect");
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		data_fifo_block_free(&data_fifo, data_ptr_read);
+
+		internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+	}
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_put_too_many)
+{
+#define SPSC_BLOCKS_NUM 4
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_BLOCKS_NUM, 128);
+
+	int ret;
+	uint8_t *data_ptr;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	for (uint32_t i = 0; i < SPSC_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 5);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+	}
+
+	internal_test_remaining_elements(&data_fifo, SPSC_BLOCKS_NUM, SPSC_BLOCKS_NUM, __LINE__);
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "first_vacant_get did not return -EAGAIN");
+
+	ret = data_fifo_empty(&data_fifo);
+	zassert_equal(ret, 0, "empty did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_lock_out_of_order)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+	uint8_t *data_ptr_1;
+	uint8_t *data_ptr_2;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr_1, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr_2, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_2, 5);
+	zassert_equal(ret, -ESPIPE, "block_lock did not return -ESPIPE");
+
+	internal_test_remaining_elements(&data_fifo, 2, 0, __LINE__);
+}
+
+DATA_FIFO_SPSC_DEFINE(isr_fifo, 4, 128);
+
+static void isr_producer(const void *arg)
+{
+	int ret;
+	uint32_t *data_ptr;
+
+	ret = data_fifo_pointer_first_vacant_get(&isr_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	*data_ptr = (uint32_t)(uintptr_t)arg;
+
+	ret = data_fifo_block_lock(&isr_fifo, (void **)&data_ptr, sizeof(uint32_t));
+	zassert_equal(ret, 0, "block_lock did not return 0");
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_isr)
+{
+	int ret;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&isr_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	for (uint32_t i = 0; i < 10; i++) {
+		irq_offload(isr_producer, (const void *)(uintptr_t)i);
+
+		ret = data_fifo_pointer_last_filled_get(&isr_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal(*(uint32_t *)data_ptr_read, i, "data contents are not identical");
+
+		data_fifo_block_free(&isr_fifo, data_ptr_read);
+	}
+
+	ret = data_fifo_uninit(&isr_fifo);
+	zassert_equal(ret, 0, "uninit did not return 0");
+}
+
+#define BENCHMARK_BLOCKS     1000
+#define BENCHMARK_STACK_SIZE 1024
+
+DATA_FIFO_DEFINE(benchmark_fifo, 8, 128);
+DATA_FIFO_SPSC_DEFINE(benchmark_fifo_spsc, 8, 128);
+
+K_THREAD_STACK_DEFINE(producer_stack, BENCHMARK_STACK_SIZE);
+static struct k_thread producer_thread;
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	struct data_fifo *data_fifo = p1;
+	uint32_t *data_ptr;
+	int ret;
+
+	for (uint32_t i = 0; i < BENCHMARK_BLOCKS; i++) {
+		ret = data_fifo_pointer_first_vacant_get(data_fifo, (void **)&data_ptr, K_FOREVER);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		*data_ptr = i;
+
+		ret = data_fifo_block_lock(data_fifo, (void **)&data_ptr, sizeof(uint32_t));
+		zassert_equal(ret, 0, "block_lock did not return 0");
+	}
+}
+
+/* Pass blocks from a producer thread to the test thread and return the cycles per block */
+static uint32_t internal_benchmark(struct data_fifo *data_fifo)
+{
+	void *data_ptr_read;
+	size_t data_size;
+	uint32_t start;
+	uint32_t cycles;
+	int ret;
+
+	ret = data_fifo_init(data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	start = k_cycle_get_32();
+
+	k_thread_create(&producer_thread, producer_stack, K_THREAD_STACK_SIZEOF(producer_stack),
+			producer, data_fifo, NULL, NULL, k_thread_priority_get(k_current_get()), 0,
+			K_NO_WAIT);
+
+	for (uint32_t i = 0; i < BENCHMARK_BLOCKS; i++) {
+		ret = data_fifo_pointer_last_filled_get(data_fifo, &data_ptr_read, &data_size,
+							K_FOREVER);
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal(*(uint32_t *)data_ptr_read, i, "blocks out of order");
+
+		data_fifo_block_free(data_fifo, data_ptr_read);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	k_thread_join(&producer_thread, K_FOREVER);
+
+	internal_test_remaining_elements(data_fifo, 0, 0, __LINE__);
+
+	ret = data_fifo_uninit(data_fifo);
+	zassert_equal(ret, 0, "uninit did not return 0");
+
+	return cycles / BENCHMARK_BLOCKS;
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_benchmark)
+{
+	uint32_t kernel = internal_benchmark(&benchmark_fifo);
+	uint32_t spsc = internal_benchmark(&benchmark_fifo_spsc);
+
+	printk("data_fifo: %u cycles per block with slab and message queue, %u with SPSC ring\n",
+	       kernel, spsc);
+}
+
 ZTEST_SUITE(suite_data_fifo, NULL, NULL, NULL, NULL, NULL);
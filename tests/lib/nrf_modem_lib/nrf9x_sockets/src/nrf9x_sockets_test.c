@@ -1629,6 +1629,389 @@ void test_nrf9x_socket_offload_sendmsg_not_fits_buf(void)
 	TEST_ASSERT_EQUAL(ret, 0);
 }
 
+void test_nrf9x_socket_offload_sendmsg_single_part_no_copy(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = AF_INET;
+	int type = SOCK_STREAM;
+	int proto = IPPROTO_TCP;
+	int flags = ZSOCK_MSG_DONTWAIT;
+	struct msghdr msg = { 0 };
+	struct iovec chunks[2] = { 0 };
+	int chunk_1 = 42;
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_STREAM, NRF_IPPROTO_TCP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	chunks[0].iov_base = &chunk_1;
+	chunks[0].iov_len = sizeof(int);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 2;
+
+	/* Expect the message part to be passed on without being copied */
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, &chunk_1, sizeof(int),
+					   NRF_MSG_DONTWAIT,
+					   NULL, 0, sizeof(int));
+
+	ret = zsock_sendmsg(fd, &msg, flags);
+
+	TEST_ASSERT_EQUAL(ret, sizeof(int));
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+static struct test_state_nrf_sendto {
+	uint8_t data[16];
+	size_t bytes;
+	int calls;
+} test_state_nrf_sendto;
+
+static ssize_t nrf_sendto_stub(int socket, const void *message, size_t length, int flags,
+			       const struct nrf_sockaddr *dest_addr, nrf_socklen_t dest_len,
+			       int cmock_num_calls)
+{
+	memcpy(test_state_nrf_sendto.data, message,
+	       MIN(length, sizeof(test_state_nrf_sendto.data)));
+	test_state_nrf_sendto.bytes += length;
+	test_state_nrf_sendto.calls++;
+
+	return length;
+}
+
+void test_nrf9x_socket_offload_sendmsg_dgram_not_fits_buf(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = AF_INET;
+	int type = SOCK_DGRAM;
+	int proto = IPPROTO_UDP;
+	int flags = 0;
+	struct msghdr msg = { 0 };
+	struct iovec chunks[3] = { 0 };
+	int chunk[3] = { 42, 43, 44 };
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_DGRAM, NRF_IPPROTO_UDP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(chunks); i++) {
+		chunks[i].iov_base = &chunk[i];
+		chunks[i].iov_len = sizeof(int);
+	}
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = ARRAY_SIZE(chunks);
+
+	memset(&test_state_nrf_sendto, 0, sizeof(test_state_nrf_sendto));
+	__cmock_nrf_sendto_Stub(nrf_sendto_stub);
+
+	/* The datagram is larger than the intermediate buffer, but must not be fragmented */
+	ret = zsock_sendmsg(fd, &msg, flags);
+
+	TEST_ASSERT_EQUAL(ret, sizeof(chunk));
+	TEST_ASSERT_EQUAL(1, test_state_nrf_sendto.calls);
+	TEST_ASSERT_EQUAL_MEMORY(chunk, test_state_nrf_sendto.data, sizeof(chunk));
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+void test_nrf9x_socket_offload_sendmsg_dgram_throughput(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = AF_INET;
+	int type = SOCK_DGRAM;
+	int proto = IPPROTO_UDP;
+	struct msghdr msg = { 0 };
+	struct iovec chunks[4] = { 0 };
+	uint8_t header[2] = { 1, 2 };
+	uint8_t payload[3][4] = { 0 };
+	const int messages = 100;
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_DGRAM, NRF_IPPROTO_UDP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	chunks[0].iov_base = header;
+	chunks[0].iov_len = sizeof(header);
+	for (int i = 1; i < ARRAY_SIZE(chunks); i++) {
+		chunks[i].iov_base = payload[i - 1];
+		chunks[i].iov_len = sizeof(payload[i - 1]);
+	}
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = ARRAY_SIZE(chunks);
+
+	memset(&test_state_nrf_sendto, 0, sizeof(test_state_nrf_sendto));
+	__cmock_nrf_sendto_Stub(nrf_sendto_stub);
+
+	for (int i = 0; i < messages; i++) {
+		ret = zsock_sendmsg(fd, &msg, 0);
+		TEST_ASSERT_EQUAL(sizeof(header) + sizeof(payload), ret);
+	}
+
+	/* Each message is sent with a single call to the modem library */
+	TEST_ASSERT_EQUAL(messages, test_state_nrf_sendto.calls);
+	TEST_ASSERT_EQUAL(messages * (sizeof(header) + sizeof(payload)),
+			  test_state_nrf_sendto.bytes);
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+void test_nrf9x_socket_offload_recvmsg_msg_null_einval(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = AF_INET;
+	int type = SOCK_STREAM;
+	int proto = IPPROTO_TCP;
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_STREAM, NRF_IPPROTO_TCP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	ret = zsock_recvmsg(fd, NULL, 0);
+
+	TEST_ASSERT_EQUAL(ret, -1);
+	TEST_ASSERT_EQUAL(errno, EINVAL);
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+void test_nrf9x_socket_offload_recvmsg_stream_success(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = AF_INET;
+	int type = SOCK_STREAM;
+	int proto = IPPROTO_TCP;
+	struct msghdr msg = { 0 };
+	struct iovec chunks[3] = { 0 };
+	uint8_t chunk_1[4];
+	uint8_t chunk_2[4];
+	uint8_t chunk_3[4];
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_STREAM, NRF_IPPROTO_TCP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	chunks[0].iov_base = chunk_1;
+	chunks[0].iov_len = sizeof(chunk_1);
+	chunks[1].iov_base = chunk_2;
+	chunks[1].iov_len = sizeof(chunk_2);
+	chunks[2].iov_base = chunk_3;
+	chunks[2].iov_len = sizeof(chunk_3);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 3;
+
+	/* Data is received directly into each part, only waiting for the first one */
+	__cmock_nrf_recvfrom_ExpectAndReturn(nrf_fd, chunk_1, sizeof(chunk_1), 0,
+					     NULL, NULL, sizeof(chunk_1));
+	__cmock_nrf_recvfrom_ExpectAndReturn(nrf_fd, chunk_2, sizeof(chunk_2), NRF_MSG_DONTWAIT,
+					     NULL, NULL, 2);
+
+	ret = zsock_recvmsg(fd, &msg, 0);
+
+	TEST_ASSERT_EQUAL(sizeof(chunk_1) + 2, ret);
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+void test_nrf9x_socket_offload_recvmsg_stream_peek(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = AF_INET;
+	int type = SOCK_STREAM;
+	int proto = IPPROTO_TCP;
+	struct msghdr msg = { 0 };
+	struct iovec chunks[2] = { 0 };
+	uint8_t chunk_1[4];
+	uint8_t chunk_2[4];
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_STREAM, NRF_IPPROTO_TCP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	chunks[0].iov_base = chunk_1;
+	chunks[0].iov_len = sizeof(chunk_1);
+	chunks[1].iov_base = chunk_2;
+	chunks[1].iov_len = sizeof(chunk_2);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 2;
+
+	/* Peeking into the second part would return the data of the first part again */
+	__cmock_nrf_recvfrom_ExpectAndReturn(nrf_fd, chunk_1, sizeof(chunk_1), NRF_MSG_PEEK,
+					     NULL, NULL, sizeof(chunk_1));
+
+	ret = zsock_recvmsg(fd, &msg, ZSOCK_MSG_PEEK);
+
+	TEST_ASSERT_EQUAL(sizeof(chunk_1), ret);
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+static struct test_state_nrf_recvfrom_dgram {
+	size_t dgram_len;
+	size_t length;
+} test_state_nrf_recvfrom_dgram;
+
+static ssize_t nrf_recvfrom_dgram_stub(int zsock_socket, void *buffer, size_t length,
+				       int flags, struct nrf_sockaddr *address,
+				       nrf_socklen_t *address_len,
+				       int cmock_num_calls)
+{
+	uint8_t *data = buffer;
+	size_t received = MIN(length, test_state_nrf_recvfrom_dgram.dgram_len);
+
+	test_state_nrf_recvfrom_dgram.length = length;
+
+	for (size_t i = 0; i < received; i++) {
+		data[i] = i + 1;
+	}
+
+	return received;
+}
+
+void test_nrf9x_socket_offload_recvmsg_dgram_success(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = AF_INET;
+	int type = SOCK_DGRAM;
+	int proto = IPPROTO_UDP;
+	struct msghdr msg = { 0 };
+	struct iovec chunks[2] = { 0 };
+	uint8_t chunk_1[4] = { 0 };
+	uint8_t chunk_2[4] = { 0 };
+	uint8_t expected_1[4] = { 1, 2, 3, 4 };
+	uint8_t expected_2[4] = { 5, 6, 0, 0 };
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_DGRAM, NRF_IPPROTO_UDP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	chunks[0].iov_base = chunk_1;
+	chunks[0].iov_len = sizeof(chunk_1);
+	chunks[1].iov_base = chunk_2;
+	chunks[1].iov_len = sizeof(chunk_2);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 2;
+
+	/* The datagram is received in a single call and distributed over the parts */
+	memset(&test_state_nrf_recvfrom_dgram, 0, sizeof(test_state_nrf_recvfrom_dgram));
+	test_state_nrf_recvfrom_dgram.dgram_len = 6;
+	__cmock_nrf_recvfrom_Stub(nrf_recvfrom_dgram_stub);
+
+	ret = zsock_recvmsg(fd, &msg, 0);
+
+	TEST_ASSERT_EQUAL(6, ret);
+	TEST_ASSERT_EQUAL(0, msg.msg_flags);
+	TEST_ASSERT_EQUAL_MEMORY(expected_1, chunk_1, sizeof(chunk_1));
+	TEST_ASSERT_EQUAL_MEMORY(expected_2, chunk_2, sizeof(chunk_2));
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+void test_nrf9x_socket_offload_recvmsg_dgram_trunc(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int family = AF_INET;
+	int type = SOCK_DGRAM;
+	int proto = IPPROTO_UDP;
+	struct msghdr msg = { 0 };
+	struct iovec chunks[2] = { 0 };
+	uint8_t chunk_1[4] = { 0 };
+	uint8_t chunk_2[4] = { 0 };
+	uint8_t expected_1[4] = { 1, 2, 3, 4 };
+	uint8_t expected_2[4] = { 5, 6, 7, 8 };
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_DGRAM, NRF_IPPROTO_UDP, nrf_fd);
+
+	fd = zsock_socket(family, type, proto);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	chunks[0].iov_base = chunk_1;
+	chunks[0].iov_len = sizeof(chunk_1);
+	chunks[1].iov_base = chunk_2;
+	chunks[1].iov_len = sizeof(chunk_2);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 2;
+
+	/* The datagram is larger than the message parts */
+	memset(&test_state_nrf_recvfrom_dgram, 0, sizeof(test_state_nrf_recvfrom_dgram));
+	test_state_nrf_recvfrom_dgram.dgram_len = 12;
+	__cmock_nrf_recvfrom_Stub(nrf_recvfrom_dgram_stub);
+
+	ret = zsock_recvmsg(fd, &msg, 0);
+
+	/* One more byte than the parts hold is requested, to detect the truncation */
+	TEST_ASSERT_EQUAL(sizeof(chunk_1) + sizeof(chunk_2) + 1,
+			  test_state_nrf_recvfrom_dgram.length);
+	TEST_ASSERT_EQUAL(sizeof(chunk_1) + sizeof(chunk_2), ret);
+	TEST_ASSERT_EQUAL(ZSOCK_MSG_TRUNC, msg.msg_flags);
+	TEST_ASSERT_EQUAL_MEMORY(expected_1, chunk_1, sizeof(chunk_1));
+	TEST_ASSERT_EQUAL_MEMORY(expected_2, chunk_2, sizeof(chunk_2));
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
 void test_nrf9x_socket_offload_fcntl_einval(void)
 {
 	int ret;
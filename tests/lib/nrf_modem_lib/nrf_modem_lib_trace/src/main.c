@@ -428,6 +428,21 @@ void test_nrf_modem_lib_trace_data_size(void)
 	TEST_ASSERT_EQUAL(1234, ret);
 }
 
+void test_nrf_modem_lib_trace_seek(void)
+{
+	int ret;
+
+	__cmock_trace_backend_seek_ExpectAndReturn(5678, 0);
+
+	ret = nrf_modem_lib_trace_seek(5678);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	__cmock_trace_backend_seek_ExpectAndReturn(5678, -EIO);
+
+	ret = nrf_modem_lib_trace_seek(5678);
+	TEST_ASSERT_EQUAL(-EIO, ret);
+}
+
 void test_nrf_modem_lib_trace_enotsup(void)
 {
 	int ret;
@@ -437,10 +452,12 @@ void test_nrf_modem_lib_trace_enotsup(void)
 	trace_backend_orig.read = trace_backend.read;
 	trace_backend_orig.data_size = trace_backend.data_size;
 	trace_backend_orig.clear = trace_backend.clear;
+	trace_backend_orig.seek = trace_backend.seek;
 
 	trace_backend.read = NULL;
 	trace_backend.data_size = NULL;
 	trace_backend.clear = NULL;
+	trace_backend.seek = NULL;
 
 	ret = nrf_modem_lib_trace_read(buf, 10);
 	TEST_ASSERT_EQUAL(-ENOTSUP, ret);
@@ -451,6 +468,9 @@ void test_nrf_modem_lib_trace_enotsup(void)
 	ret = nrf_modem_lib_trace_clear();
 	TEST_ASSERT_EQUAL(-ENOTSUP, ret);
 
+	ret = nrf_modem_lib_trace_seek(0);
+	TEST_ASSERT_EQUAL(-ENOTSUP, ret);
+
 	trace_backend = trace_backend_orig;
 }
 
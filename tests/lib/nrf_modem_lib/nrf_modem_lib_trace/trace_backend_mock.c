@@ -36,6 +36,11 @@ int trace_backend_clear(void)
 	return 0;
 }
 
+int trace_backend_seek(int64_t start_ms)
+{
+	return 0;
+}
+
 struct nrf_modem_lib_trace_backend trace_backend = {
 	.init = trace_backend_init,
 	.deinit = trace_backend_deinit,
@@ -43,4 +48,5 @@ struct nrf_modem_lib_trace_backend trace_backend = {
 	.data_size = trace_backend_data_size,
 	.read = trace_backend_read,
 	.clear = trace_backend_clear,
+	.seek = trace_backend_seek,
 };
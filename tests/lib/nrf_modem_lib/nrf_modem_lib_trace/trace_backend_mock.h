@@ -17,3 +17,5 @@ size_t trace_backend_data_size(void);
 int trace_backend_read(void *buf, size_t len);
 
 int trace_backend_clear(void);
+
+int trace_backend_seek(int64_t start_ms);
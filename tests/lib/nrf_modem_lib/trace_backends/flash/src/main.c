@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <unity.h>
+#include <zephyr/kernel.h>
+
+#include "trace_backend.h"
+
+extern struct nrf_modem_lib_trace_backend trace_backend;
+
+#define BUF_SIZE CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE
+#define PARTITION_SIZE CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_PARTITION_SIZE
+#define SECTOR_SIZE (PARTITION_SIZE / CONFIG_NRF_MODEM_LIB_TRACE_FLASH_SECTORS)
+
+/* Trace data is written in chunks that do not match the buffer size. */
+#define WRITE_WORDS 24
+/* Trace data is read in chunks that do not match the buffer or flash entry size. */
+#define READ_SIZE 100
+/* Time for the flash work queue to write out a full buffer. */
+#define FLUSH_WAIT_MS 10
+
+#define WORDS(bytes) ((bytes) / sizeof(uint32_t))
+
+/* Trace data is a sequence of consecutive 32-bit numbers, this is the next one to write. */
+static uint32_t next_word;
+static size_t processed;
+static uint8_t read_buf[PARTITION_SIZE + 2 * BUF_SIZE];
+
+static K_THREAD_STACK_DEFINE(writer_stack, 2048);
+static struct k_thread writer_thread;
+static volatile bool writer_done;
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+static int callback(size_t len)
+{
+	processed += len;
+
+	return 0;
+}
+
+static void trace_write_chunk(size_t words)
+{
+	uint32_t chunk[WRITE_WORDS];
+
+	for (size_t i = 0; i < words; i++) {
+		chunk[i] = next_word++;
+	}
+
+	TEST_ASSERT_EQUAL(words * sizeof(uint32_t),
+			  trace_backend.write(chunk, words * sizeof(uint32_t)));
+}
+
+static void trace_write(size_t words)
+{
+	while (words) {
+		size_t n = MIN(words, WRITE_WORDS);
+
+		trace_write_chunk(n);
+		words -= n;
+	}
+
+	/* Let the work queue write the full buffers to flash. */
+	k_sleep(K_MSEC(FLUSH_WAIT_MS));
+}
+
+/* Read all trace data into read_buf, starting at offset, and return the new length. */
+static size_t trace_read_all(size_t offset)
+{
+	int ret;
+
+	do {
+		ret = trace_backend.read(&read_buf[offset],
+					 MIN(READ_SIZE, sizeof(read_buf) - offset));
+		if (ret > 0) {
+			offset += ret;
+		}
+	} while (ret > 0);
+
+	TEST_ASSERT_EQUAL(-ENODATA, ret);
+	TEST_ASSERT_EQUAL(0, trace_backend.data_size());
+
+	return offset;
+}
+
+/* Check that the trace data read is consecutive and ends with the last word written.
+ * Returns the first word read.
+ */
+static uint32_t trace_check(size_t len)
+{
+	uint32_t first;
+	uint32_t word;
+
+	TEST_ASSERT_TRUE(len > 0);
+	TEST_ASSERT_EQUAL(0, len % sizeof(uint32_t));
+
+	memcpy(&first, read_buf, sizeof(first));
+	for (size_t i = 1; i < WORDS(len); i++) {
+		memcpy(&word, &read_buf[i * sizeof(word)], sizeof(word));
+		TEST_ASSERT_EQUAL_UINT32(first + i, word);
+	}
+
+	TEST_ASSERT_EQUAL_UINT32(next_word, first + WORDS(len));
+
+	return first;
+}
+
+void setUp(void)
+{
+	static bool initialized;
+
+	if (!initialized) {
+		TEST_ASSERT_EQUAL(0, trace_backend.init(callback));
+		initialized = true;
+	}
+
+	TEST_ASSERT_EQUAL(0, trace_backend.clear());
+	next_word = 0;
+	processed = 0;
+}
+
+void test_trace_backend_flash_empty(void)
+{
+	uint8_t buf[READ_SIZE];
+
+	TEST_ASSERT_EQUAL(0, trace_backend.data_size());
+	TEST_ASSERT_EQUAL(-ENODATA, trace_backend.read(buf, sizeof(buf)));
+}
+
+void test_trace_backend_flash_buffer_swap(void)
+{
+	/* Full buffers in flash, one waiting for flash and the active one half full. */
+	const size_t len = 3 * BUF_SIZE + BUF_SIZE / 2;
+
+	trace_write(WORDS(len));
+
+	TEST_ASSERT_EQUAL(len, processed);
+	TEST_ASSERT_EQUAL(len, trace_backend.data_size());
+
+	TEST_ASSERT_EQUAL(len, trace_read_all(0));
+	TEST_ASSERT_EQUAL_UINT32(0, trace_check(len));
+}
+
+void test_trace_backend_flash_read_active_buffer(void)
+{
+	size_t len;
+
+	/* Read a part of the active buffer, then fill it some more. */
+	trace_write(10);
+	TEST_ASSERT_EQUAL(8, trace_backend.read(read_buf, 8));
+	TEST_ASSERT_EQUAL(32, trace_backend.data_size());
+
+	trace_write(WORDS(BUF_SIZE));
+
+	len = trace_read_all(8);
+	TEST_ASSERT_EQUAL(40 + BUF_SIZE, len);
+	TEST_ASSERT_EQUAL_UINT32(0, trace_check(len));
+}
+
+static void writer_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (size_t i = 0; i < WORDS(4 * SECTOR_SIZE) / WRITE_WORDS; i++) {
+		trace_write_chunk(WRITE_WORDS);
+		k_yield();
+	}
+
+	writer_done = true;
+}
+
+void test_trace_backend_flash_read_while_writing(void)
+{
+	size_t len = 0;
+	int ret;
+
+	writer_done = false;
+	k_thread_create(&writer_thread, writer_stack, K_THREAD_STACK_SIZEOF(writer_stack),
+			writer_fn, NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	/* Read out the active buffer and flash while the writer appends to them. */
+	do {
+		ret = trace_backend.read(&read_buf[len], MIN(READ_SIZE, sizeof(read_buf) - len));
+		if (ret > 0) {
+			len += ret;
+		} else {
+			TEST_ASSERT_EQUAL(-ENODATA, ret);
+			k_yield();
+		}
+	} while (!writer_done || (ret > 0));
+
+	TEST_ASSERT_EQUAL(0, k_thread_join(&writer_thread, K_FOREVER));
+
+	len = trace_read_all(len);
+	TEST_ASSERT_EQUAL(processed, len);
+	TEST_ASSERT_EQUAL_UINT32(0, trace_check(len));
+}
+
+void test_trace_backend_flash_circular_wrap(void)
+{
+	size_t len;
+
+	/* Fill the flash three times over, the oldest data is replaced. */
+	trace_write(WORDS(3 * PARTITION_SIZE));
+	TEST_ASSERT_EQUAL(3 * PARTITION_SIZE, processed);
+
+	/* A sector is kept erased ahead of the one being written. */
+	TEST_ASSERT_TRUE(trace_backend.data_size() <= PARTITION_SIZE - SECTOR_SIZE + 2 * BUF_SIZE);
+	TEST_ASSERT_TRUE(trace_backend.data_size() > PARTITION_SIZE - 3 * SECTOR_SIZE);
+
+	len = trace_read_all(0);
+	TEST_ASSERT_TRUE(trace_check(len) > 0);
+}
+
+void test_trace_backend_flash_seek_oldest(void)
+{
+	size_t len;
+
+	trace_write(WORDS(2 * SECTOR_SIZE));
+
+	/* Everything was captured after boot, nothing is discarded. */
+	TEST_ASSERT_EQUAL(0, trace_backend.seek(0));
+
+	len = trace_read_all(0);
+	TEST_ASSERT_EQUAL(2 * SECTOR_SIZE, len);
+	TEST_ASSERT_EQUAL_UINT32(0, trace_check(len));
+}
+
+void test_trace_backend_flash_seek_newest(void)
+{
+	size_t len;
+
+	trace_write(WORDS(4 * SECTOR_SIZE));
+
+	/* Only the sector being written and the buffers are kept. */
+	TEST_ASSERT_EQUAL(0, trace_backend.seek(k_uptime_get()));
+	TEST_ASSERT_TRUE(trace_backend.data_size() <= SECTOR_SIZE + 2 * BUF_SIZE);
+
+	len = trace_read_all(0);
+	TEST_ASSERT_TRUE(trace_check(len) > 0);
+}
+
+void test_trace_backend_flash_seek_time(void)
+{
+	int64_t start_ms;
+	uint32_t start_word;
+	uint32_t first;
+	size_t len;
+
+	trace_write(WORDS(2 * SECTOR_SIZE));
+	k_sleep(K_MSEC(100));
+
+	start_ms = k_uptime_get();
+	start_word = next_word;
+
+	trace_write(WORDS(2 * SECTOR_SIZE));
+
+	TEST_ASSERT_EQUAL(0, trace_backend.seek(start_ms));
+
+	/* Data is discarded by sector, so only the sector where the data at the start time
+	 * was written holds older data.
+	 */
+	len = trace_read_all(0);
+	first = trace_check(len);
+	TEST_ASSERT_TRUE(first > 0);
+	TEST_ASSERT_TRUE(first <= start_word);
+	TEST_ASSERT_TRUE(start_word - first <= WORDS(SECTOR_SIZE + BUF_SIZE));
+}
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
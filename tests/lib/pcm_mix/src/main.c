@@ -127,4 +127,176 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+ZTEST(suite_pcm_mix, test_mono_into_stereo_l_too_small)
+{
+	int ret;
+	int16_t sample_a[] = { 10, 10, 10, 10, 10 };
+	int16_t sample_b[] = { -5, 5, 5 };
+	int16_t sample_r[] = { 10, 10, 10, 10, 10 };
+
+	/* Buffer A must not be modified if it cannot hold the result */
+	ret = pcm_mix(sample_a, sizeof(sample_a) - sizeof(int16_t), sample_b, sizeof(sample_b),
+		      B_MONO_INTO_A_STEREO_L);
+	ZEQ(ret, -EPERM);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_odd_length_saturation)
+{
+	int ret;
+	int16_t sample_a[] = { INT16_MAX, INT16_MIN, 100, -100, 30000 };
+	int16_t sample_b[] = { INT16_MAX, INT16_MIN, -200, 200, 30000 };
+	int16_t sample_r[] = { INT16_MAX, INT16_MIN, -100, 100, INT16_MAX };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b), B_MONO_INTO_A_MONO);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mono_into_stereo_lr_saturation)
+{
+	int ret;
+	int16_t sample_a[] = { INT16_MAX, 0, INT16_MIN, -1 };
+	int16_t sample_b[] = { 1, INT16_MIN };
+	int16_t sample_r[] = { INT16_MAX, 1, INT16_MIN, INT16_MIN };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_MONO_INTO_A_STEREO_LR);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_ext_gain_16)
+{
+	int ret;
+	int16_t sample_a[] = { 10, 10, 10, 10 };
+	int16_t sample_b[] = { -100, 100 };
+	int16_t sample_r[] = { -40, 10, 60, 10 };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_STEREO_L, 16, PCM_MIX_GAIN_UNITY / 2);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+/* 24-bit samples are packed in three little-endian bytes */
+#define PCM_24(x) (uint8_t)(x), (uint8_t)((x) >> 8), (uint8_t)((x) >> 16)
+
+ZTEST(suite_pcm_mix, test_ext_24_bit)
+{
+	int ret;
+	uint8_t sample_a[] = { PCM_24(10), PCM_24(8388600), PCM_24(-8388600), PCM_24(0),
+			       PCM_24(-10) };
+	uint8_t sample_b[] = { PCM_24(20), PCM_24(100), PCM_24(-100), PCM_24(-8388608),
+			       PCM_24(-20) };
+	uint8_t sample_r[] = { PCM_24(30), PCM_24(8388607), PCM_24(-8388608), PCM_24(-8388608),
+			       PCM_24(-30) };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_MONO, 24, PCM_MIX_GAIN_UNITY);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r), "fail");
+}
+
+ZTEST(suite_pcm_mix, test_ext_24_bit_mono_into_stereo_lr)
+{
+	int ret;
+	uint8_t sample_a[] = { PCM_24(1), PCM_24(-1), PCM_24(8388607), PCM_24(0) };
+	uint8_t sample_b[] = { PCM_24(-4), PCM_24(10) };
+	uint8_t sample_r[] = { PCM_24(-3), PCM_24(-5), PCM_24(8388607), PCM_24(10) };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_STEREO_LR, 24, PCM_MIX_GAIN_UNITY);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r), "fail");
+
+	/* Buffers must hold whole 24-bit samples */
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b) - 1,
+			  B_MONO_INTO_A_STEREO_LR, 24, PCM_MIX_GAIN_UNITY);
+	ZEQ(ret, -EINVAL);
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r), "fail");
+}
+
+ZTEST(suite_pcm_mix, test_ext_32_bit_stereo_r)
+{
+	int ret;
+	int32_t sample_a[] = { 1, INT32_MAX, 1, INT32_MIN };
+	int32_t sample_b[] = { 10, -10 };
+	int32_t sample_r[] = { 1, INT32_MAX, 1, INT32_MIN };
+	int32_t sample_b_big[] = { INT32_MAX, INT32_MIN };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_STEREO_R, 32, PCM_MIX_GAIN_UNITY);
+	ZEQ(ret, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_r); i++) {
+		ZEQ(sample_a[i], sample_r[i]);
+	}
+
+	/* Half gain */
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b_big, sizeof(sample_b_big),
+			  B_MONO_INTO_A_STEREO_L, 32, PCM_MIX_GAIN_UNITY / 2);
+	ZEQ(ret, 0);
+	ZEQ(sample_a[0], 1 + (INT32_MAX >> 1));
+	ZEQ(sample_a[2], 1 + (INT32_MIN >> 1));
+}
+
+ZTEST(suite_pcm_mix, test_ext_illegal_bit_depth)
+{
+	int ret;
+	int16_t sample_a[] = { 0, 1, 2 };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_a, sizeof(sample_a),
+			  B_MONO_INTO_A_MONO, 8, PCM_MIX_GAIN_UNITY);
+	ZEQ(ret, -EINVAL);
+}
+
+/* 10 ms of 48 kHz stereo audio */
+#define PERF_STEREO_SAMPLES 960
+#define PERF_ITERATIONS	    100
+
+ZTEST(suite_pcm_mix, test_mix_throughput)
+{
+	static int16_t pcm_a[PERF_STEREO_SAMPLES];
+	static int16_t pcm_b[PERF_STEREO_SAMPLES];
+	static const struct {
+		const char *name;
+		enum pcm_mix_mode mode;
+		size_t size_b;
+		uint16_t gain;
+	} cases[] = {
+		{ "stereo", B_STEREO_INTO_A_STEREO, sizeof(pcm_b), PCM_MIX_GAIN_UNITY },
+		{ "mono LR", B_MONO_INTO_A_STEREO_LR, sizeof(pcm_b) / 2, PCM_MIX_GAIN_UNITY },
+		{ "mono L", B_MONO_INTO_A_STEREO_L, sizeof(pcm_b) / 2, PCM_MIX_GAIN_UNITY },
+		{ "stereo gain", B_STEREO_INTO_A_STEREO, sizeof(pcm_b), PCM_MIX_GAIN_UNITY / 2 },
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(pcm_b); i++) {
+		pcm_a[i] = (int16_t)(i * 67);
+		pcm_b[i] = (int16_t)(i * 131);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+		uint32_t start = k_cycle_get_32();
+
+		for (size_t j = 0; j < PERF_ITERATIONS; j++) {
+			int ret = pcm_mix_ext(pcm_a, sizeof(pcm_a), pcm_b, cases[i].size_b,
+					      cases[i].mode, 16, cases[i].gain);
+
+			ZEQ(ret, 0);
+		}
+
+		uint32_t cycles = k_cycle_get_32() - start;
+
+		printk("pcm_mix %s: %u cycles per %d sample block\n", cases[i].name,
+		       cycles / PERF_ITERATIONS, PERF_STEREO_SAMPLES);
+	}
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
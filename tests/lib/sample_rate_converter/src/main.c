@@ -1152,4 +1152,258 @@ ZTEST(suite_sample_rate_converter, test_invalid_process_output_buf_too_small)
 		      "Sample rate conversion process did not fail when output buffer is to small");
 }
 
+#if CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE && CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+#define RAMP_LENGTH 4800
+#define RAMP_START  -16000
+#define RAMP_END    16000
+
+static struct sample_rate_converter_poly_ctx poly_ctx;
+
+/* Linear ramp evaluated at num / den frames. A linear phase low-pass filter passes the ramp
+ * unchanged apart from the delay, which makes the ideal output easy to calculate.
+ */
+static int16_t ramp_get(int64_t num, int64_t den)
+{
+	return RAMP_START + ((num * (RAMP_END - RAMP_START)) / (den * RAMP_LENGTH));
+}
+
+/* Converts a ramp in blocks and compares it to the ideal output, delayed by half the filter
+ * length.
+ */
+static void poly_ramp_verify(uint32_t input_sample_rate, uint32_t output_sample_rate,
+				 size_t frames_per_block, size_t num_blocks)
+{
+	int ret;
+	int16_t input[frames_per_block];
+	int16_t output[DIV_ROUND_UP(frames_per_block * output_sample_rate, input_sample_rate)];
+	size_t output_written;
+	size_t frames_in = 0;
+	size_t frames_out = 0;
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, input_sample_rate, output_sample_rate, 1);
+	zassert_equal(ret, 0, "Failed to open polyphase converter");
+
+	int64_t delay = (poly_ctx.taps / 2) * poly_ctx.interpolation;
+
+	for (size_t block = 0; block < num_blocks; block++) {
+		for (size_t i = 0; i < frames_per_block; i++) {
+			input[i] = ramp_get(frames_in + i, 1);
+		}
+
+		ret = sample_rate_converter_poly_process(&poly_ctx, input, sizeof(input), output,
+							 sizeof(output), &output_written);
+		zassert_equal(ret, 0, "Polyphase conversion failed");
+
+		for (size_t i = 0; i < output_written / sizeof(int16_t); i++) {
+			int64_t pos = (int64_t)(frames_out + i) * poly_ctx.decimation - delay;
+
+			/* Skip the output frames that depend on the silence before the input */
+			if (pos >= delay) {
+				zassert_within(output[i], ramp_get(pos, poly_ctx.interpolation), 2,
+					       "Output frame %d not as expected", frames_out + i);
+			}
+		}
+
+		frames_in += frames_per_block;
+		frames_out += output_written / sizeof(int16_t);
+	}
+
+	zassert_equal(frames_out,
+		      DIV_ROUND_UP(frames_in * poly_ctx.interpolation, poly_ctx.decimation),
+		      "Number of output frames not as expected");
+}
+
+ZTEST(suite_sample_rate_converter, test_poly_interpolate_44_1khz_to_48khz)
+{
+	poly_ramp_verify(44100, 48000, 441, 10);
+}
+
+ZTEST(suite_sample_rate_converter, test_poly_decimate_48khz_to_44_1khz)
+{
+	poly_ramp_verify(48000, 44100, 480, 10);
+}
+
+ZTEST(suite_sample_rate_converter, test_poly_interpolate_integer_ratio)
+{
+	poly_ramp_verify(16000, 48000, 160, 10);
+}
+
+ZTEST(suite_sample_rate_converter, test_poly_decimate_integer_ratio)
+{
+	poly_ramp_verify(48000, 16000, 480, 10);
+}
+
+ZTEST(suite_sample_rate_converter, test_poly_stereo_dc)
+{
+	int ret;
+	int16_t input[441 * 2];
+	int16_t output[480 * 2];
+	size_t output_written;
+
+	for (size_t i = 0; i < ARRAY_SIZE(input); i += 2) {
+		input[i] = 8000;
+		input[i + 1] = -8000;
+	}
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 44100, 48000, 2);
+	zassert_equal(ret, 0, "Failed to open polyphase converter");
+
+	for (int block = 0; block < 4; block++) {
+		ret = sample_rate_converter_poly_process(&poly_ctx, input, sizeof(input), output,
+							 sizeof(output), &output_written);
+		zassert_equal(ret, 0, "Polyphase conversion failed");
+		zassert_equal(output_written, sizeof(output), "Output size was not as expected (%d)",
+			      output_written);
+
+		/* Skip the frames that depend on the silence before the input */
+		size_t first_frame = (block == 0) ? (2 * poly_ctx.taps) : 0;
+
+		for (size_t i = first_frame * 2; i < ARRAY_SIZE(output); i += 2) {
+			zassert_within(output[i], 8000, 1, "Left channel not as expected");
+			zassert_within(output[i + 1], -8000, 1, "Right channel not as expected");
+		}
+	}
+}
+
+ZTEST(suite_sample_rate_converter, test_poly_block_size_independent)
+{
+	int ret;
+	int16_t input[600];
+	int16_t output_single[700];
+	int16_t output_split[700];
+	size_t output_single_size;
+	size_t output_split_size = 0;
+	size_t offset = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(input); i++) {
+		input[i] = (int16_t)((i * 2654435761UL) >> 16);
+	}
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 48000, 44100, 1);
+	zassert_equal(ret, 0, "Failed to open polyphase converter");
+
+	ret = sample_rate_converter_poly_process(&poly_ctx, input, sizeof(input), output_single,
+						 sizeof(output_single), &output_single_size);
+	zassert_equal(ret, 0, "Polyphase conversion failed");
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 48000, 44100, 1);
+	zassert_equal(ret, 0, "Failed to open polyphase converter");
+
+	/* Block sizes both smaller and larger than the filter history */
+	for (size_t frames = 0; offset < ARRAY_SIZE(input); frames = (frames + 7) % 53) {
+		size_t output_written;
+
+		frames = MIN(frames, ARRAY_SIZE(input) - offset);
+
+		ret = sample_rate_converter_poly_process(
+			&poly_ctx, &input[offset], frames * sizeof(int16_t),
+			(uint8_t *)output_split + output_split_size,
+			sizeof(output_split) - output_split_size, &output_written);
+		zassert_equal(ret, 0, "Polyphase conversion failed");
+
+		offset += frames;
+		output_split_size += output_written;
+	}
+
+	zassert_equal(output_split_size, output_single_size, "Output size was not as expected");
+	zassert_mem_equal(output_split, output_single, output_single_size,
+			  "Output depends on the input block size");
+}
+
+ZTEST(suite_sample_rate_converter, test_poly_invalid_params)
+{
+	int ret;
+	int16_t input[12] = {0};
+	int16_t output[12];
+	size_t output_written;
+
+	ret = sample_rate_converter_poly_open(NULL, 44100, 48000, 1);
+	zassert_equal(ret, -EINVAL, "Open did not fail with NULL context");
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 44100, 48000, 0);
+	zassert_equal(ret, -EINVAL, "Open did not fail with zero channels");
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 44100, 48000,
+					      CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_CHANNELS_MAX +
+						      1);
+	zassert_equal(ret, -EINVAL, "Open did not fail with too many channels");
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 48000, 48000, 1);
+	zassert_equal(ret, -EINVAL, "Open did not fail with equal sample rates");
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 48000, 8000, 1);
+	zassert_equal(ret, -EINVAL, "Open did not fail with too large decimation");
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 8000, 44100, 1);
+	zassert_equal(ret, -EINVAL, "Open did not fail with too many filter coefficients");
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 16000, 48000, 2);
+	zassert_equal(ret, 0, "Failed to open polyphase converter");
+
+	ret = sample_rate_converter_poly_process(&poly_ctx, input, sizeof(int16_t), output,
+						 sizeof(output), &output_written);
+	zassert_equal(ret, -EINVAL, "Process did not fail when input is not whole frames");
+
+	ret = sample_rate_converter_poly_process(&poly_ctx, input, sizeof(input), output,
+						 sizeof(output), &output_written);
+	zassert_equal(ret, -EINVAL, "Process did not fail when output buffer is too small");
+
+	ret = sample_rate_converter_poly_process(&poly_ctx, input, sizeof(input), output,
+						 sizeof(output), NULL);
+	zassert_equal(ret, -EINVAL, "Process did not fail when output size pointer is NULL");
+}
+
+#define PERF_ITERATIONS 20
+
+ZTEST(suite_sample_rate_converter, test_poly_benchmark)
+{
+	int ret;
+	static int16_t input[441 * 2];
+	static int16_t output[480 * 2];
+	size_t output_written;
+	uint32_t start;
+	uint32_t cycles;
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 44100, 48000, 2);
+	zassert_equal(ret, 0, "Failed to open polyphase converter");
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < PERF_ITERATIONS; i++) {
+		ret = sample_rate_converter_poly_process(&poly_ctx, input, sizeof(input), output,
+							 sizeof(output), &output_written);
+		zassert_equal(ret, 0, "Polyphase conversion failed");
+	}
+	cycles = k_cycle_get_32() - start;
+
+	printk("sample_rate_converter polyphase 44.1 kHz to 48 kHz stereo: %u cycles per 10 ms\n",
+	       cycles / PERF_ITERATIONS);
+
+	ret = sample_rate_converter_poly_open(&poly_ctx, 16000, 48000, 1);
+	zassert_equal(ret, 0, "Failed to open polyphase converter");
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < PERF_ITERATIONS; i++) {
+		ret = sample_rate_converter_poly_process(&poly_ctx, input, 160 * sizeof(int16_t),
+							 output, sizeof(output), &output_written);
+		zassert_equal(ret, 0, "Polyphase conversion failed");
+	}
+	cycles = k_cycle_get_32() - start;
+
+	printk("sample_rate_converter polyphase 16 kHz to 48 kHz mono: %u cycles per 10 ms\n",
+	       cycles / PERF_ITERATIONS);
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < PERF_ITERATIONS; i++) {
+		ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_SIMPLE, input,
+						    160 * sizeof(int16_t), 16000, output,
+						    sizeof(output), &output_written, 48000);
+		zassert_equal(ret, 0, "Sample rate conversion process failed");
+	}
+	cycles = k_cycle_get_32() - start;
+
+	printk("sample_rate_converter 16 kHz to 48 kHz mono: %u cycles per 10 ms\n",
+	       cycles / PERF_ITERATIONS);
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE && CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
+
 ZTEST_SUITE(suite_sample_rate_converter, NULL, NULL, test_setup, NULL, NULL);
@@ -12,6 +12,7 @@
 #include <zephyr/types.h>
 
 DEFINE_FAKE_VALUE_FUNC(int, lc3_file_frame_get, struct lc3_file_ctx *, uint8_t *, size_t);
+DEFINE_FAKE_VALUE_FUNC(int, lc3_file_rewind, struct lc3_file_ctx *);
 DEFINE_FAKE_VALUE_FUNC(int, lc3_file_open, struct lc3_file_ctx *, const char *);
 DEFINE_FAKE_VALUE_FUNC(int, lc3_file_close, struct lc3_file_ctx *);
 DEFINE_FAKE_VALUE_FUNC(int, lc3_file_init);
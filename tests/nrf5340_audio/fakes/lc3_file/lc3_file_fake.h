@@ -11,6 +11,7 @@
 #include <zephyr/types.h>
 
 DECLARE_FAKE_VALUE_FUNC(int, lc3_file_frame_get, struct lc3_file_ctx *, uint8_t *, size_t);
+DECLARE_FAKE_VALUE_FUNC(int, lc3_file_rewind, struct lc3_file_ctx *);
 DECLARE_FAKE_VALUE_FUNC(int, lc3_file_open, struct lc3_file_ctx *, const char *);
 DECLARE_FAKE_VALUE_FUNC(int, lc3_file_close, struct lc3_file_ctx *);
 DECLARE_FAKE_VALUE_FUNC(int, lc3_file_init);
@@ -19,6 +20,7 @@ DECLARE_FAKE_VALUE_FUNC(int, lc3_file_init);
 #define DO_FOREACH_LC3_FILE_FAKE(FUNC)                                                             \
 	do {                                                                                       \
 		FUNC(lc3_file_frame_get)                                                           \
+		FUNC(lc3_file_rewind)                                                              \
 		FUNC(lc3_file_open)                                                                \
 		FUNC(lc3_file_close)                                                               \
 		FUNC(lc3_file_init)                                                                \
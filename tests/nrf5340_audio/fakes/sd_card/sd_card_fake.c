@@ -21,6 +21,7 @@ DEFINE_FAKE_VALUE_FUNC(int, sd_card_init);
 DEFINE_FAKE_VALUE_FUNC(int, sd_card_open, const char *, struct fs_file_t *);
 DEFINE_FAKE_VALUE_FUNC(int, sd_card_close, struct fs_file_t *);
 DEFINE_FAKE_VALUE_FUNC(int, sd_card_read, char *, size_t *, struct fs_file_t *);
+DEFINE_FAKE_VALUE_FUNC(int, sd_card_seek, off_t, struct fs_file_t *);
 
 void sd_card_fake_reset_counter(void)
 {
@@ -52,6 +53,15 @@ int sd_card_read_lc3_file_fake_valid(char *buf, size_t *size, struct fs_file_t *
 	return 0;
 }
 
+int sd_card_seek_fake_valid(off_t offset, struct fs_file_t *f_seg_read_entry)
+{
+	ARG_UNUSED(f_seg_read_entry);
+
+	read_lc3_fake_bytes_read = offset;
+
+	return 0;
+}
+
 int sd_card_read_fake_invalid_header(char *buf, size_t *size, struct fs_file_t *f_seg_read_entry)
 {
 	ARG_UNUSED(f_seg_read_entry);
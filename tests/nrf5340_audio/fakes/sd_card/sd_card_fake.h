@@ -15,6 +15,7 @@ DECLARE_FAKE_VALUE_FUNC(int, sd_card_init);
 DECLARE_FAKE_VALUE_FUNC(int, sd_card_open, const char *, struct fs_file_t *);
 DECLARE_FAKE_VALUE_FUNC(int, sd_card_close, struct fs_file_t *);
 DECLARE_FAKE_VALUE_FUNC(int, sd_card_read, char *, size_t *, struct fs_file_t *);
+DECLARE_FAKE_VALUE_FUNC(int, sd_card_seek, off_t, struct fs_file_t *);
 
 /* List of fakes used by this unit tester */
 #define DO_FOREACH_FAKE(FUNC)		\
@@ -23,6 +24,7 @@ DECLARE_FAKE_VALUE_FUNC(int, sd_card_read, char *, size_t *, struct fs_file_t *)
 		FUNC(sd_card_open)			\
 		FUNC(sd_card_close)			\
 		FUNC(sd_card_read)			\
+		FUNC(sd_card_seek)			\
 	} while (0)
 
 /**
@@ -35,6 +37,11 @@ void sd_card_fake_reset_counter(void);
  */
 int sd_card_read_lc3_file_fake_valid(char *buf, size_t *size, struct fs_file_t *f_seg_read_entry);
 
+/**
+ * @brief Fake function for seeking in the LC3 file data.
+ */
+int sd_card_seek_fake_valid(off_t offset, struct fs_file_t *f_seg_read_entry);
+
 /**
  * @brief Fake function for reading invalid header data.
  */
@@ -15,6 +15,16 @@
 
 #define FRAME_BUFFER_SIZE 40
 
+/* Smallest read-ahead buffer that holds a chunk in addition to a frame */
+#define READ_AHEAD_RING_SIZE (4 * CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE)
+/* Read-ahead buffer that holds about half of the test file */
+#define READ_AHEAD_HALF_FILE_SIZE (8 * CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE)
+/* Read-ahead buffer that holds the whole test file */
+#define READ_AHEAD_FILE_SIZE (16 * CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE)
+
+static size_t file_pos;
+static size_t read_size_max;
+
 static void test_setup(void *f)
 {
 	ARG_UNUSED(f);
@@ -24,12 +34,62 @@ static void test_setup(void *f)
 	FFF_RESET_HISTORY();
 
 	sd_card_fake_reset_counter();
+
+	file_pos = 0;
+	read_size_max = 0;
+}
+
+static int sd_card_read_chunk_check(char *buf, size_t *size, struct fs_file_t *f_seg_read_entry)
+{
+	int ret;
+	size_t size_requested = *size;
+
+	read_size_max = MAX(read_size_max, size_requested);
+
+	ret = sd_card_read_lc3_file_fake_valid(buf, size, f_seg_read_entry);
+
+	file_pos += *size;
+
+	/* Apart from the header and the end of the file, reads must end on a chunk boundary */
+	if ((file_pos > sizeof(struct lc3_file_header)) && (*size == size_requested)) {
+		zassert_equal(0, file_pos % CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE,
+			      "Read ended at %d, not on a chunk boundary", file_pos);
+	}
+
+	return ret;
+}
+
+static int sd_card_seek_chunk_check(off_t offset, struct fs_file_t *f_seg_read_entry)
+{
+	file_pos = offset;
+
+	return sd_card_seek_fake_valid(offset, f_seg_read_entry);
+}
+
+static void lc3_file_frames_check(struct lc3_file_ctx *file)
+{
+	int ret;
+	int8_t frame_buffer[FRAME_BUFFER_SIZE];
+	const uint8_t *const frames[] = {
+		lc3_file_dataset1_valid_frame1, lc3_file_dataset1_valid_frame2,
+		lc3_file_dataset1_valid_frame3, lc3_file_dataset1_valid_frame4,
+		lc3_file_dataset1_valid_frame5};
+
+	for (int i = 0; i < ARRAY_SIZE(frames); i++) {
+		ret = lc3_file_frame_get(file, frame_buffer, sizeof(frame_buffer));
+		zassert_equal(0, ret, "lc3_file_frame_get() should return 0");
+		zassert_mem_equal(frames[i], frame_buffer, lc3_file_dataset1_valid_frame1_size,
+				  "Frame %d data should match", i + 1);
+	}
+
+	ret = lc3_file_frame_get(file, frame_buffer, sizeof(frame_buffer));
+	zassert_equal(-ENODATA, ret, "lc3_file_frame_get() should return -ENODATA");
 }
 
 ZTEST(lc3_file, test_lc3_file_frame_get_valid)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 	int8_t frame_buffer[FRAME_BUFFER_SIZE];
 
 	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_valid;
@@ -69,7 +129,7 @@ ZTEST(lc3_file, test_lc3_file_frame_get_valid)
 ZTEST(lc3_file, test_lc3_file_frame_get_invalid_sd_card_read_header_failure)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 	int8_t frame_buffer[FRAME_BUFFER_SIZE];
 
 	sd_card_read_fake.return_val = -EINVAL;
@@ -81,7 +141,7 @@ ZTEST(lc3_file, test_lc3_file_frame_get_invalid_sd_card_read_header_failure)
 ZTEST(lc3_file, test_lc3_file_frame_get_invalid_sd_card_read_frame_failure)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 	int sd_card_read_return_values[] = {0, -EINVAL};
 
 	SET_RETURN_SEQ(sd_card_read, sd_card_read_return_values, 2);
@@ -93,7 +153,7 @@ ZTEST(lc3_file, test_lc3_file_frame_get_invalid_sd_card_read_frame_failure)
 ZTEST(lc3_file, test_lc3_file_frame_get_invalid_frame_size_mismatch)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 	int8_t frame_buffer[FRAME_BUFFER_SIZE];
 
 	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_invalid_frame;
@@ -108,7 +168,7 @@ ZTEST(lc3_file, test_lc3_file_frame_get_invalid_frame_size_mismatch)
 ZTEST(lc3_file, test_lc3_file_frame_get_invalid_buf_size_too_small)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 	int8_t frame_buffer[FRAME_BUFFER_SIZE];
 
 	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_valid;
@@ -120,10 +180,182 @@ ZTEST(lc3_file, test_lc3_file_frame_get_invalid_buf_size_too_small)
 	zassert_equal(-ENOMEM, ret, "lc3_file_frame_get() should return -ENOMEM");
 }
 
+ZTEST(lc3_file, test_lc3_file_read_ahead_frame_get_valid)
+{
+	int ret;
+	uint8_t read_ahead_buf[READ_AHEAD_RING_SIZE];
+	struct lc3_file_ctx file = {.read_ahead_buf = read_ahead_buf,
+				    .read_ahead_size = sizeof(read_ahead_buf)};
+
+	sd_card_read_fake.custom_fake = sd_card_read_chunk_check;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	/* The file is larger than the buffer, so frames wrap around the end of it */
+	lc3_file_frames_check(&file);
+}
+
+ZTEST(lc3_file, test_lc3_file_read_ahead_frame_get_batched)
+{
+	int ret;
+	uint8_t read_ahead_buf[READ_AHEAD_FILE_SIZE];
+	struct lc3_file_ctx file = {.read_ahead_buf = read_ahead_buf,
+				    .read_ahead_size = sizeof(read_ahead_buf)};
+
+	sd_card_read_fake.custom_fake = sd_card_read_chunk_check;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	lc3_file_frames_check(&file);
+
+	/* One read for the header, one for all the frames */
+	zassert_equal(2, sd_card_read_fake.call_count, "sd_card_read() should be called twice");
+}
+
+ZTEST(lc3_file, test_lc3_file_read_ahead_top_up)
+{
+	int ret;
+	int8_t frame_buffer[FRAME_BUFFER_SIZE];
+	uint8_t read_ahead_buf[READ_AHEAD_HALF_FILE_SIZE];
+	struct lc3_file_ctx file = {.read_ahead_buf = read_ahead_buf,
+				    .read_ahead_size = sizeof(read_ahead_buf)};
+	/* Frame header and frame data */
+	size_t frame_size = sizeof(uint16_t) + lc3_file_dataset1_valid_frame1_size;
+
+	sd_card_read_fake.custom_fake = sd_card_read_chunk_check;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	/* The first frame fills the buffer */
+	ret = lc3_file_frame_get(&file, frame_buffer, sizeof(frame_buffer));
+	zassert_equal(0, ret, "lc3_file_frame_get() should return 0");
+
+	read_size_max = 0;
+
+	for (int i = 1; i < 5; i++) {
+		ret = lc3_file_frame_get(&file, frame_buffer, sizeof(frame_buffer));
+		zassert_equal(0, ret, "lc3_file_frame_get() should return 0");
+
+		/* The buffer is topped up as soon as a chunk is free */
+		zassert_true(file.read_ahead_eof ||
+				     ((file.read_ahead_size - (file.read_ahead_wr -
+							       file.read_ahead_rd)) <
+				      CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE),
+			     "Read-ahead buffer not topped up after frame %d", i + 1);
+	}
+
+	/* Later reads replace the frames consumed, not the whole buffer */
+	zassert_true(read_size_max <= ROUND_UP(frame_size, CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE),
+		     "Read of %d bytes after the buffer was filled", read_size_max);
+}
+
+ZTEST(lc3_file, test_lc3_file_read_ahead_rewind_in_buffer)
+{
+	int ret;
+	uint8_t read_ahead_buf[READ_AHEAD_FILE_SIZE];
+	struct lc3_file_ctx file = {.read_ahead_buf = read_ahead_buf,
+				    .read_ahead_size = sizeof(read_ahead_buf)};
+
+	sd_card_read_fake.custom_fake = sd_card_read_chunk_check;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	lc3_file_frames_check(&file);
+
+	ret = lc3_file_rewind(&file);
+	zassert_equal(0, ret, "lc3_file_rewind() should return 0");
+
+	lc3_file_frames_check(&file);
+
+	zassert_equal(0, sd_card_seek_fake.call_count, "sd_card_seek() should not be called");
+	zassert_equal(2, sd_card_read_fake.call_count, "sd_card_read() should be called twice");
+	zassert_equal(1, sd_card_open_fake.call_count, "sd_card_open() should be called once");
+}
+
+ZTEST(lc3_file, test_lc3_file_read_ahead_rewind_seek)
+{
+	int ret;
+	uint8_t read_ahead_buf[READ_AHEAD_RING_SIZE];
+	struct lc3_file_ctx file = {.read_ahead_buf = read_ahead_buf,
+				    .read_ahead_size = sizeof(read_ahead_buf)};
+
+	sd_card_read_fake.custom_fake = sd_card_read_chunk_check;
+	sd_card_seek_fake.custom_fake = sd_card_seek_chunk_check;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	lc3_file_frames_check(&file);
+
+	ret = lc3_file_rewind(&file);
+	zassert_equal(0, ret, "lc3_file_rewind() should return 0");
+	zassert_equal(1, sd_card_seek_fake.call_count, "sd_card_seek() should be called once");
+	zassert_equal(sizeof(struct lc3_file_header), sd_card_seek_fake.arg0_val,
+		      "sd_card_seek() should seek to the first frame");
+
+	lc3_file_frames_check(&file);
+
+	zassert_equal(1, sd_card_open_fake.call_count, "sd_card_open() should be called once");
+	zassert_equal(0, sd_card_close_fake.call_count, "sd_card_close() should not be called");
+}
+
+ZTEST(lc3_file, test_lc3_file_read_ahead_invalid_buf_size_too_small)
+{
+	int ret;
+	int8_t frame_buffer[FRAME_BUFFER_SIZE];
+	uint8_t read_ahead_buf[2 * CONFIG_SD_CARD_LC3_FILE_READ_CHUNK_SIZE];
+	struct lc3_file_ctx file = {.read_ahead_buf = read_ahead_buf,
+				    .read_ahead_size = sizeof(read_ahead_buf)};
+
+	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_valid;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	ret = lc3_file_frame_get(&file, frame_buffer, sizeof(frame_buffer));
+	zassert_equal(-ENOMEM, ret, "lc3_file_frame_get() should return -ENOMEM");
+}
+
+ZTEST(lc3_file, test_lc3_file_read_ahead_invalid_size)
+{
+	int ret;
+	uint8_t read_ahead_buf[READ_AHEAD_RING_SIZE + 1];
+	struct lc3_file_ctx file = {.read_ahead_buf = read_ahead_buf,
+				    .read_ahead_size = sizeof(read_ahead_buf)};
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(-EINVAL, ret, "lc3_file_open() should return -EINVAL");
+	zassert_equal(0, sd_card_open_fake.call_count, "sd_card_open() should not be called");
+}
+
+ZTEST(lc3_file, test_lc3_file_rewind)
+{
+	int ret;
+	struct lc3_file_ctx file = {0};
+
+	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_valid;
+	sd_card_seek_fake.custom_fake = sd_card_seek_fake_valid;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	ret = lc3_file_rewind(&file);
+	zassert_equal(0, ret, "lc3_file_rewind() should return 0");
+	zassert_equal(sizeof(struct lc3_file_header), sd_card_seek_fake.arg0_val,
+		      "sd_card_seek() should seek to the first frame");
+
+	ret = lc3_file_rewind(NULL);
+	zassert_equal(-EINVAL, ret, "lc3_file_rewind() should return -EINVAL");
+}
+
 ZTEST(lc3_file, test_lc3_file_open)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 
 	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_valid;
 
@@ -154,7 +386,7 @@ ZTEST(lc3_file, test_lc3_file_open)
 ZTEST(lc3_file, test_lc3_file_open_invalid_nullptr)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 
 	ret = lc3_file_open(NULL, "test.lc3");
 
@@ -170,7 +402,7 @@ ZTEST(lc3_file, test_lc3_file_open_invalid_nullptr)
 ZTEST(lc3_file, test_lc3_file_open_invalid_header)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 
 	sd_card_read_fake.custom_fake = sd_card_read_fake_invalid_header;
 
@@ -183,7 +415,7 @@ ZTEST(lc3_file, test_lc3_file_open_invalid_header)
 ZTEST(lc3_file, test_lc3_file_open_invalid_sd_card_open_failure)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 
 	sd_card_open_fake.return_val = -EINVAL;
 
@@ -196,7 +428,7 @@ ZTEST(lc3_file, test_lc3_file_open_invalid_sd_card_open_failure)
 ZTEST(lc3_file, test_lc3_file_open_invalid_sd_card_read_failure)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 
 	sd_card_read_fake.return_val = -EINVAL;
 
@@ -209,7 +441,7 @@ ZTEST(lc3_file, test_lc3_file_open_invalid_sd_card_read_failure)
 ZTEST(lc3_file, test_lc3_file_close)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 
 	ret = lc3_file_close(&file);
 
@@ -230,7 +462,7 @@ ZTEST(lc3_file, test_lc3_file_close_invalid_nullptr)
 ZTEST(lc3_file, test_lc3_file_close_invalid)
 {
 	int ret;
-	struct lc3_file_ctx file;
+	struct lc3_file_ctx file = {0};
 
 	sd_card_close_fake.return_val = -EINVAL;
 
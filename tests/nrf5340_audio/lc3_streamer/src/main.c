@@ -396,7 +396,7 @@ ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_valid_loop_stream)
 	zassert_equal(0, streamer_idx, "lc3_streamer_stream_register should return index 0");
 
 	/* Work item submitted by this call will get -ENODATA from lc3_file_frame_get, which will
-	 * trigger loop_stream()
+	 * trigger stream_loop()
 	 */
 	ret = lc3_streamer_next_frame_get(streamer_idx, &frame_buffer_1);
 	zassert_equal(0, ret, "lc3_streamer_next_frame_get should return success");
@@ -409,13 +409,14 @@ ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_valid_loop_stream)
 	zassert_mem_equal(fake_dataset1_valid, frame_buffer_2, fake_dataset1_valid_size,
 			  "Frame data was not as expected");
 
-	zassert_equal(lc3_file_close_fake.call_count, 1, "lc3_file_close should be called once");
-	zassert_equal(lc3_file_open_fake.call_count, 2, "lc3_file_open should be called twice");
+	zassert_equal(lc3_file_rewind_fake.call_count, 1, "lc3_file_rewind should be called once");
+	zassert_equal(lc3_file_close_fake.call_count, 0, "lc3_file_close should NOT be called");
+	zassert_equal(lc3_file_open_fake.call_count, 1, "lc3_file_open should be called once");
 	zassert_mem_equal(test_string, lc3_file_open_fake.arg1_val, sizeof(test_string),
 			  "lc3_file_open should be called with test");
 }
 
-ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_invalid_loop_stream_file_close_fail)
+ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_invalid_loop_stream_file_rewind_fail)
 {
 	int ret;
 	uint8_t streamer_idx;
@@ -424,7 +425,7 @@ ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_invalid_loop_stream_file_cl
 
 	char test_string[] = "test_filename";
 
-	lc3_file_close_fake.return_val = -EINVAL;
+	lc3_file_rewind_fake.return_val = -EIO;
 
 	int (*lc3_file_frame_get_custom_fakes[])(struct lc3_file_ctx *, uint8_t *, size_t) = {
 		lc3_file_frame_get_fake_valid, lc3_file_frame_get_fake_enodata,
@@ -440,49 +441,7 @@ ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_invalid_loop_stream_file_cl
 	zassert_equal(0, streamer_idx, "lc3_streamer_stream_register should return index 0");
 
 	/* Work item submitted by this call will get -ENODATA from lc3_file_frame_get, which will
-	 * trigger loop_stream(), which will get -EINVAL from lc3_file_close
-	 */
-	ret = lc3_streamer_next_frame_get(streamer_idx, &frame_buffer_1);
-	zassert_equal(0, ret, "lc3_streamer_next_frame_get should return success");
-	zassert_mem_equal(fake_dataset1_valid, frame_buffer_1, fake_dataset1_valid_size,
-			  "Frame data was not as expected");
-
-	ret = lc3_streamer_next_frame_get(streamer_idx, &frame_buffer_2);
-	zassert_equal(-EFAULT, ret,
-		      "lc3_streamer_next_frame_get should return -EFAULT as stream should not be "
-		      "playing");
-	zassert_equal(NULL, frame_buffer_2, "Frame buffer should be null");
-}
-
-ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_invalid_loop_stream_file_open_fail)
-{
-	int ret;
-	uint8_t streamer_idx;
-	const uint8_t *frame_buffer_1 = NULL;
-	const uint8_t *frame_buffer_2 = NULL;
-
-	char test_string[] = "test_filename";
-
-	int lc3_file_open_return_values[] = {0, -EINVAL};
-
-	SET_RETURN_SEQ(lc3_file_open, lc3_file_open_return_values,
-		       ARRAY_SIZE(lc3_file_open_return_values));
-
-	int (*lc3_file_frame_get_custom_fakes[])(struct lc3_file_ctx *, uint8_t *, size_t) = {
-		lc3_file_frame_get_fake_valid, lc3_file_frame_get_fake_enodata,
-		lc3_file_frame_get_fake_valid};
-
-	SET_CUSTOM_FAKE_SEQ(lc3_file_frame_get, lc3_file_frame_get_custom_fakes,
-			    ARRAY_SIZE(lc3_file_frame_get_custom_fakes));
-	k_work_submit_to_queue_fake.custom_fake = k_work_submit_to_queue_valid_fake;
-	k_work_init_fake.custom_fake = k_work_init_valid_fake;
-
-	ret = lc3_streamer_stream_register(test_string, &streamer_idx, true);
-	zassert_equal(0, ret, "lc3_streamer_stream_register should return success");
-	zassert_equal(0, streamer_idx, "lc3_streamer_stream_register should return index 0");
-
-	/* Work item submitted by this call will get -ENODATA from lc3_file_frame_get, which will
-	 * trigger loop_stream(), which will get -EINVAL from lc3_file_open
+	 * trigger stream_loop(), which will get -EIO from lc3_file_rewind
 	 */
 	ret = lc3_streamer_next_frame_get(streamer_idx, &frame_buffer_1);
 	zassert_equal(0, ret, "lc3_streamer_next_frame_get should return success");
@@ -494,6 +453,8 @@ ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_invalid_loop_stream_file_op
 		      "lc3_streamer_next_frame_get should return -EFAULT as stream should not be "
 		      "playing");
 	zassert_equal(NULL, frame_buffer_2, "Frame buffer should be null");
+	zassert_equal(2, lc3_file_frame_get_fake.call_count,
+		      "lc3_file_frame_get should not be called after failed rewind");
 }
 
 ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_invalid_loop_stream_frame_get_fail)
@@ -519,7 +480,7 @@ ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_invalid_loop_stream_frame_g
 	zassert_equal(0, streamer_idx, "lc3_streamer_stream_register should return index 0");
 
 	/* Work item submitted by this call will get -ENODATA from lc3_file_frame_get, which will
-	 * trigger loop_stream(), which will get -ENODATA from lc3_file_frame_get again.
+	 * trigger stream_loop(), which will get -ENODATA from lc3_file_frame_get again.
 	 */
 	ret = lc3_streamer_next_frame_get(streamer_idx, &frame_buffer_1);
 	zassert_equal(0, ret, "lc3_streamer_next_frame_get should return success");
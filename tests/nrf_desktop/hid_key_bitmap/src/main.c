@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "hid_key_bitmap.h"
+
+#define KEY_A		0x04
+#define KEY_B		0x05
+#define KEY_C		0x06
+#define KEY_ENTER	0x28
+#define KEY_LEFT_CTRL	0xE0
+#define KEY_RIGHT_GUI	0xE7
+
+static struct hid_key_bitmap kb;
+static uint8_t keys[KEYBOARD_REPORT_KEY_COUNT_MAX];
+
+static uint8_t report_fill(void)
+{
+	/* Make sure every slot is written. */
+	memset(keys, 0xFF, sizeof(keys));
+
+	return hid_key_bitmap_report_fill(&kb, keys);
+}
+
+static void keys_check(const uint8_t *expected, size_t cnt)
+{
+	zassert_true(cnt <= ARRAY_SIZE(keys));
+
+	if (cnt > 0) {
+		zassert_mem_equal(keys, expected, cnt);
+	}
+
+	for (size_t i = cnt; i < ARRAY_SIZE(keys); i++) {
+		zassert_equal(keys[i], 0, "Slot %zu not cleared", i);
+	}
+}
+
+ZTEST(hid_key_bitmap, test_empty_report)
+{
+	zassert_equal(report_fill(), 0);
+	keys_check(NULL, 0);
+}
+
+ZTEST(hid_key_bitmap, test_press_release)
+{
+	static const uint8_t expected[] = {KEY_A};
+
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_A, 1));
+	zassert_equal(kb.key_count, 1);
+	zassert_equal(report_fill(), 0);
+	keys_check(expected, ARRAY_SIZE(expected));
+
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_A, -1));
+	zassert_equal(kb.key_count, 0);
+	zassert_equal(report_fill(), 0);
+	keys_check(NULL, 0);
+}
+
+ZTEST(hid_key_bitmap, test_reference_count)
+{
+	static const uint8_t expected[] = {KEY_A};
+
+	/* Key pressed by two sources is released when both of them release it. */
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_A, 1));
+	zassert_false(hid_key_bitmap_value_set(&kb, KEY_A, 1));
+
+	zassert_false(hid_key_bitmap_value_set(&kb, KEY_A, -1));
+	report_fill();
+	keys_check(expected, ARRAY_SIZE(expected));
+
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_A, -1));
+	report_fill();
+	keys_check(NULL, 0);
+
+	/* Unpaired release is ignored. */
+	zassert_false(hid_key_bitmap_value_set(&kb, KEY_A, -1));
+	zassert_equal(kb.key_count, 0);
+}
+
+ZTEST(hid_key_bitmap, test_reference_count_overflow)
+{
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_A, UINT8_MAX));
+	zassert_false(hid_key_bitmap_value_set(&kb, KEY_A, 1));
+	zassert_false(hid_key_bitmap_value_set(&kb, KEY_A, 1 - UINT8_MAX));
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_A, -1));
+}
+
+ZTEST(hid_key_bitmap, test_modifiers)
+{
+	static const uint8_t expected[] = {KEY_B};
+
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_LEFT_CTRL, 1));
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_RIGHT_GUI, 1));
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_B, 1));
+
+	/* Modifiers are not counted as keys. */
+	zassert_equal(kb.key_count, 1);
+	zassert_equal(report_fill(), BIT(0) | BIT(7));
+	keys_check(expected, ARRAY_SIZE(expected));
+
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_LEFT_CTRL, -1));
+	zassert_equal(report_fill(), BIT(7));
+}
+
+ZTEST(hid_key_bitmap, test_undefined_usage)
+{
+	/* Usages between the last key and the first modifier are not supported. */
+	zassert_false(hid_key_bitmap_value_set(&kb, KEYBOARD_REPORT_LAST_KEY + 1, 1));
+	zassert_false(hid_key_bitmap_value_set(&kb, KEYBOARD_REPORT_LAST_MODIFIER + 1, 1));
+	zassert_equal(kb.key_count, 0);
+	zassert_equal(report_fill(), 0);
+	keys_check(NULL, 0);
+}
+
+ZTEST(hid_key_bitmap, test_report_order)
+{
+	static const uint8_t expected[] = {KEY_A, KEY_C, KEY_ENTER, KEYBOARD_REPORT_LAST_KEY};
+
+	/* Keys are reported in ascending usage order, regardless of press order. */
+	zassert_true(hid_key_bitmap_value_set(&kb, KEYBOARD_REPORT_LAST_KEY, 1));
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_ENTER, 1));
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_C, 1));
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_A, 1));
+
+	report_fill();
+	keys_check(expected, ARRAY_SIZE(expected));
+}
+
+ZTEST(hid_key_bitmap, test_rollover)
+{
+	uint8_t expected[KEYBOARD_REPORT_KEY_COUNT_MAX];
+
+	for (size_t i = 0; i < KEYBOARD_REPORT_KEY_COUNT_MAX; i++) {
+		expected[i] = KEY_A + i;
+		zassert_true(hid_key_bitmap_value_set(&kb, KEY_A + i, 1));
+	}
+
+	report_fill();
+	keys_check(expected, ARRAY_SIZE(expected));
+
+	/* One key too many - every slot reports ErrorRollOver. */
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_ENTER, 1));
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_LEFT_CTRL, 1));
+	zassert_equal(report_fill(), BIT(0));
+
+	for (size_t i = 0; i < ARRAY_SIZE(keys); i++) {
+		zassert_equal(keys[i], KEYBOARD_REPORT_ERROR_ROLLOVER);
+	}
+
+	/* All the keys are still tracked, releasing one restores the report. */
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_ENTER, -1));
+	report_fill();
+	keys_check(expected, ARRAY_SIZE(expected));
+}
+
+ZTEST(hid_key_bitmap, test_reset)
+{
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_A, 1));
+	zassert_true(hid_key_bitmap_value_set(&kb, KEY_LEFT_CTRL, 1));
+
+	hid_key_bitmap_reset(&kb);
+
+	zassert_equal(kb.key_count, 0);
+	zassert_equal(report_fill(), 0);
+	keys_check(NULL, 0);
+
+	/* Reference counters are cleared too. */
+	zassert_false(hid_key_bitmap_value_set(&kb, KEY_A, -1));
+}
+
+ZTEST(hid_key_bitmap, test_benchmark)
+{
+	const uint32_t rounds = 1000;
+	uint32_t start;
+	uint32_t cycles;
+
+	start = k_cycle_get_32();
+
+	for (uint32_t i = 0; i < rounds; i++) {
+		uint16_t usage = KEY_A + (i % KEYBOARD_REPORT_KEY_COUNT_MAX);
+
+		(void)hid_key_bitmap_value_set(&kb, usage, 1);
+		(void)hid_key_bitmap_report_fill(&kb, keys);
+		(void)hid_key_bitmap_value_set(&kb, usage, -1);
+		(void)hid_key_bitmap_report_fill(&kb, keys);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	printk("Key press and release with report fill: %u cycles\n", cycles / rounds);
+	zassert_equal(kb.key_count, 0);
+}
+
+static void hid_key_bitmap_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	hid_key_bitmap_reset(&kb);
+}
+
+ZTEST_SUITE(hid_key_bitmap, NULL, NULL, hid_key_bitmap_before, NULL, NULL);
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "slm_quit_str.h"
+
+#define STREAM_LEN_MAX 64
+
+static size_t partial;
+static struct slm_quit_str_scan scan;
+
+static void scan_str(const char *quit_str, const char *buf)
+{
+	slm_quit_str_scan(quit_str, strlen(quit_str), &partial, (const uint8_t *)buf, strlen(buf),
+			  &scan);
+}
+
+static void scan_check(size_t carried_data, size_t data_len, size_t processed, bool match)
+{
+	zassert_equal(scan.carried_data, carried_data);
+	zassert_equal(scan.data_len, data_len);
+	zassert_equal(scan.processed, processed);
+	zassert_equal(scan.match, match);
+}
+
+/* Pass the stream to the scan in chunks of the given size, like the UART handler does,
+ * and collect the data that comes before the terminator into out.
+ * Returns true if the terminator was found.
+ */
+static bool stream_scan(const char *quit_str, const char *stream, size_t chunk_len, char *out)
+{
+	const size_t quit_str_len = strlen(quit_str);
+	const size_t stream_len = strlen(stream);
+	size_t out_len = 0;
+	size_t pos = 0;
+
+	partial = 0;
+
+	while (pos < stream_len) {
+		const size_t end = MIN(pos + chunk_len, stream_len);
+
+		/* The rest of the chunk is scanned again after a partial match, like in
+		 * slm_at_receive().
+		 */
+		while (pos < end) {
+			slm_quit_str_scan(quit_str, quit_str_len, &partial,
+					  (const uint8_t *)&stream[pos], end - pos, &scan);
+			zassert_true(scan.processed > 0);
+			zassert_true(scan.data_len <= scan.processed);
+
+			memcpy(&out[out_len], quit_str, scan.carried_data);
+			out_len += scan.carried_data;
+			memcpy(&out[out_len], &stream[pos], scan.data_len);
+			out_len += scan.data_len;
+			pos += scan.processed;
+
+			if (scan.match) {
+				out[out_len] = '\0';
+				return true;
+			}
+		}
+	}
+
+	/* A partial terminator at the end of the stream is data too. */
+	memcpy(&out[out_len], quit_str, partial);
+	out[out_len + partial] = '\0';
+
+	return false;
+}
+
+/* Compare the chunked scan with a plain search of the whole stream for every chunk size. */
+static void stream_check(const char *quit_str, const char *stream)
+{
+	const char *found = strstr(stream, quit_str);
+	const size_t expected_len = found ? (size_t)(found - stream) : strlen(stream);
+	char out[STREAM_LEN_MAX + 1];
+
+	for (size_t chunk_len = 1; chunk_len <= strlen(stream); chunk_len++) {
+		bool match = stream_scan(quit_str, stream, chunk_len, out);
+
+		zassert_equal(match, found != NULL, "\"%s\" in \"%s\", chunks of %zu", quit_str,
+			      stream, chunk_len);
+		zassert_equal(strlen(out), expected_len, "\"%s\" in \"%s\", chunks of %zu",
+			      quit_str, stream, chunk_len);
+		zassert_mem_equal(out, stream, expected_len);
+	}
+}
+
+ZTEST(slm_quit_str, test_no_terminator)
+{
+	scan_str("+++", "hello");
+	scan_check(0, 5, 5, false);
+	zassert_equal(partial, 0);
+}
+
+ZTEST(slm_quit_str, test_terminator)
+{
+	scan_str("+++", "ab+++cd");
+	scan_check(0, 2, 5, true);
+	zassert_equal(partial, 0);
+}
+
+ZTEST(slm_quit_str, test_split_terminator)
+{
+	scan_str("+++", "ab++");
+	scan_check(0, 2, 4, false);
+	zassert_equal(partial, 2);
+
+	scan_str("+++", "+cd");
+	scan_check(0, 0, 1, true);
+	zassert_equal(partial, 0);
+}
+
+ZTEST(slm_quit_str, test_partial_terminator_is_data)
+{
+	scan_str("+++", "ab++");
+	zassert_equal(partial, 2);
+
+	scan_str("+++", "cd");
+	scan_check(2, 2, 2, false);
+	zassert_equal(partial, 0);
+}
+
+ZTEST(slm_quit_str, test_repeated_character)
+{
+	/* The terminator is found in "++++", the last character is not processed. */
+	scan_str("+++", "++");
+	zassert_equal(partial, 2);
+
+	scan_str("+++", "++");
+	scan_check(0, 0, 1, true);
+}
+
+ZTEST(slm_quit_str, test_self_overlapping)
+{
+	/* "aa" may start "aab", but when the next byte is 'a', the terminator starts one
+	 * byte later within the carried bytes.
+	 */
+	scan_str("aab", "xaa");
+	scan_check(0, 1, 3, false);
+	zassert_equal(partial, 2);
+
+	scan_str("aab", "ab");
+	scan_check(1, 0, 2, true);
+	zassert_equal(partial, 0);
+}
+
+ZTEST(slm_quit_str, test_self_overlapping_byte_by_byte)
+{
+	scan_str("aab", "a");
+	scan_str("aab", "a");
+	zassert_equal(partial, 2);
+
+	scan_str("aab", "a");
+	scan_check(1, 0, 1, false);
+	zassert_equal(partial, 2);
+
+	scan_str("aab", "b");
+	scan_check(0, 0, 1, true);
+}
+
+ZTEST(slm_quit_str, test_self_overlapping_in_buffer)
+{
+	scan_str("aab", "aaab");
+	scan_check(0, 1, 4, true);
+}
+
+ZTEST(slm_quit_str, test_streams)
+{
+	static const char *const quit_strs[] = {"+++", "aab", "abab", "aaa", "abaab"};
+	static const char *const streams[] = {
+		"xyz",
+		"aab",
+		"aaab",
+		"aaaab",
+		"abaab",
+		"ababab",
+		"abaabab",
+		"abababaab",
+		"aabaabaab",
+		"++a+++",
+		"+a++b+++c",
+		"aaaaaaaaaaaaaaaaaaab",
+		"abaababaabaaab",
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(quit_strs); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(streams); j++) {
+			stream_check(quit_strs[i], streams[j]);
+		}
+	}
+}
+
+ZTEST(slm_quit_str, test_random_streams)
+{
+	static const char *const quit_strs[] = {"aab", "abab", "aaa", "abaab"};
+	char stream[STREAM_LEN_MAX + 1];
+	uint32_t seed = 1;
+
+	/* Streams of two characters hit the terminators, and their partial matches, often. */
+	for (size_t round = 0; round < 200; round++) {
+		size_t len = 1 + round % STREAM_LEN_MAX;
+
+		for (size_t i = 0; i < len; i++) {
+			/* Linear congruential generator, the streams are the same on every run. */
+			seed = seed * 1103515245 + 12345;
+			stream[i] = (seed >> 16) & 1 ? 'a' : 'b';
+		}
+		stream[len] = '\0';
+
+		stream_check(quit_strs[round % ARRAY_SIZE(quit_strs)], stream);
+	}
+}
+
+static void slm_quit_str_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	partial = 0;
+}
+
+ZTEST_SUITE(slm_quit_str, NULL, NULL, slm_quit_str_before, NULL, NULL);
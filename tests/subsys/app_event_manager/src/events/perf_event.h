@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PERF_EVENT_H_
+#define _PERF_EVENT_H_
+
+/**
+ * @brief Performance Measurement Event
+ * @defgroup perf_event Performance Measurement Event
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct perf_event {
+	struct app_event_header header;
+
+	uint32_t seq;
+};
+
+APP_EVENT_TYPE_DECLARE(perf_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _PERF_EVENT_H_ */
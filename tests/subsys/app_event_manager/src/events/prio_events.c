@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "prio_events.h"
+
+APP_EVENT_TYPE_DEFINE(bulk_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+
+APP_EVENT_TYPE_DEFINE(urgent_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY));
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PRIO_EVENTS_H_
+#define _PRIO_EVENTS_H_
+
+/**
+ * @brief Bulk and Urgent Events
+ * @defgroup prio_events Bulk and Urgent Events
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct bulk_event {
+	struct app_event_header header;
+
+	uint32_t submit_cycles;
+};
+
+APP_EVENT_TYPE_DECLARE(bulk_event);
+
+struct urgent_event {
+	struct app_event_header header;
+
+	uint32_t submit_cycles;
+};
+
+APP_EVENT_TYPE_DECLARE(urgent_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _PRIO_EVENTS_H_ */
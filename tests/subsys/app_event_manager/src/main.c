@@ -179,11 +179,69 @@ ZTEST(suite0, test_event_size_disabled)
 	app_event_manager_free(ev_s1);
 }
 
+ZTEST(suite0, test_event_slab)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB)) {
+		ztest_test_skip();
+		return;
+	}
+
+	struct test_size1_event *ev_s1[CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_BLOCK_CNT + 1];
+	struct app_event_manager_slab_stats stats_before;
+	struct app_event_manager_slab_stats stats;
+	struct test_dynamic_event *ev_dyn;
+	int err;
+
+	err = app_event_manager_slab_stats_get(APP_EVENT_ID(test_size1_event), &stats_before);
+	zassert_ok(err, "Event without dynamic data has no slab");
+	zassert_equal(stats_before.num_used, 0, "Slab blocks leaked");
+	zassert_true(stats_before.block_size >= sizeof(*ev_s1[0]), "Slab block too small");
+
+	/* The last event does not fit in the slab and is allocated from the heap. */
+	for (size_t i = 0; i < ARRAY_SIZE(ev_s1); i++) {
+		ev_s1[i] = new_test_size1_event();
+		zassert_not_null(ev_s1[i], "Event allocation failed");
+	}
+
+	err = app_event_manager_slab_stats_get(APP_EVENT_ID(test_size1_event), &stats);
+	zassert_ok(err, "Cannot get slab statistics");
+	zassert_equal(stats.num_used, stats.num_blocks, "Slab was not used");
+	zassert_equal(stats.max_used, stats.num_blocks, "Invalid slab high-water mark");
+	zassert_equal(stats.fallback_cnt, stats_before.fallback_cnt + 1,
+		      "Heap fallback was not counted");
+
+	for (size_t i = 0; i < ARRAY_SIZE(ev_s1); i++) {
+		app_event_manager_free(ev_s1[i]);
+	}
+
+	err = app_event_manager_slab_stats_get(APP_EVENT_ID(test_size1_event), &stats);
+	zassert_ok(err, "Cannot get slab statistics");
+	zassert_equal(stats.num_used, 0, "Slab blocks were not released");
+
+	/* Events with dynamic data are always allocated from the heap. */
+	err = app_event_manager_slab_stats_get(APP_EVENT_ID(test_dynamic_event), &stats);
+	zassert_equal(err, -ENOENT, "Event with dynamic data has a slab");
+
+	ev_dyn = new_test_dynamic_event(10);
+	zassert_not_null(ev_dyn, "Event allocation failed");
+	app_event_manager_free(ev_dyn);
+}
+
 ZTEST(suite0, test_name_style_events_sorting)
 {
 	test_start(TEST_NAME_STYLE_SORTING);
 }
 
+ZTEST(suite0, test_high_priority_queue)
+{
+	test_start(TEST_HIGH_PRIORITY_QUEUE);
+}
+
+ZTEST(suite0, test_dispatch_perf)
+{
+	test_start(TEST_DISPATCH_PERF);
+}
+
 ZTEST_SUITE(suite0, NULL, test_init, NULL, NULL, NULL);
 
 static bool app_event_handler(const struct app_event_header *aeh)
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "perf_event.h"
+
+#define MODULE test_dispatch_perf
+
+#define TEST_PERF_EVENT_CNT	200
+#define TEST_PERF_LISTENER_CNT	4
+
+typedef bool (*perf_listener_fn)(const struct app_event_header *aeh);
+
+static uint32_t dispatch_start;
+static uint32_t dispatch_cycles;
+static uint32_t received_cnt;
+static bool test_active;
+
+/* Reference measurement of the event dispatch cost. It is not a proof of a speedup: the dispatch
+ * before the change is not built, and the logging path is not measured, because the test runs
+ * without CONFIG_APP_EVENT_MANAGER_SHOW_EVENT_HANDLERS. The cycle counts depend on the platform,
+ * so nothing is asserted about them and they are only printed for comparison between builds.
+ */
+
+/* The cycles are counted from the entry to the first listener until the entry to the last
+ * listener, so that event allocation, submitting and the work queue hand-off are not included.
+ */
+static bool perf_event_first_handler(const struct app_event_header *aeh)
+{
+	dispatch_start = k_cycle_get_32();
+
+	return false;
+}
+
+static bool perf_event_handler(const struct app_event_header *aeh)
+{
+	return false;
+}
+
+static bool perf_event_last_handler(const struct app_event_header *aeh)
+{
+	dispatch_cycles += k_cycle_get_32() - dispatch_start;
+
+	return false;
+}
+
+/* Reference point: the same listeners called from a dense array of notification functions.
+ * This is the lower bound of the dispatch cost, not the dispatch before the change.
+ */
+static perf_listener_fn volatile baseline_listeners[TEST_PERF_LISTENER_CNT] = {
+	perf_event_first_handler,
+	perf_event_handler,
+	perf_event_handler,
+	perf_event_last_handler,
+};
+
+static uint32_t baseline_measure(void)
+{
+	struct perf_event event = {
+		.header.type_id = APP_EVENT_ID(perf_event),
+	};
+
+	dispatch_cycles = 0;
+
+	for (size_t i = 0; i < TEST_PERF_EVENT_CNT; i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(baseline_listeners); j++) {
+			if (baseline_listeners[j](&event.header)) {
+				break;
+			}
+		}
+	}
+
+	return dispatch_cycles;
+}
+
+static void event_submit(uint32_t seq)
+{
+	struct perf_event *event = new_perf_event();
+
+	event->seq = seq;
+	APP_EVENT_SUBMIT(event);
+}
+
+static void test_finish(void)
+{
+	uint32_t aem_cycles = dispatch_cycles;
+	uint32_t baseline_cycles = baseline_measure();
+
+	printk("Event dispatch reference (%u listeners, %u events): %u cycles per event, "
+	       "%u cycles per event when calling the listeners from an array\n",
+	       TEST_PERF_LISTENER_CNT, TEST_PERF_EVENT_CNT, aem_cycles / TEST_PERF_EVENT_CNT,
+	       baseline_cycles / TEST_PERF_EVENT_CNT);
+
+	test_active = false;
+
+	struct test_end_event *et = new_test_end_event();
+
+	et->test_id = TEST_DISPATCH_PERF;
+	APP_EVENT_SUBMIT(et);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		switch (st->test_id) {
+		case TEST_DISPATCH_PERF:
+			test_active = true;
+			received_cnt = 0;
+			dispatch_cycles = 0;
+			event_submit(0);
+			break;
+
+		default:
+			/* Ignore other test cases, check if proper test_id. */
+			zassert_true(st->test_id < TEST_CNT, "test_id out of range");
+			break;
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+static bool perf_event_final_handler(const struct app_event_header *aeh)
+{
+	perf_event_last_handler(aeh);
+
+	struct perf_event *event = cast_perf_event(aeh);
+
+	zassert_not_null(event, "Event unhandled");
+	zassert_true(test_active, "Unexpected perf event");
+	zassert_equal(event->seq, received_cnt, "Incorrect event order");
+
+	/* Only one event is in flight at a time to measure the cost of a single dispatch. */
+	received_cnt++;
+	if (received_cnt < TEST_PERF_EVENT_CNT) {
+		event_submit(received_cnt);
+	} else {
+		test_finish();
+	}
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+
+/* The measured event is delivered to several listeners. The last one tracks the progress. */
+APP_EVENT_LISTENER(test_dispatch_perf_l1, perf_event_first_handler);
+APP_EVENT_SUBSCRIBE_EARLY(test_dispatch_perf_l1, perf_event);
+APP_EVENT_LISTENER(test_dispatch_perf_l2, perf_event_handler);
+APP_EVENT_SUBSCRIBE(test_dispatch_perf_l2, perf_event);
+APP_EVENT_LISTENER(test_dispatch_perf_l3, perf_event_handler);
+APP_EVENT_SUBSCRIBE(test_dispatch_perf_l3, perf_event);
+APP_EVENT_LISTENER(test_dispatch_perf_final, perf_event_final_handler);
+APP_EVENT_SUBSCRIBE_FINAL(test_dispatch_perf_final, perf_event);
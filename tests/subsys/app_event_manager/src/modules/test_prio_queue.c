@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "prio_events.h"
+
+#define MODULE test_prio_queue
+
+/* Every round submits a burst of bulk events followed by a single urgent event. */
+#define TEST_ROUND_CNT		50
+#define TEST_BULK_PER_ROUND	8
+
+static uint32_t urgent_latency[TEST_ROUND_CNT];
+static size_t round_idx;
+static size_t bulk_left;
+static size_t bulk_since_urgent;
+static bool urgent_pending;
+static bool test_active;
+
+
+static void round_submit(void)
+{
+	for (size_t i = 0; i < TEST_BULK_PER_ROUND; i++) {
+		struct bulk_event *be = new_bulk_event();
+
+		be->submit_cycles = k_cycle_get_32();
+		APP_EVENT_SUBMIT(be);
+	}
+
+	bulk_left = TEST_BULK_PER_ROUND;
+	bulk_since_urgent = 0;
+	urgent_pending = true;
+
+	struct urgent_event *ue = new_urgent_event();
+
+	ue->submit_cycles = k_cycle_get_32();
+	APP_EVENT_SUBMIT(ue);
+}
+
+static void latency_sort(uint32_t *tab, size_t cnt)
+{
+	for (size_t i = 1; i < cnt; i++) {
+		uint32_t val = tab[i];
+		size_t j = i;
+
+		for (; (j > 0) && (tab[j - 1] > val); j--) {
+			tab[j] = tab[j - 1];
+		}
+		tab[j] = val;
+	}
+}
+
+static uint32_t latency_percentile_us(const uint32_t *sorted, size_t cnt, size_t percentile)
+{
+	size_t idx = (cnt * percentile) / 100;
+
+	return k_cyc_to_us_ceil32(sorted[MIN(idx, cnt - 1)]);
+}
+
+static void test_finish(void)
+{
+	latency_sort(urgent_latency, ARRAY_SIZE(urgent_latency));
+
+	printk("Urgent event latency under bulk load [us]: p50=%u p90=%u p99=%u max=%u\n",
+	       latency_percentile_us(urgent_latency, ARRAY_SIZE(urgent_latency), 50),
+	       latency_percentile_us(urgent_latency, ARRAY_SIZE(urgent_latency), 90),
+	       latency_percentile_us(urgent_latency, ARRAY_SIZE(urgent_latency), 99),
+	       latency_percentile_us(urgent_latency, ARRAY_SIZE(urgent_latency), 100));
+
+	test_active = false;
+
+	struct test_end_event *et = new_test_end_event();
+
+	et->test_id = TEST_HIGH_PRIORITY_QUEUE;
+	APP_EVENT_SUBMIT(et);
+}
+
+static void round_check(void)
+{
+	if ((bulk_left > 0) || urgent_pending) {
+		return;
+	}
+
+	round_idx++;
+	if (round_idx < TEST_ROUND_CNT) {
+		round_submit();
+	} else {
+		test_finish();
+	}
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		switch (st->test_id) {
+		case TEST_HIGH_PRIORITY_QUEUE:
+			test_active = true;
+			round_idx = 0;
+			round_submit();
+			break;
+
+		default:
+			/* Ignore other test cases, check if proper test_id. */
+			zassert_true(st->test_id < TEST_CNT, "test_id out of range");
+			break;
+		}
+
+		return false;
+	}
+
+	if (is_bulk_event(aeh)) {
+		zassert_true(test_active, "Unexpected bulk event");
+		zassert_true(bulk_left > 0, "Too many bulk events");
+
+		bulk_left--;
+		if (urgent_pending) {
+			bulk_since_urgent++;
+		}
+		round_check();
+
+		return false;
+	}
+
+	if (is_urgent_event(aeh)) {
+		struct urgent_event *ue = cast_urgent_event(aeh);
+
+		zassert_true(test_active, "Unexpected urgent event");
+		zassert_true(urgent_pending, "Too many urgent events");
+
+		urgent_latency[round_idx] = k_cycle_get_32() - ue->submit_cycles;
+		urgent_pending = false;
+
+		/* With the high priority queue, the urgent event overtakes the bulk events that
+		 * were submitted before it. Otherwise, it is processed after all of them.
+		 */
+		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_QUEUE)) {
+			zassert_equal(bulk_since_urgent, 0, "Urgent event was not prioritized");
+		} else {
+			zassert_equal(bulk_since_urgent, TEST_BULK_PER_ROUND,
+				      "Incorrect event order");
+		}
+		round_check();
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, bulk_event);
+APP_EVENT_SUBSCRIBE(MODULE, urgent_event);
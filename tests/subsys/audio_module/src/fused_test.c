@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include "audio_module/audio_module.h"
+
+#include "audio_module_test_fakes.h"
+#include "audio_module_test_common.h"
+
+#define TEST_CHAIN_LEN	      (3)
+#define TEST_BENCHMARK_BLOCKS (100)
+#define TEST_SENDER_CNT	      (2)
+#define TEST_SENDER_BLOCKS    (10)
+
+K_THREAD_STACK_ARRAY_DEFINE(chain_stacks, TEST_CHAIN_LEN, TEST_MOD_THREAD_STACK_SIZE);
+K_MEM_SLAB_DEFINE(chain_slab, TEST_MOD_DATA_SIZE, (FAKE_FIFO_MSG_QUEUE_SIZE * TEST_CHAIN_LEN), 4);
+
+static struct data_fifo chain_fifo_rx[TEST_CHAIN_LEN];
+static struct data_fifo chain_fifo_tx;
+static struct audio_module_handle chain_handles[TEST_CHAIN_LEN];
+static struct mod_context chain_contexts[TEST_CHAIN_LEN];
+static struct mod_config chain_config = {
+	.test_int1 = 1, .test_int2 = 2, .test_int3 = 3, .test_int4 = 4};
+
+static int process_count;
+static int in_place_count;
+
+K_THREAD_STACK_ARRAY_DEFINE(sender_stacks, TEST_SENDER_CNT, TEST_MOD_THREAD_STACK_SIZE);
+static struct k_thread sender_threads[TEST_SENDER_CNT];
+static struct audio_module_handle sink_handle;
+static atomic_t sink_active;
+static atomic_t sink_overlaps;
+static atomic_t sink_count;
+
+/**
+ * @brief Test process data function that adds one to every byte of the audio data.
+ *
+ * @param handle         [in/out]  The handle to the module instance.
+ * @param audio_data_rx  [in]      Pointer to the input audio data.
+ * @param audio_data_tx  [out]     Pointer to the output audio data.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int increment_data_process(struct audio_module_handle_private *handle,
+				  struct audio_data const *const audio_data_rx,
+				  struct audio_data *audio_data_tx)
+{
+	uint8_t const *data_rx = audio_data_rx->data;
+	uint8_t *data_tx = audio_data_tx->data;
+
+	ARG_UNUSED(handle);
+
+	for (size_t i = 0; i < audio_data_rx->data_size; i++) {
+		data_tx[i] = data_rx[i] + 1;
+	}
+
+	memcpy(&audio_data_tx->meta, &audio_data_rx->meta, sizeof(struct audio_metadata));
+	audio_data_tx->data_size = audio_data_rx->data_size;
+
+	process_count++;
+	if (data_tx == data_rx) {
+		in_place_count++;
+	}
+
+	return 0;
+}
+
+static const struct audio_module_functions ft_increment = {
+	.configuration_set = test_config_set_function,
+	.configuration_get = test_config_get_function,
+	.data_process = increment_data_process};
+static struct audio_module_description increment_description = {
+	.name = "Increment", .type = AUDIO_MODULE_TYPE_IN_OUT, .functions = &ft_increment};
+static struct audio_module_description increment_in_place_description = {
+	.name = "Increment in place",
+	.type = AUDIO_MODULE_TYPE_IN_OUT,
+	.functions = &ft_increment,
+	.data_in_place = true};
+
+/**
+ * @brief Test process data function that checks that it is not run concurrently.
+ *
+ * @param handle         [in/out]  The handle to the module instance.
+ * @param audio_data_rx  [in]      Pointer to the input audio data.
+ * @param audio_data_tx  [out]     Pointer to the output audio data.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int sink_data_process(struct audio_module_handle_private *handle,
+			     struct audio_data const *const audio_data_rx,
+			     struct audio_data *audio_data_tx)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(audio_data_rx);
+	ARG_UNUSED(audio_data_tx);
+
+	if (atomic_inc(&sink_active) != 0) {
+		atomic_inc(&sink_overlaps);
+	}
+
+	/* Give the other senders a chance to enter the module. */
+	k_msleep(1);
+
+	atomic_inc(&sink_count);
+	atomic_dec(&sink_active);
+
+	return 0;
+}
+
+static const struct audio_module_functions ft_sink = {
+	.configuration_set = test_config_set_function,
+	.configuration_get = test_config_get_function,
+	.data_process = sink_data_process};
+static struct audio_module_description sink_description = {
+	.name = "Sink", .type = AUDIO_MODULE_TYPE_OUTPUT, .functions = &ft_sink};
+
+static void sender_thread(void *p1, void *p2, void *p3)
+{
+	int ret;
+	uint8_t data[TEST_MOD_DATA_SIZE] = {0};
+	struct audio_data audio_data = {.data = data, .data_size = sizeof(data)};
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < TEST_SENDER_BLOCKS; i++) {
+		ret = audio_module_data_tx(&sink_handle, &audio_data, NULL);
+		zassert_equal(ret, 0, "Data TX function did not return successfully: ret %d", ret);
+	}
+}
+
+/**
+ * @brief Open, connect and start a chain of modules, the output of the last module is put on
+ *        its TX FIFO.
+ *
+ * @param fused     [in]  Flag to run the modules in the thread of the sender.
+ * @param in_place  [in]  Flag to let the modules process the audio data in place.
+ */
+static void chain_open(bool fused, bool in_place)
+{
+	int ret;
+
+	data_fifo_init_fake.custom_fake = fake_data_fifo_init__succeeds;
+	data_fifo_uninit_fake.custom_fake = fake_data_fifo_uninit__succeeds;
+	data_fifo_empty_fake.custom_fake = fake_data_fifo_empty__succeeds;
+	data_fifo_pointer_first_vacant_get_fake.custom_fake =
+		fake_data_fifo_pointer_first_vacant_get__succeeds;
+	data_fifo_block_lock_fake.custom_fake = fake_data_fifo_block_lock__succeeds;
+	data_fifo_pointer_last_filled_get_fake.custom_fake =
+		fake_data_fifo_pointer_last_filled_get__succeeds;
+	data_fifo_block_free_fake.custom_fake = fake_data_fifo_block_free__succeeds;
+	data_fifo_state_fake.custom_fake = fake_data_fifo_state__succeeds;
+
+	fake_fifo_counter_reset();
+
+	memset(chain_fifo_rx, 0, sizeof(chain_fifo_rx));
+	memset(&chain_fifo_tx, 0, sizeof(chain_fifo_tx));
+	memset(chain_handles, 0, sizeof(chain_handles));
+
+	process_count = 0;
+	in_place_count = 0;
+
+	for (int i = 0; i < TEST_CHAIN_LEN; i++) {
+		struct audio_module_parameters parameters = {
+			.description =
+				in_place ? &increment_in_place_description : &increment_description,
+			.thread = {.stack = chain_stacks[i],
+				   .stack_size = K_THREAD_STACK_SIZEOF(chain_stacks[i]),
+				   .priority = TEST_MOD_THREAD_PRIORITY,
+				   .msg_rx = fused ? NULL : &chain_fifo_rx[i],
+				   .msg_tx = (i == TEST_CHAIN_LEN - 1) ? &chain_fifo_tx : NULL,
+				   .data_slab = &chain_slab,
+				   .data_size = TEST_MOD_DATA_SIZE,
+				   .fused = fused}};
+
+		ret = audio_module_open(&parameters,
+					(struct audio_module_configuration *)&chain_config,
+					TEST_INSTANCE_NAME,
+					(struct audio_module_context *)&chain_contexts[i],
+					&chain_handles[i]);
+		zassert_equal(ret, 0, "Open function did not return successfully: ret %d", ret);
+	}
+
+	for (int i = 0; i < TEST_CHAIN_LEN - 1; i++) {
+		ret = audio_module_connect(&chain_handles[i], &chain_handles[i + 1], false);
+		zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+	}
+
+	ret = audio_module_connect(&chain_handles[TEST_CHAIN_LEN - 1], NULL, true);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	for (int i = 0; i < TEST_CHAIN_LEN; i++) {
+		ret = audio_module_start(&chain_handles[i]);
+		zassert_equal(ret, 0, "Start function did not return successfully: ret %d", ret);
+	}
+}
+
+static void chain_close(void)
+{
+	int ret;
+
+	/* Let the module threads release the audio data they still hold. */
+	k_msleep(10);
+
+	zassert_equal(k_mem_slab_num_used_get(&chain_slab), 0, "%d data buffers not released",
+		      k_mem_slab_num_used_get(&chain_slab));
+
+	for (int i = 0; i < TEST_CHAIN_LEN; i++) {
+		ret = audio_module_stop(&chain_handles[i]);
+		zassert_equal(ret, 0, "Stop function did not return successfully: ret %d", ret);
+
+		ret = audio_module_close(&chain_handles[i]);
+		zassert_equal(ret, 0, "Close function did not return successfully: ret %d", ret);
+	}
+}
+
+/**
+ * @brief Send a block through the chain and check the block that comes out of it.
+ *
+ * @param seed  [in]  Value of the first byte of the block.
+ */
+static void chain_block_test(uint8_t seed)
+{
+	int ret;
+	uint8_t data_in[TEST_MOD_DATA_SIZE];
+	uint8_t data_out[TEST_MOD_DATA_SIZE];
+	struct audio_data audio_data_in = {.data = data_in, .data_size = sizeof(data_in)};
+	struct audio_data audio_data_out = {.data = data_out, .data_size = sizeof(data_out)};
+
+	for (int i = 0; i < sizeof(data_in); i++) {
+		data_in[i] = seed + i;
+	}
+
+	ret = audio_module_data_tx(&chain_handles[0], &audio_data_in, NULL);
+	zassert_equal(ret, 0, "Data TX function did not return successfully: ret %d", ret);
+
+	ret = audio_module_data_rx(&chain_handles[TEST_CHAIN_LEN - 1], &audio_data_out,
+				   K_FOREVER);
+	zassert_equal(ret, 0, "Data RX function did not return successfully: ret %d", ret);
+	zassert_equal(audio_data_out.data_size, sizeof(data_in), "Data sizes differ");
+
+	for (int i = 0; i < sizeof(data_in); i++) {
+		zassert_equal(data_out[i], (uint8_t)(data_in[i] + TEST_CHAIN_LEN),
+			      "Data differs at byte %d", i);
+	}
+}
+
+/**
+ * @brief Time the round trip of blocks through the chain.
+ *
+ * @return Number of cycles per block.
+ */
+static uint32_t chain_benchmark(void)
+{
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < TEST_BENCHMARK_BLOCKS; i++) {
+		chain_block_test(i);
+	}
+
+	return (k_cycle_get_32() - start) / TEST_BENCHMARK_BLOCKS;
+}
+
+ZTEST(suite_audio_module_fused, test_fused_chain)
+{
+	chain_open(true, false);
+
+	for (int i = 0; i < 4; i++) {
+		chain_block_test(i);
+	}
+
+	zassert_equal(process_count, 4 * TEST_CHAIN_LEN, "Blocks processed %d times",
+		      process_count);
+	zassert_equal(in_place_count, 0, "Blocks processed in place %d times", in_place_count);
+
+	chain_close();
+}
+
+ZTEST(suite_audio_module_fused, test_fused_chain_in_place)
+{
+	chain_open(true, true);
+
+	for (int i = 0; i < 4; i++) {
+		chain_block_test(i);
+	}
+
+	/* The first module does not own the audio data sent to it, all the others do. */
+	zassert_equal(process_count, 4 * TEST_CHAIN_LEN, "Blocks processed %d times",
+		      process_count);
+	zassert_equal(in_place_count, 4 * (TEST_CHAIN_LEN - 1),
+		      "Blocks processed in place %d times", in_place_count);
+
+	chain_close();
+}
+
+ZTEST(suite_audio_module_fused, test_threaded_chain_in_place)
+{
+	chain_open(false, true);
+
+	for (int i = 0; i < 4; i++) {
+		chain_block_test(i);
+	}
+
+	/* Modules in their own threads are always given a new buffer. */
+	zassert_equal(in_place_count, 0, "Blocks processed in place %d times", in_place_count);
+
+	chain_close();
+}
+
+ZTEST(suite_audio_module_fused, test_fused_input_fails)
+{
+	int ret;
+	struct audio_module_handle handle = {0};
+	struct audio_module_description description = {
+		.name = "Input", .type = AUDIO_MODULE_TYPE_INPUT, .functions = &ft_increment};
+	struct audio_module_parameters parameters = {
+		.description = &description,
+		.thread = {.data_slab = &chain_slab, .data_size = TEST_MOD_DATA_SIZE, .fused = true}};
+
+	ret = audio_module_open(&parameters, (struct audio_module_configuration *)&chain_config,
+				TEST_INSTANCE_NAME, (struct audio_module_context *)&chain_contexts[0],
+				&handle);
+	zassert_equal(ret, -ECANCELED, "Open function did not return -ECANCELED (%d): ret %d",
+		      -ECANCELED, ret);
+}
+
+ZTEST(suite_audio_module_fused, test_fused_several_senders)
+{
+	int ret;
+	struct audio_module_parameters parameters = {
+		.description = &sink_description,
+		.thread = {.data_slab = &chain_slab, .data_size = TEST_MOD_DATA_SIZE, .fused = true}};
+
+	memset(&sink_handle, 0, sizeof(sink_handle));
+	atomic_clear(&sink_active);
+	atomic_clear(&sink_overlaps);
+	atomic_clear(&sink_count);
+
+	ret = audio_module_open(&parameters, (struct audio_module_configuration *)&chain_config,
+				TEST_INSTANCE_NAME, (struct audio_module_context *)&chain_contexts[0],
+				&sink_handle);
+	zassert_equal(ret, 0, "Open function did not return successfully: ret %d", ret);
+
+	ret = audio_module_start(&sink_handle);
+	zassert_equal(ret, 0, "Start function did not return successfully: ret %d", ret);
+
+	for (int i = 0; i < TEST_SENDER_CNT; i++) {
+		k_thread_create(&sender_threads[i], sender_stacks[i],
+				K_THREAD_STACK_SIZEOF(sender_stacks[i]), sender_thread, NULL, NULL,
+				NULL, K_PRIO_PREEMPT(TEST_MOD_THREAD_PRIORITY), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < TEST_SENDER_CNT; i++) {
+		ret = k_thread_join(&sender_threads[i], K_FOREVER);
+		zassert_equal(ret, 0, "Sender thread did not finish: ret %d", ret);
+	}
+
+	/* The senders run the fused module one at a time. */
+	zassert_equal(atomic_get(&sink_overlaps), 0, "Module run concurrently %d times",
+		      (int)atomic_get(&sink_overlaps));
+	zassert_equal(atomic_get(&sink_count), TEST_SENDER_CNT * TEST_SENDER_BLOCKS,
+		      "Blocks processed %d times", (int)atomic_get(&sink_count));
+
+	ret = audio_module_stop(&sink_handle);
+	zassert_equal(ret, 0, "Stop function did not return successfully: ret %d", ret);
+
+	ret = audio_module_close(&sink_handle);
+	zassert_equal(ret, 0, "Close function did not return successfully: ret %d", ret);
+}
+
+ZTEST(suite_audio_module_fused, test_fused_benchmark)
+{
+	uint32_t threaded;
+	uint32_t fused;
+	uint32_t in_place;
+
+	chain_open(false, false);
+	threaded = chain_benchmark();
+	chain_close();
+
+	chain_open(true, false);
+	fused = chain_benchmark();
+	chain_close();
+
+	chain_open(true, true);
+	in_place = chain_benchmark();
+	chain_close();
+
+	printk("Chain of %d modules: %u cycles per block threaded, %u fused, %u fused in place\n",
+	       TEST_CHAIN_LEN, threaded, fused, in_place);
+}
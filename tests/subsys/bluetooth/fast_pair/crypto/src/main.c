@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <zephyr/ztest.h>
 #include "fp_crypto.h"
 #include "fp_common.h"
@@ -77,6 +78,122 @@ ZTEST(suite_crypto, test_aes128_ecb)
 	zassert_mem_equal(result_buf, plaintext, sizeof(plaintext), "Invalid decryption result.");
 }
 
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_AES128_ECB_DECRYPT_CTX_SUPPORT)
+#define AES128_MULTI_KEY_CNT	10
+#define AES128_BENCHMARK_ROUNDS	100
+
+static void aes128_multi_keys_generate(uint8_t keys[][FP_CRYPTO_AES128_KEY_LEN], size_t key_cnt)
+{
+	for (size_t i = 0; i < key_cnt; i++) {
+		for (size_t j = 0; j < FP_CRYPTO_AES128_KEY_LEN; j++) {
+			keys[i][j] = (uint8_t)((i * 31) + (j * 7) + 1);
+		}
+	}
+}
+
+ZTEST(suite_crypto, test_aes128_ecb_decrypt_multi)
+{
+	static const uint8_t plaintext[] = {0xF3, 0x0F, 0x4E, 0x78, 0x6C, 0x59, 0xA7, 0xBB, 0xF3,
+					    0x87, 0x3B, 0x5A, 0x49, 0xBA, 0x97, 0xEA};
+
+	static const uint8_t key[] = {0xA0, 0xBA, 0xF0, 0xBB, 0x95, 0x1F, 0xF7, 0xB6, 0xCF, 0x5E,
+				      0x3F, 0x45, 0x61, 0xC3, 0x32, 0x1D};
+
+	static const uint8_t ciphertext[] = {0xAC, 0x9A, 0x16, 0xF0, 0x95, 0x3A, 0x3F, 0x22, 0x3D,
+					     0xD1, 0x0C, 0xF5, 0x36, 0xE0, 0x9E, 0x9C};
+
+	static const size_t matching_key_idx = 3;
+
+	uint8_t keys[AES128_MULTI_KEY_CNT][FP_CRYPTO_AES128_KEY_LEN];
+	struct fp_crypto_aes128_ecb_decrypt_ctx ctxs[AES128_MULTI_KEY_CNT];
+	uint8_t result_buf[AES128_MULTI_KEY_CNT * FP_CRYPTO_AES128_BLOCK_LEN];
+	uint8_t expected_buf[FP_CRYPTO_AES128_BLOCK_LEN];
+
+	aes128_multi_keys_generate(keys, ARRAY_SIZE(keys));
+	memcpy(keys[matching_key_idx], key, sizeof(key));
+
+	for (size_t i = 0; i < ARRAY_SIZE(ctxs); i++) {
+		zassert_ok(fp_crypto_aes128_ecb_decrypt_ctx_init(&ctxs[i], keys[i]),
+			   "Error during decryption context preparation.");
+	}
+
+	zassert_ok(fp_crypto_aes128_ecb_decrypt_multi(result_buf, ciphertext, ctxs,
+						      ARRAY_SIZE(ctxs)),
+		   "Error during value decryption.");
+
+	for (size_t i = 0; i < ARRAY_SIZE(ctxs); i++) {
+		const uint8_t *result = &result_buf[i * FP_CRYPTO_AES128_BLOCK_LEN];
+
+		zassert_ok(fp_crypto_aes128_ecb_decrypt(expected_buf, ciphertext, keys[i]),
+			   "Error during value decryption.");
+		zassert_mem_equal(result, expected_buf, sizeof(expected_buf),
+				  "Invalid decryption result.");
+
+		zassert_ok(fp_crypto_aes128_ecb_ctx_decrypt(expected_buf, ciphertext, &ctxs[i]),
+			   "Error during value decryption.");
+		zassert_mem_equal(result, expected_buf, sizeof(expected_buf),
+				  "Invalid decryption result.");
+	}
+
+	zassert_mem_equal(&result_buf[matching_key_idx * FP_CRYPTO_AES128_BLOCK_LEN], plaintext,
+			  sizeof(plaintext), "Invalid decryption result.");
+
+	for (size_t i = 0; i < ARRAY_SIZE(ctxs); i++) {
+		fp_crypto_aes128_ecb_decrypt_ctx_free(&ctxs[i]);
+	}
+}
+
+ZTEST(suite_crypto, test_aes128_ecb_decrypt_multi_benchmark)
+{
+	static const uint8_t ciphertext[] = {0xAC, 0x9A, 0x16, 0xF0, 0x95, 0x3A, 0x3F, 0x22, 0x3D,
+					     0xD1, 0x0C, 0xF5, 0x36, 0xE0, 0x9E, 0x9C};
+
+	uint8_t keys[AES128_MULTI_KEY_CNT][FP_CRYPTO_AES128_KEY_LEN];
+	struct fp_crypto_aes128_ecb_decrypt_ctx ctxs[AES128_MULTI_KEY_CNT];
+	uint8_t result_buf[AES128_MULTI_KEY_CNT * FP_CRYPTO_AES128_BLOCK_LEN];
+	uint32_t start;
+	uint32_t single_cycles;
+	uint32_t multi_cycles;
+
+	aes128_multi_keys_generate(keys, ARRAY_SIZE(keys));
+
+	for (size_t i = 0; i < ARRAY_SIZE(ctxs); i++) {
+		zassert_ok(fp_crypto_aes128_ecb_decrypt_ctx_init(&ctxs[i], keys[i]),
+			   "Error during decryption context preparation.");
+	}
+
+	/* Trial decryption with all of the keys, preparing every key for each decryption. */
+	start = k_cycle_get_32();
+	for (size_t round = 0; round < AES128_BENCHMARK_ROUNDS; round++) {
+		for (size_t i = 0; i < ARRAY_SIZE(keys); i++) {
+			zassert_ok(fp_crypto_aes128_ecb_decrypt(
+					   &result_buf[i * FP_CRYPTO_AES128_BLOCK_LEN],
+					   ciphertext, keys[i]),
+				   "Error during value decryption.");
+		}
+	}
+	single_cycles = k_cycle_get_32() - start;
+
+	/* Trial decryption with all of the keys, reusing the prepared decryption contexts. */
+	start = k_cycle_get_32();
+	for (size_t round = 0; round < AES128_BENCHMARK_ROUNDS; round++) {
+		zassert_ok(fp_crypto_aes128_ecb_decrypt_multi(result_buf, ciphertext, ctxs,
+							      ARRAY_SIZE(ctxs)),
+			   "Error during value decryption.");
+	}
+	multi_cycles = k_cycle_get_32() - start;
+
+	TC_PRINT("Trial decryption with %d keys: %u cycles per key, %u cycles per key with "
+		 "prepared contexts\n", AES128_MULTI_KEY_CNT,
+		 single_cycles / (AES128_BENCHMARK_ROUNDS * AES128_MULTI_KEY_CNT),
+		 multi_cycles / (AES128_BENCHMARK_ROUNDS * AES128_MULTI_KEY_CNT));
+
+	for (size_t i = 0; i < ARRAY_SIZE(ctxs); i++) {
+		fp_crypto_aes128_ecb_decrypt_ctx_free(&ctxs[i]);
+	}
+}
+#endif /* CONFIG_BT_FAST_PAIR_CRYPTO_AES128_ECB_DECRYPT_CTX_SUPPORT */
+
 ZTEST(suite_crypto, test_aes128_ctr)
 {
 	static const uint8_t plaintext[] = {0x53, 0x6F, 0x6D, 0x65, 0x6F, 0x6E, 0x65, 0x27, 0x73,
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdint.h>
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/mesh.h>
+#include <mesh/net.h>
+#include <mesh/rpl.h>
+
+#define CRPL		 CONFIG_BT_MESH_CRPL
+#define BENCHMARK_ROUNDS DIV_ROUND_UP(10000, CRPL)
+
+static bool rpl_check(uint16_t src, uint32_t seq, bool old_iv)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = src,
+		.seq = seq,
+		.old_iv = old_iv,
+		.net_if = BT_MESH_NET_IF_ADV,
+		.local_match = true,
+	};
+
+	return bt_mesh_rpl_check(&rx, NULL, false);
+}
+
+/* Unicast addresses as they are typically assigned, in steps of the element count */
+static uint16_t src_get(int i)
+{
+	return 0x0001 + i * 3;
+}
+
+static void rpl_fill(int count)
+{
+	for (int i = 0; i < count; i++) {
+		zassert_false(rpl_check(src_get(i), 1, false), "Source %d rejected", i);
+	}
+}
+
+static void rpl_test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_mesh_rpl_clear();
+}
+
+ZTEST(bt_mesh_rpl, test_replay)
+{
+	zassert_false(rpl_check(0x0001, 10, false));
+	zassert_true(rpl_check(0x0001, 10, false));
+	zassert_true(rpl_check(0x0001, 9, false));
+	zassert_false(rpl_check(0x0001, 11, false));
+
+	/* Messages on the old IV index are replays once the new IV index is used */
+	zassert_true(rpl_check(0x0001, 12, true));
+}
+
+ZTEST(bt_mesh_rpl, test_local)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = 0x0001,
+		.seq = 1,
+		.net_if = BT_MESH_NET_IF_LOCAL,
+		.local_match = true,
+	};
+
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false));
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false));
+
+	rx.net_if = BT_MESH_NET_IF_ADV;
+	rx.local_match = false;
+
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false));
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, false));
+	zassert_false(bt_mesh_rpl_check(&rx, NULL, true));
+	zassert_true(bt_mesh_rpl_check(&rx, NULL, true));
+}
+
+ZTEST(bt_mesh_rpl, test_match)
+{
+	struct bt_mesh_rpl *match = NULL;
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = 0x0002,
+		.seq = 5,
+		.net_if = BT_MESH_NET_IF_ADV,
+		.local_match = true,
+	};
+
+	zassert_false(bt_mesh_rpl_check(&rx, &match, false));
+	zassert_not_null(match);
+
+	/* The slot is not updated until the segmented message is complete */
+	zassert_false(rpl_check(0x0003, 1, false));
+	zassert_false(bt_mesh_rpl_check(&rx, &match, false));
+
+	bt_mesh_rpl_update(match, &rx);
+
+	zassert_equal(match->src, 0x0002);
+	zassert_equal(match->seq, 5);
+	zassert_true(rpl_check(0x0002, 5, false));
+	zassert_false(rpl_check(0x0002, 6, false));
+	zassert_true(rpl_check(0x0003, 1, false));
+}
+
+ZTEST(bt_mesh_rpl, test_full)
+{
+	rpl_fill(CRPL);
+
+	zassert_true(rpl_check(src_get(CRPL), 1, false));
+
+	for (int i = 0; i < CRPL; i++) {
+		zassert_true(rpl_check(src_get(i), 1, false), "Source %d not found", i);
+		zassert_false(rpl_check(src_get(i), 2, false), "Source %d not found", i);
+	}
+}
+
+ZTEST(bt_mesh_rpl, test_reset)
+{
+	rpl_fill(CRPL);
+
+	/* Entries are kept and flagged as old on the first IV index update */
+	bt_mesh_rpl_reset();
+
+	zassert_true(rpl_check(src_get(CRPL), 1, false));
+
+	for (int i = 0; i < CRPL; i++) {
+		zassert_true(rpl_check(src_get(i), 1, true), "Source %d not found", i);
+	}
+
+	/* Messages on the new IV index are accepted */
+	for (int i = 0; i < CRPL; i += 2) {
+		zassert_false(rpl_check(src_get(i), 1, false));
+	}
+
+	/* Entries that were not used on the new IV index are discarded on the next update */
+	bt_mesh_rpl_reset();
+
+	for (int i = 0; i < CRPL; i += 2) {
+		zassert_true(rpl_check(src_get(i), 1, true), "Source %d not found", i);
+	}
+
+	for (int i = 1; i < CRPL; i += 2) {
+		zassert_false(rpl_check(src_get(i), 1, true), "Source %d not discarded", i);
+	}
+}
+
+ZTEST(bt_mesh_rpl, test_clear)
+{
+	rpl_fill(CRPL);
+
+	bt_mesh_rpl_clear();
+
+	rpl_fill(CRPL);
+}
+
+/* The replay list used to be searched linearly, this is kept as reference for the benchmark */
+static struct bt_mesh_rpl linear_list[CRPL];
+
+static bool linear_check(uint16_t src, uint32_t seq)
+{
+	for (int i = 0; i < ARRAY_SIZE(linear_list); i++) {
+		struct bt_mesh_rpl *rpl = &linear_list[i];
+
+		if (!rpl->src || rpl->src == src) {
+			if (rpl->src && rpl->seq >= seq) {
+				return true;
+			}
+
+			rpl->src = src;
+			rpl->seq = seq;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+ZTEST(bt_mesh_rpl, test_benchmark)
+{
+	uint32_t start;
+	uint32_t indexed;
+	uint32_t linear;
+
+	memset(linear_list, 0, sizeof(linear_list));
+
+	for (int i = 0; i < CRPL; i++) {
+		(void)linear_check(src_get(i), 1);
+	}
+
+	rpl_fill(CRPL);
+
+	start = k_cycle_get_32();
+	for (uint32_t seq = 2; seq < BENCHMARK_ROUNDS + 2; seq++) {
+		for (int i = 0; i < CRPL; i++) {
+			(void)rpl_check(src_get(i), seq, false);
+		}
+	}
+	indexed = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (uint32_t seq = 2; seq < BENCHMARK_ROUNDS + 2; seq++) {
+		for (int i = 0; i < CRPL; i++) {
+			(void)linear_check(src_get(i), seq);
+		}
+	}
+	linear = k_cycle_get_32() - start;
+
+	printk("RPL of %d entries: %u cycles per check, %u cycles with a linear search\n", CRPL,
+	       indexed / (BENCHMARK_ROUNDS * CRPL), linear / (BENCHMARK_ROUNDS * CRPL));
+
+	for (int i = 0; i < CRPL; i++) {
+		zassert_true(rpl_check(src_get(i), BENCHMARK_ROUNDS + 1, false));
+	}
+}
+
+ZTEST_SUITE(bt_mesh_rpl, NULL, NULL, rpl_test_before, NULL, NULL);
@@ -80,3 +80,13 @@ int coap_request_send(struct download_client *client)
 
 	return 0;
 }
+
+bool coap_windowed(const struct download_client *client)
+{
+	return false;
+}
+
+size_t coap_window_next(struct download_client *client)
+{
+	return 0;
+}
@@ -32,5 +32,7 @@ int coap_get_recv_timeout(struct download_client *dl);
 int coap_initiate_retransmission(struct download_client *dl);
 int coap_parse(struct download_client *client, size_t len);
 int coap_request_send(struct download_client *client);
+bool coap_windowed(const struct download_client *client);
+size_t coap_window_next(struct download_client *client);
 
 #endif /* _DL_COAP_H_ */
@@ -18,3 +18,13 @@ int http_get_request_send(struct download_client *client)
 {
 	return 0;
 }
+
+bool http_pipelined(const struct download_client *client)
+{
+	return false;
+}
+
+size_t http_pipeline_next(struct download_client *client, size_t frag_len)
+{
+	return 0;
+}
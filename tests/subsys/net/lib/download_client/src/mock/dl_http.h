@@ -11,5 +11,7 @@
 
 int http_parse(struct download_client *client, size_t len);
 int http_get_request_send(struct download_client *client);
+bool http_pipelined(const struct download_client *client);
+size_t http_pipeline_next(struct download_client *client, size_t frag_len);
 
 #endif /* _DL_HTTP_H_ */
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket_offload.h>
+
+#include <zephyr/ztest.h>
+#include <download_client.h>
+
+#include "mock/coap_server.h"
+#include "mock/http_server.h"
+#include "mock/socket.h"
+
+#define PIPELINE_DEPTH	CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE_DEPTH
+#define FRAG_SIZE	CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE
+#define HTTP_FILE_SIZE	(32 * 1024 + 100)
+#define HTTP_FILE_URL	"http://example.com/file.bin"
+
+#define WINDOW_SIZE	CONFIG_DOWNLOAD_CLIENT_COAP_WINDOW_SIZE
+#define BLOCK_SIZE	(16 << CONFIG_DOWNLOAD_CLIENT_COAP_BLOCK_SIZE)
+#define COAP_FILE_SIZE	(16 * 1024 + 100)
+#define COAP_FILE_BLOCKS DIV_ROUND_UP(COAP_FILE_SIZE, BLOCK_SIZE)
+#define COAP_FILE_URL	"coap://example.com/file.bin"
+
+static struct download_client client;
+static bool client_initialized;
+static K_SEM_DEFINE(done_sem, 0, 1);
+static K_SEM_DEFINE(closed_sem, 0, 1);
+static size_t received;
+static int error;
+static bool content_ok;
+
+static struct download_client_cfg config = {
+	.pdn_id = 0,
+	.frag_size_override = 0,
+};
+
+static int download_client_callback(const struct download_client_evt *event)
+{
+	switch (event->id) {
+	case DOWNLOAD_CLIENT_EVT_FRAGMENT:
+		for (size_t i = 0; i < event->fragment.len; i++) {
+			if (((uint8_t *)event->fragment.buf)[i] != mock_file_byte(received + i)) {
+				content_ok = false;
+			}
+		}
+		received += event->fragment.len;
+		break;
+	case DOWNLOAD_CLIENT_EVT_ERROR:
+		error = event->error;
+		k_sem_give(&done_sem);
+		/* Stop the download */
+		return -1;
+	case DOWNLOAD_CLIENT_EVT_DONE:
+		k_sem_give(&done_sem);
+		break;
+	case DOWNLOAD_CLIENT_EVT_CLOSED:
+		k_sem_give(&closed_sem);
+		break;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static void *download_client_setup(void)
+{
+	int err;
+
+	/* The client is shared by the test suites */
+	if (!client_initialized) {
+		err = download_client_init(&client, download_client_callback);
+		zassert_ok(err);
+		client_initialized = true;
+	}
+
+	return NULL;
+}
+
+static void download_state_reset(void)
+{
+	received = 0;
+	error = 0;
+	content_ok = true;
+	k_sem_reset(&done_sem);
+	k_sem_reset(&closed_sem);
+}
+
+static void download_client_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	config.frag_size_override = 0;
+	download_state_reset();
+}
+
+/* Download the file from the mock server starting at the given offset
+ * and return the time it took, in ms.
+ */
+static uint32_t download(const char *url, size_t file_size, size_t from)
+{
+	int64_t start;
+	int64_t elapsed;
+	int err;
+
+	received = from;
+
+	start = k_uptime_get();
+
+	err = download_client_get(&client, url, &config, NULL, from);
+	zassert_ok(err);
+
+	err = k_sem_take(&done_sem, K_SECONDS(300));
+	zassert_ok(err, "Download timed out");
+	elapsed = k_uptime_get() - start;
+
+	err = k_sem_take(&closed_sem, K_SECONDS(1));
+	zassert_ok(err);
+
+	zassert_equal(error, 0, "Download failed, error %d", error);
+	zassert_equal(received, file_size);
+	zassert_true(content_ok, "Unexpected file content");
+
+	return elapsed;
+}
+
+static uint32_t http_download(size_t file_size, uint32_t rtt_ms, size_t from)
+{
+	mock_http_server_init(file_size, rtt_ms);
+
+	return download(HTTP_FILE_URL, file_size, from);
+}
+
+static uint32_t coap_download(size_t file_size, uint32_t rtt_ms, enum mock_coap_server_mode mode)
+{
+	mock_coap_server_init(file_size, rtt_ms, mode);
+
+	return download(COAP_FILE_URL, file_size, 0);
+}
+
+static size_t frag_size(void)
+{
+	return config.frag_size_override ? config.frag_size_override : FRAG_SIZE;
+}
+
+ZTEST(download_client_http, test_download)
+{
+	struct mock_http_server_stats stats;
+
+	(void)http_download(HTTP_FILE_SIZE, 50, 0);
+
+	mock_http_server_stats_get(&stats);
+	zassert_equal(stats.requests, DIV_ROUND_UP(HTTP_FILE_SIZE, frag_size()));
+	zassert_equal(stats.max_pending, PIPELINE_DEPTH);
+}
+
+ZTEST(download_client_http, test_download_from_offset)
+{
+	struct mock_http_server_stats stats;
+
+	(void)http_download(HTTP_FILE_SIZE, 50, 1500);
+
+	mock_http_server_stats_get(&stats);
+	zassert_equal(stats.requests, DIV_ROUND_UP(HTTP_FILE_SIZE - 1500, frag_size()));
+}
+
+ZTEST(download_client_http, test_download_frag_size_override)
+{
+	struct mock_http_server_stats stats;
+
+	/* Responses are not aligned with the buffer */
+	config.frag_size_override = 700;
+
+	(void)http_download(HTTP_FILE_SIZE, 50, 0);
+
+	mock_http_server_stats_get(&stats);
+	zassert_equal(stats.requests, DIV_ROUND_UP(HTTP_FILE_SIZE, frag_size()));
+	zassert_equal(stats.max_pending, PIPELINE_DEPTH);
+}
+
+ZTEST(download_client_http, test_download_small_file)
+{
+	/* The file is smaller than the fragments that are requested */
+	(void)http_download(100, 50, 0);
+}
+
+ZTEST(download_client_http, test_throughput)
+{
+	static const uint32_t rtts_ms[] = {20, 100, 300};
+	size_t frags = DIV_ROUND_UP(HTTP_FILE_SIZE, frag_size());
+
+	for (size_t i = 0; i < ARRAY_SIZE(rtts_ms); i++) {
+		uint32_t elapsed = http_download(HTTP_FILE_SIZE, rtts_ms[i], 0);
+
+		printk("RTT %u ms: %u bytes/s with %d pipelined requests\n", rtts_ms[i],
+		       (uint32_t)(HTTP_FILE_SIZE * 1000ULL / MAX(elapsed, 1)), PIPELINE_DEPTH);
+
+		/* One round trip for every group of pipelined requests,
+		 * and one more to learn the file size from the first response.
+		 */
+		zassert_true(elapsed <= (DIV_ROUND_UP(frags, PIPELINE_DEPTH) + 1) * rtts_ms[i],
+			     "Download took %u ms", elapsed);
+
+		download_state_reset();
+	}
+}
+
+ZTEST(download_client_coap, test_download)
+{
+	struct mock_coap_server_stats stats;
+
+	(void)coap_download(COAP_FILE_SIZE, 50, MOCK_COAP_SERVER_IN_ORDER);
+
+	mock_coap_server_stats_get(&stats);
+	zassert_equal(stats.requests, COAP_FILE_BLOCKS);
+	zassert_equal(stats.retransmissions, 0);
+}
+
+ZTEST(download_client_coap, test_download_reordered)
+{
+	struct mock_coap_server_stats stats;
+
+	(void)coap_download(COAP_FILE_SIZE, 50, MOCK_COAP_SERVER_REORDER);
+
+	mock_coap_server_stats_get(&stats);
+	zassert_equal(stats.requests, COAP_FILE_BLOCKS);
+	zassert_equal(stats.retransmissions, 0);
+}
+
+ZTEST(download_client_coap, test_download_lossy)
+{
+	struct mock_coap_server_stats stats;
+
+	(void)coap_download(COAP_FILE_SIZE, 50, MOCK_COAP_SERVER_LOSSY);
+
+	/* Only the lost blocks are requested again */
+	mock_coap_server_stats_get(&stats);
+	for (size_t i = 0; i < COAP_FILE_BLOCKS; i++) {
+		zassert_equal(stats.blocks[i], i % 5 == 1 ? 2 : 1, "Block %d requested %d times",
+			      i, stats.blocks[i]);
+	}
+}
+
+ZTEST(download_client_coap, test_download_small_file)
+{
+	/* The file fits in a single block */
+	(void)coap_download(100, 50, MOCK_COAP_SERVER_IN_ORDER);
+}
+
+ZTEST(download_client_coap, test_throughput)
+{
+	static const uint32_t rtts_ms[] = {20, 100, 300};
+
+	for (size_t i = 0; i < ARRAY_SIZE(rtts_ms); i++) {
+		uint32_t elapsed = coap_download(COAP_FILE_SIZE, rtts_ms[i],
+						 MOCK_COAP_SERVER_IN_ORDER);
+
+		printk("RTT %u ms: %u bytes/s with a window of %d blocks\n", rtts_ms[i],
+		       (uint32_t)(COAP_FILE_SIZE * 1000ULL / MAX(elapsed, 1)), WINDOW_SIZE);
+
+		/* One round trip for every window of blocks,
+		 * and one more to learn the file size from the first block.
+		 */
+		zassert_true(elapsed <= (DIV_ROUND_UP(COAP_FILE_BLOCKS, WINDOW_SIZE) + 1) * rtts_ms[i],
+			     "Download took %u ms", elapsed);
+
+		download_state_reset();
+	}
+}
+
+ZTEST_SUITE(download_client_http, NULL, download_client_setup, download_client_before, NULL,
+	    NULL);
+ZTEST_SUITE(download_client_coap, NULL, download_client_setup, download_client_before, NULL,
+	    NULL);
+
+#define TEST_SOCKET_PRIO 40
+NET_SOCKET_REGISTER(mock_socket, TEST_SOCKET_PRIO, AF_UNSPEC, mock_socket_is_supported,
+		    mock_socket_create);
+NET_DEVICE_OFFLOAD_INIT(mock_socket, "mock_socket", mock_nrf_modem_lib_socket_offload_init, NULL,
+			&mock_socket_iface_data, NULL, 0, &mock_if_api, 1280);
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <errno.h>
+#include <string.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/ztest.h>
+
+#include "mock/coap_server.h"
+#include "mock/socket.h"
+
+#define RESPONSE_QUEUE_SIZE 32
+#define RESPONSE_SIZE	    600
+
+struct response {
+	/* Uptime when the response reaches the client */
+	int64_t ready;
+	uint8_t buf[RESPONSE_SIZE];
+	uint16_t len;
+};
+
+static struct {
+	size_t file_size;
+	uint32_t rtt_ms;
+	enum mock_coap_server_mode mode;
+	struct response queue[RESPONSE_QUEUE_SIZE];
+	size_t count;
+	struct mock_coap_server_stats stats;
+} server;
+
+static void coap_server_send(const uint8_t *data, size_t len)
+{
+	int err;
+	int block;
+	uint32_t num;
+	size_t off;
+	size_t size;
+	bool more;
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint8_t tkl;
+	struct coap_packet request;
+	struct coap_packet response;
+	struct response *rsp;
+
+	err = coap_packet_parse(&request, (uint8_t *)data, len, NULL, 0);
+	zassert_ok(err, "Invalid CoAP request");
+
+	block = coap_get_option_int(&request, COAP_OPTION_BLOCK2);
+	zassert_true(block >= 0, "No Block2 option in request");
+
+	num = GET_BLOCK_NUM(block);
+	off = num * coap_block_size_to_bytes(GET_BLOCK_SIZE(block));
+	zassert_true(off < server.file_size, "Request for block %d past the end of the file", num);
+
+	size = MIN(coap_block_size_to_bytes(GET_BLOCK_SIZE(block)), server.file_size - off);
+	more = off + size < server.file_size;
+
+	zassert_true(num < MOCK_COAP_MAX_BLOCKS);
+
+	server.stats.requests++;
+	if (server.stats.blocks[num]++) {
+		server.stats.retransmissions++;
+	}
+
+	if (server.mode == MOCK_COAP_SERVER_LOSSY && num % 5 == 1 && server.stats.blocks[num] == 1) {
+		/* The first response to every fifth block is lost */
+		return;
+	}
+
+	zassert_true(server.count < RESPONSE_QUEUE_SIZE);
+	rsp = &server.queue[server.count];
+
+	tkl = coap_header_get_token(&request, token);
+	err = coap_packet_init(&response, rsp->buf, sizeof(rsp->buf), COAP_VERSION_1,
+			       COAP_TYPE_ACK, tkl, token, COAP_RESPONSE_CODE_CONTENT,
+			       coap_header_get_id(&request));
+	zassert_ok(err);
+
+	err = coap_append_option_int(&response, COAP_OPTION_BLOCK2,
+				     (num << 4) | (more << 3) | GET_BLOCK_SIZE(block));
+	zassert_ok(err);
+
+	err = coap_append_option_int(&response, COAP_OPTION_SIZE2, server.file_size);
+	zassert_ok(err);
+
+	err = coap_packet_append_payload_marker(&response);
+	zassert_ok(err);
+
+	for (size_t i = 0; i < size; i++) {
+		uint8_t byte = mock_file_byte(off + i);
+
+		err = coap_packet_append_payload(&response, &byte, 1);
+		zassert_ok(err);
+	}
+
+	rsp->len = response.offset;
+	rsp->ready = k_uptime_get() + server.rtt_ms;
+
+	if (server.mode == MOCK_COAP_SERVER_REORDER && num % 2 == 1) {
+		/* Odd blocks arrive after the next even block */
+		rsp->ready += 2;
+	}
+
+	server.count++;
+}
+
+static ssize_t coap_server_recv(uint8_t *buf, size_t len, int32_t timeout_ms)
+{
+	struct response *rsp = NULL;
+	int64_t now = k_uptime_get();
+
+	/* Find the first response to arrive */
+	for (size_t i = 0; i < server.count; i++) {
+		if (!rsp || server.queue[i].ready < rsp->ready) {
+			rsp = &server.queue[i];
+		}
+	}
+
+	if (!rsp || (timeout_ms > 0 && rsp->ready > now + timeout_ms)) {
+		k_sleep(K_MSEC(timeout_ms));
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (rsp->ready > now) {
+		k_sleep(K_MSEC(rsp->ready - now));
+	}
+
+	zassert_true(rsp->len <= len);
+	len = rsp->len;
+	memcpy(buf, rsp->buf, len);
+
+	*rsp = server.queue[--server.count];
+
+	return len;
+}
+
+static const struct mock_server coap_server = {
+	.send = coap_server_send,
+	.recv = coap_server_recv,
+};
+
+void mock_coap_server_init(size_t file_size, uint32_t rtt_ms, enum mock_coap_server_mode mode)
+{
+	memset(&server, 0, sizeof(server));
+	server.file_size = file_size;
+	server.rtt_ms = rtt_ms;
+	server.mode = mode;
+
+	mock_socket_server_set(&coap_server);
+}
+
+void mock_coap_server_stats_get(struct mock_coap_server_stats *stats)
+{
+	*stats = server.stats;
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _COAP_SERVER_H_
+#define _COAP_SERVER_H_
+
+#include <zephyr/kernel.h>
+
+#define MOCK_COAP_MAX_BLOCKS 64
+
+enum mock_coap_server_mode {
+	/* Responses arrive in the order the requests were sent */
+	MOCK_COAP_SERVER_IN_ORDER,
+	/* Responses to odd blocks arrive after the response to the next block */
+	MOCK_COAP_SERVER_REORDER,
+	/* The first response to every fifth block is lost */
+	MOCK_COAP_SERVER_LOSSY,
+};
+
+struct mock_coap_server_stats {
+	/* Number of block requests received */
+	int requests;
+	/* Number of requests for a block that was already requested */
+	int retransmissions;
+	/* Number of requests received for each block */
+	uint8_t blocks[MOCK_COAP_MAX_BLOCKS];
+};
+
+/**
+ * @brief Serve a file over the mock socket.
+ *
+ * The mock socket behaves as a CoAP server that answers Block2 requests with
+ * piggybacked responses. The response to a request can be read one round trip
+ * time after the request was sent.
+ *
+ * @param file_size Size of the file, its content is given by @ref mock_file_byte.
+ * @param rtt_ms Round trip time, in milliseconds.
+ * @param mode How the responses are delivered.
+ */
+void mock_coap_server_init(size_t file_size, uint32_t rtt_ms, enum mock_coap_server_mode mode);
+
+void mock_coap_server_stats_get(struct mock_coap_server_stats *stats);
+
+#endif /* _COAP_SERVER_H_ */
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+
+#include "mock/http_server.h"
+#include "mock/socket.h"
+
+#define RESPONSE_QUEUE_SIZE 16
+#define RESPONSE_HEADER	    "HTTP/1.1 206 Partial Content\r\n" \
+			    "Content-Range: bytes %u-%u/%u\r\n" \
+			    "Content-Length: %u\r\n" \
+			    "\r\n"
+
+struct response {
+	/* Uptime when the response reaches the client */
+	int64_t ready;
+	char header[128];
+	size_t header_len;
+	/* Range of the file in the body */
+	size_t start;
+	size_t end;
+	/* Number of bytes read */
+	size_t pos;
+};
+
+static struct {
+	size_t file_size;
+	uint32_t rtt_ms;
+	char request[512];
+	size_t request_len;
+	struct response queue[RESPONSE_QUEUE_SIZE];
+	size_t head;
+	size_t count;
+	struct mock_http_server_stats stats;
+} server;
+
+static void request_handle(const char *request)
+{
+	struct response *rsp;
+	unsigned int start;
+	unsigned int end;
+	const char *range;
+
+	range = strstr(request, "Range: bytes=");
+	zassert_not_null(range, "Not a range request");
+	zassert_equal(sscanf(range, "Range: bytes=%u-%u", &start, &end), 2);
+	zassert_true(start <= end && start < server.file_size, "Invalid range %u-%u", start, end);
+	zassert_true(server.count < RESPONSE_QUEUE_SIZE);
+
+	/* The range is truncated at the end of the file */
+	end = MIN(end, server.file_size - 1);
+
+	rsp = &server.queue[(server.head + server.count) % RESPONSE_QUEUE_SIZE];
+	rsp->ready = k_uptime_get() + server.rtt_ms;
+	rsp->header_len = snprintf(rsp->header, sizeof(rsp->header), RESPONSE_HEADER, start, end,
+				   (unsigned int)server.file_size, end - start + 1);
+	rsp->start = start;
+	rsp->end = end;
+	rsp->pos = 0;
+
+	server.count++;
+	server.stats.requests++;
+	server.stats.max_pending = MAX(server.stats.max_pending, server.count);
+}
+
+static size_t response_read(struct response *rsp, uint8_t *buf, size_t len)
+{
+	size_t total = rsp->header_len + rsp->end - rsp->start + 1;
+	size_t n = MIN(len, total - rsp->pos);
+
+	for (size_t i = 0; i < n; i++, rsp->pos++) {
+		if (rsp->pos < rsp->header_len) {
+			buf[i] = rsp->header[rsp->pos];
+		} else {
+			buf[i] = mock_file_byte(rsp->start + rsp->pos - rsp->header_len);
+		}
+	}
+
+	return n;
+}
+
+static ssize_t http_server_recv(uint8_t *buf, size_t len, int32_t timeout_ms)
+{
+	struct response *rsp;
+	size_t read = 0;
+	int64_t now = k_uptime_get();
+
+	if (server.count == 0) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	/* Wait for the first response to arrive */
+	rsp = &server.queue[server.head];
+	if (rsp->ready > now) {
+		k_sleep(K_MSEC(rsp->ready - now));
+		now = rsp->ready;
+	}
+
+	/* Return all the data that has arrived */
+	while (read < len && server.count > 0 && rsp->ready <= now) {
+		read += response_read(rsp, buf + read, len - read);
+
+		if (rsp->pos == rsp->header_len + rsp->end - rsp->start + 1) {
+			server.head = (server.head + 1) % RESPONSE_QUEUE_SIZE;
+			server.count--;
+			rsp = &server.queue[server.head];
+		}
+	}
+
+	return read;
+}
+
+static void http_server_send(const uint8_t *buf, size_t len)
+{
+	char *end;
+
+	zassert_true(server.request_len + len < sizeof(server.request), "Request too long");
+	memcpy(server.request + server.request_len, buf, len);
+	server.request_len += len;
+	server.request[server.request_len] = '\0';
+
+	/* Handle all the complete requests */
+	while ((end = strstr(server.request, "\r\n\r\n")) != NULL) {
+		size_t request_len = end + strlen("\r\n\r\n") - server.request;
+
+		*end = '\0';
+		request_handle(server.request);
+
+		server.request_len -= request_len;
+		memmove(server.request, server.request + request_len, server.request_len + 1);
+	}
+}
+
+static const struct mock_server http_server = {
+	.send = http_server_send,
+	.recv = http_server_recv,
+};
+
+void mock_http_server_init(size_t file_size, uint32_t rtt_ms)
+{
+	memset(&server, 0, sizeof(server));
+	server.file_size = file_size;
+	server.rtt_ms = rtt_ms;
+
+	mock_socket_server_set(&http_server);
+}
+
+void mock_http_server_stats_get(struct mock_http_server_stats *stats)
+{
+	*stats = server.stats;
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _HTTP_SERVER_H_
+#define _HTTP_SERVER_H_
+
+#include <zephyr/kernel.h>
+
+struct mock_http_server_stats {
+	/* Number of range requests received */
+	int requests;
+	/* Largest number of requests whose response was not fully read */
+	int max_pending;
+};
+
+/**
+ * @brief Serve a file over the mock socket.
+ *
+ * The mock socket behaves as an HTTP/1.1 server that supports range requests and
+ * pipelining. The response to a request can be read one round trip time after the
+ * request was sent.
+ *
+ * @param file_size Size of the file, its content is given by @ref mock_file_byte.
+ * @param rtt_ms Round trip time, in milliseconds.
+ */
+void mock_http_server_init(size_t file_size, uint32_t rtt_ms);
+
+void mock_http_server_stats_get(struct mock_http_server_stats *stats);
+
+#endif /* _HTTP_SERVER_H_ */
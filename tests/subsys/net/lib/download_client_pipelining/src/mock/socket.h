@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SOCKET_H_
+#define _SOCKET_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/offloaded_netdev.h>
+
+extern struct mock_socket_iface_data mock_socket_iface_data;
+extern struct offloaded_if_api mock_if_api;
+
+int mock_nrf_modem_lib_socket_offload_init(const struct device *arg);
+bool mock_socket_is_supported(int family, int type, int proto);
+int mock_socket_create(int family, int type, int proto);
+
+/** Server at the other end of the mock socket. */
+struct mock_server {
+	/** Handle data sent by the client. */
+	void (*send)(const uint8_t *buf, size_t len);
+	/**
+	 * Read data that has arrived at the client.
+	 *
+	 * @param timeout_ms Receive timeout set by the client, or 0 to wait forever.
+	 *
+	 * @return Number of bytes read, or -1 and errno set on error.
+	 */
+	ssize_t (*recv)(uint8_t *buf, size_t len, int32_t timeout_ms);
+};
+
+/**
+ * @brief Connect the mock socket to a server.
+ *
+ * Data written to the socket is passed to the server, and data read from the socket
+ * is read from it.
+ */
+void mock_socket_server_set(const struct mock_server *server);
+
+/** @brief Content of the files served by the mock servers. */
+uint8_t mock_file_byte(size_t off);
+
+#endif /* _SOCKET_H_ */
@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_codec.h>
+#include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_json_writer.h"
+#include "nrf_cloud_mem.h"
+
+#define OUT_BUF_SIZE 1024
+
+static char out_buf[OUT_BUF_SIZE];
+
+/* Compare the output of the writer with that of cJSON_PrintUnformatted() */
+static void assert_identical(cJSON *const obj, const char *const written)
+{
+	char *printed = cJSON_PrintUnformatted(obj);
+
+	zassert_not_null(printed, "cJSON print failed");
+	zassert_equal(strcmp(printed, written), 0,
+		      "Output differs:\ncJSON:  %s\nwriter: %s", printed, written);
+
+	cJSON_free(printed);
+	cJSON_Delete(obj);
+}
+
+/* Write the members added by fn into a root object and return the writer result */
+#define MEMBERS_WRITE(fn, data, buf, size)				\
+	({								\
+		struct nrf_cloud_json_writer wr;			\
+		int ret;						\
+									\
+		nrf_cloud_json_writer_init(&wr, (buf), (size));		\
+		(void)nrf_cloud_json_obj_start(&wr, NULL);		\
+		ret = fn((data), &wr);					\
+		(void)nrf_cloud_json_obj_end(&wr);			\
+		(ret == 0) ? nrf_cloud_json_writer_finish(&wr) : ret;	\
+	})
+
+static void run_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)nrf_cloud_codec_init(NULL);
+	memset(out_buf, 0, sizeof(out_buf));
+}
+
+ZTEST_SUITE(nrf_cloud_codec_test, NULL, NULL, run_before, NULL, NULL);
+
+/* Verify that numbers are formatted exactly like cJSON does */
+ZTEST(nrf_cloud_codec_test, test_writer_numbers)
+{
+	static const double nums[] = {
+		0.0, -0.0, 1.0, -1.0, 0.1, 1.5, -2.25, 1.0 / 3.0, 1e-7, 1e300, -1e-300,
+		INT_MAX, (double)INT_MAX + 1.0, INT_MIN, (double)INT_MIN - 1.0,
+		1700000000123.0, 63.421376, 10.437035, 0.10000000149011612,
+		(float)63.421376, (float)12.5, 123456789012345678.0, NAN, INFINITY, -INFINITY,
+	};
+	struct nrf_cloud_json_writer wr;
+	cJSON *arr = cJSON_CreateArray();
+
+	nrf_cloud_json_writer_init(&wr, out_buf, sizeof(out_buf));
+	(void)nrf_cloud_json_arr_start(&wr, NULL);
+	for (size_t i = 0; i < ARRAY_SIZE(nums); i++) {
+		cJSON_AddItemToArray(arr, cJSON_CreateNumber(nums[i]));
+		zassert_ok(nrf_cloud_json_num_add(&wr, NULL, nums[i]));
+	}
+	(void)nrf_cloud_json_arr_end(&wr);
+
+	zassert_true(nrf_cloud_json_writer_finish(&wr) > 0);
+	assert_identical(arr, out_buf);
+}
+
+/* Verify that strings and keys are escaped exactly like cJSON does */
+ZTEST(nrf_cloud_codec_test, test_writer_strings)
+{
+	char all_chars[256];
+	struct nrf_cloud_json_writer wr;
+	cJSON *obj = cJSON_CreateObject();
+
+	for (size_t i = 0; i < (sizeof(all_chars) - 1); i++) {
+		all_chars[i] = (char)(i + 1);
+	}
+	all_chars[sizeof(all_chars) - 1] = '\0';
+
+	cJSON_AddStringToObject(obj, "all", all_chars);
+	cJSON_AddStringToObject(obj, "k\"e\\y\n", "");
+	cJSON_AddArrayToObject(obj, "empty_arr");
+	cJSON_AddObjectToObject(obj, "empty_obj");
+
+	nrf_cloud_json_writer_init(&wr, out_buf, sizeof(out_buf));
+	(void)nrf_cloud_json_obj_start(&wr, NULL);
+	(void)nrf_cloud_json_str_add(&wr, "all", all_chars);
+	(void)nrf_cloud_json_str_add(&wr, "k\"e\\y\n", "");
+	(void)nrf_cloud_json_arr_start(&wr, "empty_arr");
+	(void)nrf_cloud_json_arr_end(&wr);
+	(void)nrf_cloud_json_obj_start(&wr, "empty_obj");
+	(void)nrf_cloud_json_obj_end(&wr);
+	(void)nrf_cloud_json_obj_end(&wr);
+
+	zassert_true(nrf_cloud_json_writer_finish(&wr) > 0);
+	assert_identical(obj, out_buf);
+}
+
+/* Verify that the writer measures the output and reports a too small buffer */
+ZTEST(nrf_cloud_codec_test, test_writer_buffer_size)
+{
+	const struct nrf_cloud_sensor_data sensor = {
+		.type = NRF_CLOUD_SENSOR_TEMP,
+		.data.ptr = "24.5",
+		.data.len = 4,
+		.ts_ms = 1700000000123
+	};
+	struct nrf_cloud_json_writer wr;
+	int len;
+
+	nrf_cloud_json_writer_init(&wr, NULL, 0);
+	zassert_ok(nrf_cloud_sensor_data_json_write(&sensor, &wr));
+	len = nrf_cloud_json_writer_finish(&wr);
+	zassert_true(len > 0);
+
+	/* No room for the NULL terminator */
+	nrf_cloud_json_writer_init(&wr, out_buf, len);
+	zassert_ok(nrf_cloud_sensor_data_json_write(&sensor, &wr));
+	zassert_equal(nrf_cloud_json_writer_finish(&wr), -ENOMEM);
+	zassert_equal(strlen(out_buf), len - 1);
+
+	nrf_cloud_json_writer_init(&wr, out_buf, len + 1);
+	zassert_ok(nrf_cloud_sensor_data_json_write(&sensor, &wr));
+	zassert_equal(nrf_cloud_json_writer_finish(&wr), len);
+	zassert_equal(strlen(out_buf), len);
+}
+
+/* Verify that misuse of the writer is reported */
+ZTEST(nrf_cloud_codec_test, test_writer_invalid_use)
+{
+	struct nrf_cloud_json_writer wr;
+
+	nrf_cloud_json_writer_init(&wr, out_buf, sizeof(out_buf));
+	(void)nrf_cloud_json_obj_start(&wr, NULL);
+	zassert_equal(nrf_cloud_json_num_add(&wr, NULL, 1), -EINVAL, "Object member without key");
+
+	nrf_cloud_json_writer_init(&wr, out_buf, sizeof(out_buf));
+	(void)nrf_cloud_json_arr_start(&wr, NULL);
+	zassert_equal(nrf_cloud_json_num_add(&wr, "key", 1), -EINVAL, "Array element with key");
+
+	nrf_cloud_json_writer_init(&wr, out_buf, sizeof(out_buf));
+	(void)nrf_cloud_json_arr_start(&wr, NULL);
+	zassert_equal(nrf_cloud_json_obj_end(&wr), -EINVAL, "Mismatched end");
+
+	nrf_cloud_json_writer_init(&wr, out_buf, sizeof(out_buf));
+	(void)nrf_cloud_json_obj_start(&wr, NULL);
+	zassert_equal(nrf_cloud_json_writer_finish(&wr), -EINVAL, "Unbalanced object");
+}
+
+/* Verify that the sensor data message matches the cJSON encoding */
+ZTEST(nrf_cloud_codec_test, test_sensor_data)
+{
+	const struct nrf_cloud_sensor_data sensors[] = {
+		{
+			.type = NRF_CLOUD_SENSOR_TEMP,
+			.data.ptr = "24.5",
+			.data.len = 4,
+			.ts_ms = 1700000000123
+		},
+		{
+			.type = NRF_CLOUD_LOG,
+			.data.ptr = "line \"one\"\r\n\tline\\two",
+			.data.len = 21,
+			.ts_ms = NRF_CLOUD_NO_TIMESTAMP
+		},
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(sensors); i++) {
+		const struct nrf_cloud_sensor_data *sensor = &sensors[i];
+		struct nrf_cloud_data output;
+		cJSON *obj = cJSON_CreateObject();
+
+		cJSON_AddStringToObject(obj, NRF_CLOUD_JSON_APPID_KEY,
+					i ? NRF_CLOUD_JSON_APPID_VAL_LOG :
+					    NRF_CLOUD_JSON_APPID_VAL_TEMP);
+		cJSON_AddStringToObject(obj, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
+		cJSON_AddStringToObject(obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+					NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+		if (sensor->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
+			cJSON_AddNumberToObject(obj, NRF_CLOUD_MSG_TIMESTAMP_KEY, sensor->ts_ms);
+		}
+
+		zassert_ok(nrf_cloud_sensor_data_encode(sensor, &output));
+		zassert_equal(output.len, strlen(output.ptr));
+		assert_identical(obj, output.ptr);
+		nrf_cloud_free((void *)output.ptr);
+	}
+}
+
+/* Verify that GNSS messages match the cJSON encoding */
+ZTEST(nrf_cloud_codec_test, test_gnss_msg)
+{
+	struct nrf_modem_gnss_pvt_data_frame mdm_pvt = {
+		.latitude = 63.421376,
+		.longitude = 10.437035,
+		.altitude = 45.3f,
+		.accuracy = 12.7f,
+		.speed = 0.35f,
+		.heading = 271.0f
+	};
+	struct nrf_modem_gnss_nmea_data_frame mdm_nmea = {
+		.nmea_str = "$GPGGA,165138.00,6325.28271,N,01026.22210,E,1,08,1.01,45.3,M,39.4,M,,*6B"
+	};
+	struct nrf_cloud_gnss_data gnss[] = {
+		{
+			.type = NRF_CLOUD_GNSS_TYPE_PVT,
+			.ts_ms = 1700000000123,
+			.pvt = {
+				.lat = 63.421376,
+				.lon = 10.437035,
+				.accuracy = 12.7f,
+			}
+		},
+		{
+			.type = NRF_CLOUD_GNSS_TYPE_PVT,
+			.pvt = {
+				.lat = -33.8688,
+				.lon = 151.2093,
+				.accuracy = 3.0f,
+				.alt = 58.1f,
+				.has_alt = 1,
+				.speed = 1.25f,
+				.has_speed = 1,
+				.heading = 90.5f,
+				.has_heading = 1
+			}
+		},
+		{
+			.type = NRF_CLOUD_GNSS_TYPE_NMEA,
+			.ts_ms = 1700000000123,
+			.nmea.sentence = "$GPGGA,165138.00,6325.28271,N,01026.22210,E,1,08,1.01,45.3,M,39.4,M,,*6B"
+		},
+		{
+			.type = NRF_CLOUD_GNSS_TYPE_MODEM_PVT,
+			.ts_ms = 1700000000123,
+			.mdm_pvt = &mdm_pvt
+		},
+		{
+			.type = NRF_CLOUD_GNSS_TYPE_MODEM_NMEA,
+			.mdm_nmea = &mdm_nmea
+		},
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(gnss); i++) {
+		cJSON *obj = cJSON_CreateObject();
+
+		zassert_ok(nrf_cloud_gnss_msg_json_encode(&gnss[i], obj));
+		zassert_true(MEMBERS_WRITE(nrf_cloud_gnss_msg_json_write, &gnss[i],
+					   out_buf, sizeof(out_buf)) > 0);
+		assert_identical(obj, out_buf);
+	}
+}
+
+/* Verify that an invalid GNSS message leaves nothing behind in the writer */
+ZTEST(nrf_cloud_codec_test, test_gnss_msg_invalid)
+{
+	const struct nrf_cloud_gnss_data gnss = {
+		.type = NRF_CLOUD_GNSS_TYPE_NMEA,
+		.ts_ms = 1700000000123,
+		.nmea.sentence = NULL
+	};
+
+	zassert_equal(MEMBERS_WRITE(nrf_cloud_gnss_msg_json_write, &gnss,
+				    out_buf, sizeof(out_buf)), -EINVAL);
+
+	struct nrf_cloud_json_writer wr;
+
+	nrf_cloud_json_writer_init(&wr, out_buf, sizeof(out_buf));
+	(void)nrf_cloud_json_obj_start(&wr, NULL);
+	zassert_equal(nrf_cloud_gnss_msg_json_write(&gnss, &wr), -EINVAL);
+	(void)nrf_cloud_json_obj_end(&wr);
+	zassert_equal(nrf_cloud_json_writer_finish(&wr), 2);
+	zassert_equal(strcmp(out_buf, "{}"), 0);
+}
+
+/* Verify that cellular positioning requests match the cJSON encoding */
+ZTEST(nrf_cloud_codec_test, test_cell_pos_req)
+{
+	struct lte_lc_ncell ncells[] = {
+		{ .earfcn = 6400, .phys_cell_id = 301, .rsrp = 40, .rsrq = 20, .time_diff = 24 },
+		{
+			.earfcn = 300,
+			.phys_cell_id = 17,
+			.rsrp = NRF_CLOUD_LOCATION_CELL_OMIT_RSRP,
+			.rsrq = NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ,
+			.time_diff = LTE_LC_CELL_TIME_DIFF_INVALID
+		},
+	};
+	struct lte_lc_cell gci_cells[] = {
+		{
+			.mcc = 242, .mnc = 1, .id = 21858829, .tac = 333,
+			.earfcn = 6400, .rsrp = 50, .rsrq = 10,
+			.timing_advance = NRF_CLOUD_LOCATION_CELL_TIME_ADV_MAX + 1
+		},
+		{
+			.mcc = 242, .mnc = 2, .id = 10000001, .tac = 4,
+			.earfcn = NRF_CLOUD_LOCATION_CELL_OMIT_EARFCN,
+			.rsrp = NRF_CLOUD_LOCATION_CELL_OMIT_RSRP,
+			.rsrq = NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ,
+			.timing_advance = NRF_CLOUD_LOCATION_CELL_OMIT_TIME_ADV
+		},
+	};
+	struct lte_lc_cells_info cells[] = {
+		{
+			.current_cell = {
+				.mcc = 242, .mnc = 1, .id = 21858829, .tac = 333,
+				.earfcn = 6400, .rsrp = 50, .rsrq = 10, .timing_advance = 80
+			},
+			.ncells_count = ARRAY_SIZE(ncells),
+			.neighbor_cells = ncells,
+			.gci_cells_count = ARRAY_SIZE(gci_cells),
+			.gci_cells = gci_cells
+		},
+		{
+			.current_cell = {
+				.mcc = 310, .mnc = 410, .id = 1234, .tac = 5,
+				.earfcn = NRF_CLOUD_LOCATION_CELL_OMIT_EARFCN,
+				.rsrp = NRF_CLOUD_LOCATION_CELL_OMIT_RSRP,
+				.rsrq = NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ,
+				.timing_advance = NRF_CLOUD_LOCATION_CELL_OMIT_TIME_ADV
+			},
+		},
+		{
+			.current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID,
+			.gci_cells_count = ARRAY_SIZE(gci_cells),
+			.gci_cells = gci_cells
+		},
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(cells); i++) {
+		cJSON *obj = cJSON_CreateObject();
+
+		zassert_ok(nrf_cloud_cell_pos_req_json_encode(&cells[i], obj));
+		zassert_true(MEMBERS_WRITE(nrf_cloud_cell_pos_req_json_write, &cells[i],
+					   out_buf, sizeof(out_buf)) > 0);
+		assert_identical(obj, out_buf);
+	}
+}
+
+/* Verify that a request without cells is rejected by both encoders */
+ZTEST(nrf_cloud_codec_test, test_cell_pos_req_no_cells)
+{
+	const struct lte_lc_cells_info cells = {
+		.current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID
+	};
+	cJSON *obj = cJSON_CreateObject();
+
+	zassert_equal(nrf_cloud_cell_pos_req_json_encode(&cells, obj), -ENODATA);
+	zassert_equal(MEMBERS_WRITE(nrf_cloud_cell_pos_req_json_write, &cells,
+				    out_buf, sizeof(out_buf)), -ENODATA);
+	cJSON_Delete(obj);
+}
+
+/* Verify that Wi-Fi positioning requests match the cJSON encoding */
+ZTEST(nrf_cloud_codec_test, test_wifi_req)
+{
+	struct wifi_scan_result aps[] = {
+		{
+			.ssid = "TestAP1",
+			.ssid_length = 7,
+			.channel = 36,
+			.rssi = -60,
+			.mac = {0x10, 0x34, 0x56, 0x78, 0x90, 0xAB},
+			.mac_length = 6
+		},
+		{
+			/* Local MAC address, not included in the request */
+			.ssid = "Local",
+			.ssid_length = 5,
+			.channel = 1,
+			.rssi = -40,
+			.mac = {0x12, 0x34, 0x56, 0x78, 0x90, 0xAB},
+			.mac_length = 6
+		},
+		{
+			.ssid_length = 0,
+			.channel = NRF_CLOUD_LOCATION_WIFI_OMIT_CHAN,
+			.rssi = NRF_CLOUD_LOCATION_WIFI_OMIT_RSSI,
+			.mac = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66},
+			.mac_length = 6
+		},
+		{
+			.ssid = "\"quoted\\ssid\"",
+			.ssid_length = 13,
+			.channel = 11,
+			.rssi = -85,
+			.mac = {0xA0, 0xB1, 0xC2, 0xD3, 0xE4, 0xF5},
+			.mac_length = 6
+		},
+	};
+	const struct wifi_scan_info wifi = {
+		.ap_info = aps,
+		.cnt = ARRAY_SIZE(aps)
+	};
+	cJSON *obj = cJSON_CreateObject();
+
+	zassert_ok(nrf_cloud_wifi_req_json_encode(&wifi, obj));
+	zassert_true(MEMBERS_WRITE(nrf_cloud_wifi_req_json_write, &wifi,
+				   out_buf, sizeof(out_buf)) > 0);
+	assert_identical(obj, out_buf);
+}
+
+/* Verify that too few non-local access points are rejected by both encoders */
+ZTEST(nrf_cloud_codec_test, test_wifi_req_too_few_aps)
+{
+	struct wifi_scan_result aps[] = {
+		{ .mac = {0x10, 0x34, 0x56, 0x78, 0x90, 0xAB}, .mac_length = 6 },
+		{ .mac = {0x02, 0x34, 0x56, 0x78, 0x90, 0xAB}, .mac_length = 6 },
+		{ .mac = {0x00, 0x00, 0x5E, 0x00, 0x53, 0x01}, .mac_length = 6 },
+	};
+	const struct wifi_scan_info wifi = {
+		.ap_info = aps,
+		.cnt = ARRAY_SIZE(aps)
+	};
+	cJSON *obj = cJSON_CreateObject();
+
+	zassert_equal(nrf_cloud_wifi_req_json_encode(&wifi, obj), -ENODATA);
+	zassert_equal(MEMBERS_WRITE(nrf_cloud_wifi_req_json_write, &wifi,
+				    out_buf, sizeof(out_buf)), -ENODATA);
+	cJSON_Delete(obj);
+}
+
+/* Verify that location request payloads match the cJSON encoding, including the fallbacks */
+ZTEST(nrf_cloud_codec_test, test_location_request_payload)
+{
+	struct wifi_scan_result aps[] = {
+		{ .mac = {0x10, 0x34, 0x56, 0x78, 0x90, 0xAB}, .mac_length = 6, .rssi = -60 },
+		{ .mac = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66}, .mac_length = 6, .rssi = -70 },
+	};
+	const struct wifi_scan_info wifi = {
+		.ap_info = aps,
+		.cnt = ARRAY_SIZE(aps)
+	};
+	const struct wifi_scan_info wifi_too_few = {
+		.ap_info = aps,
+		.cnt = 1
+	};
+	const struct lte_lc_cells_info cells = {
+		.current_cell = {
+			.mcc = 242, .mnc = 1, .id = 21858829, .tac = 3,
+			.earfcn = 6400, .rsrp = 50, .rsrq = 10, .timing_advance = 80
+		},
+	};
+	const struct lte_lc_cells_info no_cells = {
+		.current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID
+	};
+	const struct {
+		const struct lte_lc_cells_info *cells;
+		const struct wifi_scan_info *wifi;
+	} reqs[] = {
+		{ &cells, NULL },
+		{ NULL, &wifi },
+		{ &cells, &wifi },
+		/* Cellular data is excluded */
+		{ &no_cells, &wifi },
+		/* Wi-Fi data is excluded */
+		{ &cells, &wifi_too_few },
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(reqs); i++) {
+		NRF_CLOUD_OBJ_JSON_DEFINE(obj);
+		struct nrf_cloud_data payload = {0};
+
+		zassert_ok(nrf_cloud_obj_init(&obj));
+		zassert_ok(nrf_cloud_obj_location_request_payload_add(&obj, reqs[i].cells,
+								      reqs[i].wifi));
+		zassert_ok(nrf_cloud_location_request_payload_encode(reqs[i].cells, reqs[i].wifi,
+								     &payload));
+		zassert_equal(payload.len, strlen(payload.ptr));
+		assert_identical(obj.json, payload.ptr);
+		nrf_cloud_free((void *)payload.ptr);
+	}
+
+	/* Neither request type can be included */
+	struct nrf_cloud_data payload = {0};
+
+	zassert_equal(nrf_cloud_location_request_payload_encode(&no_cells, &wifi_too_few,
+								&payload), -ENODATA);
+	zassert_is_null(payload.ptr);
+}
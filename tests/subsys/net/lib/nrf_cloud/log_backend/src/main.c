@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+
+#include "nrf_cloud_log_backend.c"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VOID_FUNC(nrf_cloud_log_init);
+FAKE_VALUE_FUNC(int, nrf_cloud_log_control_get);
+FAKE_VALUE_FUNC(bool, nrf_cloud_log_is_enabled);
+FAKE_VOID_FUNC(logs_init_context, void *, const char *, int, uint32_t, const char *,
+	       uint8_t, int64_t, struct nrf_cloud_log_context *);
+FAKE_VALUE_FUNC(int, nrf_cloud_log_json_encode, struct nrf_cloud_log_context *, uint8_t *,
+		size_t, struct nrf_cloud_data *);
+FAKE_VALUE_FUNC(enum nfsm_state, nfsm_get_current_state);
+FAKE_VALUE_FUNC(int, nrf_cloud_send, const struct nrf_cloud_tx_data *);
+FAKE_VALUE_FUNC(int, nrf_cloud_client_id_ptr_get, const char **);
+FAKE_VALUE_FUNC(int, nrf_cloud_rest_send_device_message, struct nrf_cloud_rest_context *const,
+		const char *const, const char *const, const bool, const char *const);
+FAKE_VALUE_FUNC(bool, nrf_cloud_coap_is_connected);
+FAKE_VALUE_FUNC(int, nrf_cloud_coap_json_message_send, const char *, bool, bool);
+FAKE_VALUE_FUNC(int, nrf_cloud_coap_bin_log_send, const uint8_t * const, size_t, bool);
+FAKE_VALUE_FUNC(void *, nrf_cloud_malloc, size_t);
+FAKE_VOID_FUNC(nrf_cloud_free, void *);
+
+#define TEST_LOG_LINES		1000
+/* Log lines rendered by each pass of the logging thread */
+#define LINES_PER_PASS		4
+#define PASSES			(TEST_LOG_LINES / LINES_PER_PASS)
+/* Time between passes of the logging thread */
+#define PASS_INTERVAL_MS	10
+/* Size of a rendered dictionary log line */
+#define LINE_SIZE		12
+/* Unbatched, each pass is sent on its own */
+#define UNBATCHED_BYTES		(PASSES * (sizeof(struct nrf_cloud_bin_hdr) + \
+					   LINES_PER_PASS * LINE_SIZE))
+/* Long enough for the batch flush work to send an open batch */
+#define FLUSH_WAIT_MS		MAX(BATCH_WINDOW_MS * 2, PASS_INTERVAL_MS)
+
+static size_t bytes_sent;
+static size_t msgs_sent;
+static K_SEM_DEFINE(send_started, 0, 1);
+static K_SEM_DEFINE(send_release, 0, 1);
+
+static int fake_nrf_cloud_send__count(const struct nrf_cloud_tx_data *msg)
+{
+	zassert_equal(msg->topic_type, NRF_CLOUD_TOPIC_BIN);
+	bytes_sent += msg->data.len;
+	msgs_sent++;
+	return 0;
+}
+
+static int fake_nrf_cloud_send__block(const struct nrf_cloud_tx_data *msg)
+{
+	k_sem_give(&send_started);
+	(void)k_sem_take(&send_release, K_FOREVER);
+
+	return fake_nrf_cloud_send__count(msg);
+}
+
+static enum nfsm_state fake_nfsm_get_current_state__connected(void)
+{
+	return STATE_DC_CONNECTED;
+}
+
+static void *fake_nrf_cloud_malloc__heap(size_t size)
+{
+	return k_malloc(size);
+}
+
+static void fake_nrf_cloud_free__heap(void *ptr)
+{
+	k_free(ptr);
+}
+
+static void log_line_render(const int i)
+{
+	memset(log_buf, i, LINE_SIZE);
+	zassert_equal(logger_out(log_buf, LINE_SIZE, NULL), LINE_SIZE);
+}
+
+static void log_lines_render(void)
+{
+	for (int i = 0; i < TEST_LOG_LINES; i++) {
+		log_line_render(i);
+
+		if (((i + 1) % LINES_PER_PASS) != 0) {
+			continue;
+		}
+
+		k_sleep(K_MSEC(PASS_INTERVAL_MS));
+		logger_notify(&log_nrf_cloud_backend, LOG_BACKEND_EVT_PROCESS_THREAD_DONE, NULL);
+	}
+
+	/* Let the batch flush work send any remaining output */
+	k_sleep(K_MSEC(FLUSH_WAIT_MS));
+	zassert_equal(num_msgs, 0, "Log output was left in the buffer");
+	zassert_equal(stats.lines_sent, TEST_LOG_LINES);
+}
+
+static void *suite_setup(void)
+{
+	/* Starts the batch flush work queue */
+	logger_init(&log_nrf_cloud_backend);
+
+	return NULL;
+}
+
+static void reset_state(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	RESET_FAKE(nrf_cloud_send);
+	RESET_FAKE(nfsm_get_current_state);
+	RESET_FAKE(nrf_cloud_malloc);
+	RESET_FAKE(nrf_cloud_free);
+	FFF_RESET_HISTORY();
+
+	nrf_cloud_send_fake.custom_fake = fake_nrf_cloud_send__count;
+	nfsm_get_current_state_fake.custom_fake = fake_nfsm_get_current_state__connected;
+	nrf_cloud_malloc_fake.custom_fake = fake_nrf_cloud_malloc__heap;
+	nrf_cloud_free_fake.custom_fake = fake_nrf_cloud_free__heap;
+
+	log_format_current = LOG_OUTPUT_DICT;
+	memset(&stats, 0, sizeof(stats));
+	bytes_sent = 0;
+	msgs_sent = 0;
+	k_sem_reset(&send_started);
+	k_sem_reset(&send_release);
+}
+
+ZTEST(nrf_cloud_log_backend_test, test_bytes_on_wire)
+{
+	log_lines_render();
+
+	TC_PRINT("Per %d log lines, %s: %zu messages, %zu bytes\n", TEST_LOG_LINES,
+		 BATCH_WINDOW_MS ? "batched" : "unbatched", msgs_sent, bytes_sent);
+
+	if (BATCH_WINDOW_MS == 0) {
+		zassert_equal(msgs_sent, PASSES);
+		zassert_equal(bytes_sent, UNBATCHED_BYTES);
+	} else {
+		zassert_true(msgs_sent < PASSES, "Batching did not reduce the number of uploads");
+		zassert_true(bytes_sent < UNBATCHED_BYTES,
+			     "Batching did not reduce the bytes on wire");
+	}
+
+	if (BATCH_WINDOW_MS == 0) {
+		/* Every batch is sent directly from the ring buffer */
+		zassert_equal(nrf_cloud_malloc_fake.call_count, 0);
+		zassert_equal(nrf_cloud_free_fake.call_count, 0);
+	} else {
+		/* Every batch is copied out of the ring buffer and freed after sending */
+		zassert_equal(nrf_cloud_malloc_fake.call_count, msgs_sent);
+		zassert_equal(nrf_cloud_free_fake.call_count, msgs_sent);
+	}
+}
+
+ZTEST(nrf_cloud_log_backend_test, test_batch_dropped_without_memory)
+{
+	if (BATCH_WINDOW_MS == 0) {
+		ztest_test_skip();
+	}
+
+	/* The batch cannot be copied out of the ring buffer */
+	nrf_cloud_malloc_fake.custom_fake = NULL;
+	nrf_cloud_malloc_fake.return_val = NULL;
+
+	log_line_render(0);
+	log_line_render(1);
+	k_sleep(K_MSEC(FLUSH_WAIT_MS));
+
+	zassert_equal(nrf_cloud_send_fake.call_count, 0);
+	zassert_equal(num_msgs, 0);
+	zassert_equal(stats.lines_sent, 0);
+	zassert_equal(stats.lines_dropped, 2);
+
+	/* The next batch is sent once memory is available again */
+	nrf_cloud_malloc_fake.custom_fake = fake_nrf_cloud_malloc__heap;
+
+	log_line_render(2);
+	k_sleep(K_MSEC(FLUSH_WAIT_MS));
+
+	zassert_equal(nrf_cloud_send_fake.call_count, 1);
+	zassert_equal(stats.lines_sent, 1);
+}
+
+ZTEST(nrf_cloud_log_backend_test, test_batch_held_while_disconnected)
+{
+	if (BATCH_WINDOW_MS == 0) {
+		ztest_test_skip();
+	}
+
+	log_line_render(0);
+
+	/* The window is still open, so the output stays buffered */
+	logger_notify(&log_nrf_cloud_backend, LOG_BACKEND_EVT_PROCESS_THREAD_DONE, NULL);
+	zassert_equal(nrf_cloud_send_fake.call_count, 0);
+
+	/* The batch is kept while the cloud connection is not available */
+	nfsm_get_current_state_fake.custom_fake = NULL;
+	nfsm_get_current_state_fake.return_val = STATE_DC_CONNECTING;
+	k_sleep(K_MSEC(FLUSH_WAIT_MS));
+	zassert_equal(nrf_cloud_send_fake.call_count, 0);
+	zassert_equal(num_msgs, 1);
+
+	/* And sent once the connection is back */
+	nfsm_get_current_state_fake.custom_fake = fake_nfsm_get_current_state__connected;
+	k_sleep(K_MSEC(FLUSH_WAIT_MS));
+	zassert_equal(nrf_cloud_send_fake.call_count, 1);
+	zassert_equal(bytes_sent, sizeof(struct nrf_cloud_bin_hdr) + LINE_SIZE);
+	zassert_equal(num_msgs, 0);
+}
+
+ZTEST(nrf_cloud_log_backend_test, test_buffering_while_sending)
+{
+	if (BATCH_WINDOW_MS == 0) {
+		ztest_test_skip();
+	}
+
+	nrf_cloud_send_fake.custom_fake = fake_nrf_cloud_send__block;
+
+	/* The batch flush work starts sending the first batch */
+	log_line_render(0);
+	zassert_ok(k_sem_take(&send_started, K_MSEC(FLUSH_WAIT_MS)));
+	zassert_equal(num_msgs, 0);
+
+	/* New output is buffered while the first batch is being sent */
+	log_line_render(1);
+	zassert_equal(num_msgs, 1);
+
+	nrf_cloud_send_fake.custom_fake = fake_nrf_cloud_send__count;
+	k_sem_give(&send_release);
+
+	/* The second batch is sent when its window closes */
+	k_sleep(K_MSEC(FLUSH_WAIT_MS));
+	zassert_equal(nrf_cloud_send_fake.call_count, 2);
+	zassert_equal(num_msgs, 0);
+	zassert_equal(stats.lines_sent, 2);
+}
+
+ZTEST_SUITE(nrf_cloud_log_backend_test, NULL, suite_setup, reset_state, NULL, NULL);
@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <zephyr/ztest.h>
+#include <zephyr/sys/byteorder.h>
 #include <suit_dfu_cache.h>
 
 /*
@@ -153,3 +155,175 @@ ZTEST(cache_tests, test_suit_dfu_cache_search_empty)
 
 	zassert_not_equal(ret, SUIT_PLAT_SUCCESS, "\nGet from cache should have failed");
 }
+
+/* { "http://a.com": h'01020304' } */
+static const uint8_t rewrite_cache_before[] = {0xBF, 0x6C, 0x68, 0x74, 0x74, 0x70, 0x3A,
+					       0x2F, 0x2F, 0x61, 0x2E, 0x63, 0x6F, 0x6D,
+					       0x44, 0x01, 0x02, 0x03, 0x04, 0xFF};
+
+/* { "http://b.com": h'05', "http://a.com": h'0607' } */
+static const uint8_t rewrite_cache_after[] = {
+	0xBF, 0x6C, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x62, 0x2E, 0x63, 0x6F,
+	0x6D, 0x41, 0x05, 0x6C, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x61, 0x2E,
+	0x63, 0x6F, 0x6D, 0x42, 0x06, 0x07, 0xFF};
+
+static uint8_t rewrite_cache[sizeof(rewrite_cache_after)];
+
+ZTEST(cache_tests, test_suit_dfu_cache_search_after_raw_rewrite)
+{
+	struct dfu_cache dfu_caches = {.pools_count = 1};
+	const uint8_t a_uri[] = "http://a.com";
+	const uint8_t b_uri[] = "http://b.com";
+	const uint8_t *payload = NULL;
+	size_t payload_size = 0;
+
+	memset(rewrite_cache, 0xFF, sizeof(rewrite_cache));
+	memcpy(rewrite_cache, rewrite_cache_before, sizeof(rewrite_cache_before));
+
+	dfu_caches.pools[0].address = rewrite_cache;
+	dfu_caches.pools[0].size = sizeof(rewrite_cache);
+
+	suit_dfu_cache_deinitialize();
+
+	suit_plat_err_t rc = suit_dfu_cache_initialize(&dfu_caches);
+
+	zassert_equal(rc, SUIT_PLAT_SUCCESS, "Failed to initialize cache: %i", rc);
+
+	/* Build the index from the original pool content */
+	int ret = suit_dfu_cache_search(a_uri, sizeof(a_uri), &payload, &payload_size);
+
+	zassert_equal(ret, SUIT_PLAT_SUCCESS, "Get from cache failed");
+	zassert_equal(payload_size, 4, "Invalid payload size");
+	zassert_equal(payload, &rewrite_cache[15], "Invalid payload");
+
+	ret = suit_dfu_cache_search(b_uri, sizeof(b_uri), &payload, &payload_size);
+	zassert_equal(ret, SUIT_PLAT_ERR_NOT_FOUND, "Get from cache should have failed");
+
+	/* Rewrite the pool bypassing the cache slot API, like a raw cache upload does */
+	memcpy(rewrite_cache, rewrite_cache_after, sizeof(rewrite_cache_after));
+	suit_dfu_cache_index_invalidate();
+
+	ret = suit_dfu_cache_search(a_uri, sizeof(a_uri), &payload, &payload_size);
+	zassert_equal(ret, SUIT_PLAT_SUCCESS, "Get from cache failed");
+	zassert_equal(payload_size, 2, "Invalid payload size");
+	zassert_equal(payload, &rewrite_cache[30], "Invalid payload");
+
+	ret = suit_dfu_cache_search(b_uri, sizeof(b_uri), &payload, &payload_size);
+	zassert_equal(ret, SUIT_PLAT_SUCCESS, "Get from cache failed");
+	zassert_equal(payload_size, 1, "Invalid payload size");
+	zassert_equal(*payload, 0x05, "Invalid payload");
+}
+
+#define BENCHMARK_SLOTS	     48
+#define BENCHMARK_URI_PREFIX "http://source.com/image_"
+#define BENCHMARK_URI_SUFFIX ".bin"
+#define BENCHMARK_URI_LEN    (sizeof(BENCHMARK_URI_PREFIX "00" BENCHMARK_URI_SUFFIX) - 1)
+#define BENCHMARK_ITERATIONS 10
+
+/* Indefinite map header, slots with a 4 byte payload and the map end marker */
+static uint8_t benchmark_cache[1 + BENCHMARK_SLOTS * (2 + BENCHMARK_URI_LEN + 1 + 4) + 1];
+
+/* Null terminated URI of a slot, uri must hold BENCHMARK_URI_LEN + 1 characters */
+static void benchmark_uri_get(char *uri, unsigned int slot)
+{
+	char *p = uri;
+
+	memcpy(p, BENCHMARK_URI_PREFIX, strlen(BENCHMARK_URI_PREFIX));
+	p += strlen(BENCHMARK_URI_PREFIX);
+	*p++ = '0' + (slot / 10) % 10;
+	*p++ = '0' + slot % 10;
+	strcpy(p, BENCHMARK_URI_SUFFIX);
+}
+
+static void benchmark_cache_initialize(void)
+{
+	struct dfu_cache dfu_caches = {.pools_count = 1};
+	uint8_t *p = benchmark_cache;
+
+	*p++ = 0xBF;
+	for (unsigned int i = 0; i < BENCHMARK_SLOTS; i++) {
+		char uri[BENCHMARK_URI_LEN + 1];
+
+		benchmark_uri_get(uri, i);
+
+		/* tstr with one byte length, followed by a four byte bstr holding the slot index */
+		*p++ = 0x78;
+		*p++ = BENCHMARK_URI_LEN;
+		memcpy(p, uri, BENCHMARK_URI_LEN);
+		p += BENCHMARK_URI_LEN;
+		*p++ = 0x44;
+		sys_put_be32(i, p);
+		p += 4;
+	}
+	*p++ = 0xFF;
+
+	dfu_caches.pools[0].address = benchmark_cache;
+	dfu_caches.pools[0].size = p - benchmark_cache;
+
+	suit_dfu_cache_deinitialize();
+
+	suit_plat_err_t rc = suit_dfu_cache_initialize(&dfu_caches);
+
+	zassert_equal(rc, SUIT_PLAT_SUCCESS, "Failed to initialize cache: %i", rc);
+}
+
+ZTEST(cache_tests, test_suit_dfu_cache_search_many_slots)
+{
+	benchmark_cache_initialize();
+
+	/* Search in reverse order, so that slots are not found in the order they are stored */
+	for (int i = BENCHMARK_SLOTS - 1; i >= 0; i--) {
+		char uri[BENCHMARK_URI_LEN + 1];
+		const uint8_t *payload = NULL;
+		size_t payload_size = 0;
+
+		benchmark_uri_get(uri, i);
+
+		/* Both null terminated strings and tstr values are accepted */
+		int ret = suit_dfu_cache_search((const uint8_t *)uri, (i % 2) ? sizeof(uri) : strlen(uri),
+						&payload, &payload_size);
+
+		zassert_equal(ret, SUIT_PLAT_SUCCESS, "Slot %d not found", i);
+		zassert_equal(payload_size, 4, "Invalid payload size for slot %d", i);
+		zassert_equal(sys_get_be32(payload), i, "Invalid payload for slot %d", i);
+	}
+
+	const uint8_t nok_uri[] = "http://source.com/image_99.bin";
+	const uint8_t *payload = NULL;
+	size_t payload_size = 0;
+
+	int ret = suit_dfu_cache_search(nok_uri, sizeof(nok_uri), &payload, &payload_size);
+
+	zassert_equal(ret, SUIT_PLAT_ERR_NOT_FOUND, "Get from cache should have failed");
+}
+
+ZTEST(cache_tests, test_suit_dfu_cache_search_benchmark)
+{
+	char uris[BENCHMARK_SLOTS][BENCHMARK_URI_LEN + 1];
+	uint32_t start;
+	uint32_t cycles;
+
+	for (unsigned int i = 0; i < BENCHMARK_SLOTS; i++) {
+		benchmark_uri_get(uris[i], i);
+	}
+
+	benchmark_cache_initialize();
+
+	start = k_cycle_get_32();
+	for (int n = 0; n < BENCHMARK_ITERATIONS; n++) {
+		for (unsigned int i = 0; i < BENCHMARK_SLOTS; i++) {
+			const uint8_t *payload = NULL;
+			size_t payload_size = 0;
+
+			int ret = suit_dfu_cache_search((const uint8_t *)uris[i], BENCHMARK_URI_LEN,
+							&payload, &payload_size);
+
+			zassert_equal(ret, SUIT_PLAT_SUCCESS, "Slot %d not found", i);
+		}
+	}
+	cycles = k_cycle_get_32() - start;
+
+	printk("DFU cache search in %d slots (index %s): %u cycles per search\n",
+	       BENCHMARK_SLOTS, IS_ENABLED(CONFIG_SUIT_CACHE_INDEX) ? "enabled" : "disabled",
+	       cycles / (BENCHMARK_ITERATIONS * BENCHMARK_SLOTS));
+}